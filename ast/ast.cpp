@@ -1 +1,104 @@
-// I don't think we need this but maybe later
\ No newline at end of file
+// ast.cpp
+
+#include "ast.h"
+
+std::string_view NodeKindName(NodeKind kind) {
+    switch (kind) {
+        case NodeKind::None: return "";
+        case NodeKind::Program: return "PROGRAM";
+        case NodeKind::Function: return "FUNCTION";
+        case NodeKind::Params: return "PARAMS";
+        case NodeKind::Block: return "CODE BLOCK";
+        case NodeKind::Declaration: return "DECLARATION";
+        case NodeKind::Identifier: return "IDENTIFIER";
+        case NodeKind::FunctionCall: return "FUNCTION CALL";
+        case NodeKind::Arguments: return "ARGUMENTS";
+        case NodeKind::For: return "FOR";
+        case NodeKind::Forn: return "FORN";
+        case NodeKind::While: return "WHILE";
+        case NodeKind::If: return "IF_STATEMENT";
+        case NodeKind::Return: return "RETURN";
+        case NodeKind::Cout: return "COUT";
+        case NodeKind::Cin: return "CIN";
+        case NodeKind::Empty: return "EMPTY";
+        case NodeKind::BinaryOperator: return "BINARY OPERATOR";
+        case NodeKind::UnaryOperator: return "UNARY OPERATOR";
+        case NodeKind::PostfixOperator: return "POSTFIX OPERATOR";
+        case NodeKind::IntLiteral: return "INT_LITERAL";
+        case NodeKind::FloatLiteral: return "FLOAT_LITERAL";
+        case NodeKind::StringLiteral: return "STRING_LITERAL";
+        case NodeKind::CharLiteral: return "CHAR_LITERAL";
+        case NodeKind::BooleanLiteral: return "BOOLEAN_LITERAL";
+    }
+    return "";
+}
+
+NodeKind LiteralKind(TokenType type) {
+    switch (type) {
+        case TokenType::INT_LITERAL: return NodeKind::IntLiteral;
+        case TokenType::FLOAT_LITERAL: return NodeKind::FloatLiteral;
+        case TokenType::STRING_LITERAL: return NodeKind::StringLiteral;
+        case TokenType::CHAR_LITERAL: return NodeKind::CharLiteral;
+        case TokenType::BOOLEAN_LITERAL: return NodeKind::BooleanLiteral;
+        default: return NodeKind::None;
+    }
+}
+
+int AST::Add() {
+    nodes.emplace_back();
+    return static_cast<int>(nodes.size()) - 1;
+}
+
+void AST::AddChild(int parent, int child) {
+    ASTNode& node = nodes[parent];
+    int previous = node.childCount ? static_cast<int>(node.firstChild) : -1;
+    if (previous == -1) parents.push_back(parent);
+    node.firstChild = static_cast<uint32_t>(pending.size());
+    node.childCount++;
+    pending.push_back({child, previous});
+}
+
+// Each pending list runs newest to oldest, so it is written back to front.
+void AST::Finish() {
+    edges.reserve(edges.size() + pending.size());
+    for (int parent : parents) {
+        ASTNode& node = nodes[parent];
+        size_t start = edges.size();
+        edges.resize(start + node.childCount);
+        int edge = static_cast<int>(node.firstChild);
+        for (size_t i = start + node.childCount; i-- > start; ) {
+            edges[i] = pending[edge].child;
+            edge = pending[edge].previous;
+        }
+        node.firstChild = static_cast<uint32_t>(start);
+    }
+    pending.clear();
+    parents.clear();
+}
+
+void AST::SetChildren(int node, const std::vector<int>& children) {
+    nodes[node].firstChild = static_cast<uint32_t>(edges.size());
+    nodes[node].childCount = static_cast<uint32_t>(children.size());
+    edges.insert(edges.end(), children.begin(), children.end());
+}
+
+int AST::Append(ASTView other) {
+    int nodeOffset = static_cast<int>(nodes.size());
+    uint32_t edgeOffset = static_cast<uint32_t>(edges.size());
+    nodes.reserve(nodes.size() + other.size());
+    for (size_t i = 0; i < other.size(); i++) {
+        ASTNode node = other[i];
+        node.firstChild += edgeOffset;
+        nodes.push_back(node);
+    }
+    edges.reserve(edges.size() + other.EdgeCount());
+    for (size_t i = 0; i < other.EdgeCount(); i++) edges.push_back(other.Edges()[i] + nodeOffset);
+    return nodeOffset;
+}
+
+void AST::clear() {
+    nodes.clear();
+    edges.clear();
+    pending.clear();
+    parents.clear();
+}
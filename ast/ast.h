@@ -3,18 +3,170 @@
 #ifndef AST_H
 #define AST_H
 
-#include <string>
+#include <cstdint>
+#include <string_view>
 #include <vector>
-#include <memory>
+#include "../token/interner.h"
+#include "../token/token.h"
+#include "../memory/arena.h"
 
+// What a node is. Dispatch on the kind is an integer compare; the text the
+// tree printer shows for it comes from NodeKindName.
+enum class NodeKind : uint8_t {
+    None,  // created but never filled in
+    Program,
+    Function,
+    Params,
+    Block,
+    Declaration,
+    Identifier,
+    FunctionCall,
+    Arguments,
+    For,
+    Forn,
+    While,
+    If,
+    Return,
+    Cout,
+    Cin,
+    Empty,
+    BinaryOperator,
+    UnaryOperator,
+    PostfixOperator,
+    IntLiteral,
+    FloatLiteral,
+    StringLiteral,
+    CharLiteral,
+    BooleanLiteral,
+};
+
+// "FUNCTION CALL", "INT_LITERAL", ... and for the list nodes (Params,
+// Block, Arguments) their label, "PARAMS", "CODE BLOCK", "ARGUMENTS".
+std::string_view NodeKindName(NodeKind kind);
+
+// Parameter, argument and statement lists; the printer shows them by label
+// rather than as a typed node.
+inline bool IsListKind(NodeKind kind) {
+    return kind == NodeKind::Params || kind == NodeKind::Block || kind == NodeKind::Arguments;
+}
+
+// Literal kind for a literal token type, NodeKind::None for anything else.
+NodeKind LiteralKind(TokenType type);
 
-// AST structure
+// AST structure. Nothing in a node owns text: identifiers and literals are
+// interned symbols, and operators and types are token types whose
+// spelling is TokenText. Children live in the owning AST's edge array.
 class ASTNode {
 public:
-    std::string type;
-    std::string varType;
-    std::string name;
-    std::vector<int> children;
+    NodeKind kind = NodeKind::None;
+    TokenType varType = TokenType::ILLEGAL; // FUNCTION and DECLARATION
+    TokenType op = TokenType::ILLEGAL;      // operator nodes
+    // Identifier or literal text, for FUNCTION, DECLARATION, IDENTIFIER and
+    // the literal kinds.
+    Symbol name = Interner::kNone;
+    uint32_t firstChild = 0;  // into AST::edges once finished
+    uint32_t childCount = 0;
+};
+
+static_assert(sizeof(ASTNode) == 16, "ASTNode should stay four words");
+
+// A node's children: a contiguous run of the edge array.
+class ChildRange {
+public:
+    ChildRange(const int* first, size_t count) : first(first), count(count) {}
+    const int* begin() const { return first; }
+    const int* end() const { return first + count; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    int operator[](size_t i) const { return first[i]; }
+
+private:
+    const int* first;
+    size_t count;
+};
+
+// Read-only view of a finished tree: node and edge arrays owned elsewhere,
+// by an AST or by a mapped cache file (see ast_file.h).
+class ASTView {
+public:
+    ASTView() = default;
+    ASTView(const ASTNode* nodes, size_t count, const int* edges, size_t edgeCount)
+        : nodes(nodes), count(count), edges(edges), edgeCount(edgeCount) {}
+
+    const ASTNode& operator[](int i) const { return nodes[i]; }
+    ChildRange Children(int node) const {
+        return ChildRange(edges + nodes[node].firstChild, nodes[node].childCount);
+    }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    // The raw arrays, for writing the tree out
+    const ASTNode* Nodes() const { return nodes; }
+    const int* Edges() const { return edges; }
+    size_t EdgeCount() const { return edgeCount; }
+
+private:
+    const ASTNode* nodes = nullptr;
+    size_t count = 0;
+    const int* edges = nullptr;
+    size_t edgeCount = 0;
+};
+
+// Every node of a tree, with all child lists packed back to back in one
+// edge array (CSR): the children of node i are
+// edges[firstChild, firstChild + childCount).
+//
+// The parser adds children in whatever order nodes complete, interleaved
+// across parents, so AddChild first threads each parent's children through
+// a backward-linked pending list, and Finish() packs them into edges. Both
+// lists are flat vectors, so building a tree allocates O(1) times (amortized)
+// however many nodes it has. Children() is only valid after Finish(), and a
+// finished node can't get more children.
+class AST {
+public:
+    // With an arena, the nodes, edges and build lists all come from it.
+    explicit AST(Arena* arena = nullptr)
+        : nodes(arena), edges(arena), pending(arena), parents(arena) {}
+
+    int Add();
+    void AddChild(int parent, int child);
+    void Finish();
+
+    // Appends a finished tree, shifting its node and edge indices; returns
+    // the index its node 0 now has. Appending to an empty tree copies one,
+    // e.g. to get a mapped tree that can be changed.
+    int Append(ASTView other);
+    int Append(const AST& other) { return Append(other.View()); }
+
+    ChildRange Children(int node) const {
+        return ChildRange(edges.data() + nodes[node].firstChild, nodes[node].childCount);
+    }
+
+    // Gives a node of a finished tree a new child list, appended to the
+    // edge array; its old range is left unused. For passes that restructure
+    // the tree. Invalidates ChildRanges.
+    void SetChildren(int node, const std::vector<int>& children);
+
+    // Valid until the tree changes.
+    ASTView View() const { return ASTView(nodes.data(), nodes.size(), edges.data(), edges.size()); }
+
+    ASTNode& operator[](int i) { return nodes[i]; }
+    const ASTNode& operator[](int i) const { return nodes[i]; }
+    size_t size() const { return nodes.size(); }
+    bool empty() const { return nodes.empty(); }
+    void clear();
+
+    ArenaVector<ASTNode> nodes;
+    ArenaVector<int> edges;
+
+private:
+    // While building, a node's firstChild is its newest pending edge.
+    struct PendingEdge {
+        int child;
+        int previous;  // earlier pending edge of the same parent, or -1
+    };
+    ArenaVector<PendingEdge> pending;
+    ArenaVector<int> parents;  // nodes with pending children, in first-add order
 };
 
 #endif // AST_H
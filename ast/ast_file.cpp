@@ -0,0 +1,156 @@
+// ast_file.cpp
+
+#include "ast_file.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/stat.h>
+#include <type_traits>
+#include <unistd.h>
+
+namespace {
+
+constexpr char kMagic[8] = {'F', 'P', 'P', 'A', 'S', 'T', '\0', '\0'};
+constexpr uint32_t kByteOrder = 0x01020304;
+
+static_assert(std::is_trivially_copyable<ASTNode>::value, "nodes are written as raw bytes");
+static_assert(sizeof(ASTFileHeader) % alignof(ASTNode) == 0, "nodes follow the header aligned");
+
+template <class T>
+const T* At(std::string_view file, uint64_t offset) {
+    return reinterpret_cast<const T*>(file.data() + offset);
+}
+
+// The section [offset, offset + count * sizeof(T)) lies inside the file and
+// is aligned for T.
+template <class T>
+bool Fits(std::string_view file, uint64_t offset, uint64_t count) {
+    return offset % alignof(T) == 0 && offset <= file.size() &&
+           count <= (file.size() - offset) / sizeof(T);
+}
+
+bool WriteAll(std::FILE* out, const void* data, size_t size) {
+    return size == 0 || std::fwrite(data, 1, size, out) == size;
+}
+
+}  // namespace
+
+uint64_t HashSource(std::string_view source) {
+    // word at a time multiply-xorshift; the size is mixed in last
+    const uint64_t k = 0x9e3779b97f4a7c15ULL;
+    uint64_t h = 0x243f6a8885a308d3ULL;
+    size_t i = 0;
+    for (; i + 8 <= source.size(); i += 8) {
+        uint64_t w;
+        std::memcpy(&w, source.data() + i, 8);
+        h = (h ^ w) * k;
+        h ^= h >> 29;
+    }
+    uint64_t tail = 0;
+    std::memcpy(&tail, source.data() + i, source.size() - i);
+    h = (h ^ tail ^ (static_cast<uint64_t>(source.size()) << 3)) * k;
+    h ^= h >> 32;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    return h ^ (h >> 29);
+}
+
+bool WriteASTFile(const std::string& path, std::string_view source, ASTView tree,
+                  NameTable names) {
+    ASTFileHeader header = {};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kASTFileVersion;
+    header.byteOrder = kByteOrder;
+    header.sourceHash = HashSource(source);
+    header.sourceSize = source.size();
+    header.nodeCount = static_cast<uint32_t>(tree.size());
+    header.edgeCount = static_cast<uint32_t>(tree.EdgeCount());
+    header.symbolCount = static_cast<uint32_t>(names.Size());
+    header.blobSize = static_cast<uint32_t>(names.BlobSize());
+    header.nodesOffset = sizeof(ASTFileHeader);
+    header.edgesOffset = header.nodesOffset + uint64_t(header.nodeCount) * sizeof(ASTNode);
+    header.startsOffset = header.edgesOffset + uint64_t(header.edgeCount) * sizeof(int);
+    header.blobOffset = header.startsOffset + (uint64_t(header.symbolCount) + 1) * sizeof(uint32_t);
+
+    // an empty table has no starts array to copy
+    const uint32_t zero = 0;
+    const uint32_t* starts = names.Starts() ? names.Starts() : &zero;
+
+    std::string temp = path + ".tmp." + std::to_string(getpid());
+    std::FILE* out = std::fopen(temp.c_str(), "wb");
+    if (!out) return false;
+    bool ok = WriteAll(out, &header, sizeof(header)) &&
+              WriteAll(out, tree.Nodes(), header.nodeCount * sizeof(ASTNode)) &&
+              WriteAll(out, tree.Edges(), header.edgeCount * sizeof(int)) &&
+              WriteAll(out, starts, (header.symbolCount + 1) * sizeof(uint32_t)) &&
+              WriteAll(out, names.Blob(), header.blobSize);
+    ok &= std::fclose(out) == 0;
+    if (ok) ok = std::rename(temp.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(temp.c_str());
+    return ok;
+}
+
+bool MappedAST::Open(const std::string& path, std::string_view source) {
+    tree = ASTView();
+    names = NameTable();
+    if (!file.Open(path)) return false;
+    std::string_view data = file.View();
+
+    if (data.size() < sizeof(ASTFileHeader)) return false;
+    ASTFileHeader header;
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kASTFileVersion || header.byteOrder != kByteOrder ||
+        header.sourceSize != source.size() || header.sourceHash != HashSource(source) ||
+        header.nodeCount == 0) {
+        return false;
+    }
+    if (!Fits<ASTNode>(data, header.nodesOffset, header.nodeCount) ||
+        !Fits<int>(data, header.edgesOffset, header.edgeCount) ||
+        !Fits<uint32_t>(data, header.startsOffset, uint64_t(header.symbolCount) + 1) ||
+        !Fits<char>(data, header.blobOffset, header.blobSize)) {
+        return false;
+    }
+
+    // Every index the processor will follow has to stay in bounds.
+    const ASTNode* nodes = At<ASTNode>(data, header.nodesOffset);
+    const int* edges = At<int>(data, header.edgesOffset);
+    const uint32_t* starts = At<uint32_t>(data, header.startsOffset);
+    for (uint32_t i = 0; i < header.nodeCount; i++) {
+        const ASTNode& node = nodes[i];
+        if (uint64_t(node.firstChild) + node.childCount > header.edgeCount) return false;
+        if (node.name != Interner::kNone && node.name >= header.symbolCount) return false;
+    }
+    for (uint32_t i = 0; i < header.edgeCount; i++) {
+        if (edges[i] < 0 || uint32_t(edges[i]) >= header.nodeCount) return false;
+    }
+    if (starts[0] != 0 || starts[header.symbolCount] != header.blobSize) return false;
+    for (uint32_t i = 0; i < header.symbolCount; i++) {
+        if (starts[i] > starts[i + 1]) return false;
+    }
+
+    tree = ASTView(nodes, header.nodeCount, edges, header.edgeCount);
+    names = NameTable(starts, At<char>(data, header.blobOffset), header.symbolCount);
+    return true;
+}
+
+ParseCache::ParseCache(std::string directory) : directory(std::move(directory)) {
+    if (mkdir(this->directory.c_str(), 0777) != 0 && errno != EEXIST) {
+        std::perror(("parse cache: " + this->directory).c_str());
+    }
+}
+
+std::string ParseCache::PathFor(std::string_view source) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.fppast",
+                  static_cast<unsigned long long>(HashSource(source)));
+    return directory + "/" + name;
+}
+
+bool ParseCache::Load(std::string_view source, MappedAST& out) const {
+    return out.Open(PathFor(source), source);
+}
+
+bool ParseCache::Store(std::string_view source, ASTView tree, NameTable names) const {
+    return WriteASTFile(PathFor(source), source, tree, names);
+}
@@ -0,0 +1,84 @@
+// ast_file.h
+
+#ifndef AST_FILE_H
+#define AST_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "ast.h"
+#include "../source/source.h"
+#include "../token/interner.h"
+
+// Binary AST file: a finished tree and its name table, laid out so a mapping
+// of the file is used in place. Nodes, edges and name offsets are arrays of
+// plain integers indexed from their section start, and sections are found
+// by offsets from the start of the file, so the data works wherever it is
+// mapped. Byte order is the writer's; a reader with another order (or
+// another version) treats the file as missing.
+//
+//   header | nodes (ASTNode[nodeCount]) | edges (int32[edgeCount])
+//          | name starts (uint32[symbolCount + 1]) | name blob
+//
+// The header carries the hash and size of the source it was parsed from.
+// Only trees that parsed without errors are written.
+
+constexpr uint32_t kASTFileVersion = 2;
+
+struct ASTFileHeader {
+    char magic[8];          // "FPPAST\0\0"
+    uint32_t version;
+    uint32_t byteOrder;     // 0x01020304 in the writer's order
+    uint64_t sourceHash;
+    uint64_t sourceSize;
+    uint32_t nodeCount;
+    uint32_t edgeCount;
+    uint32_t symbolCount;
+    uint32_t blobSize;
+    uint64_t nodesOffset;
+    uint64_t edgesOffset;
+    uint64_t startsOffset;
+    uint64_t blobOffset;
+};
+
+// 64-bit hash of source text, the parse cache key.
+uint64_t HashSource(std::string_view source);
+
+// Writes the file through a temporary and a rename, so readers never see a
+// partial one. Returns false on any I/O error.
+bool WriteASTFile(const std::string& path, std::string_view source, ASTView tree,
+                  NameTable names);
+
+// A mapped AST file, checked and then used without copying.
+class MappedAST {
+public:
+    // False if the file is missing, malformed, from another version or not
+    // parsed from source.
+    bool Open(const std::string& path, std::string_view source);
+
+    ASTView Tree() const { return tree; }
+    NameTable Names() const { return names; }
+
+private:
+    SourceBuffer file;
+    ASTView tree;
+    NameTable names;
+};
+
+// Directory of AST files named by source hash. Retranslating an unchanged
+// program maps its tree instead of lexing and parsing it again.
+class ParseCache {
+public:
+    // The directory is created if it doesn't exist.
+    explicit ParseCache(std::string directory);
+
+    bool Load(std::string_view source, MappedAST& out) const;
+    bool Store(std::string_view source, ASTView tree, NameTable names) const;
+
+private:
+    std::string PathFor(std::string_view source) const;
+
+    std::string directory;
+};
+
+#endif // AST_FILE_H
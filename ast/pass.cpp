@@ -0,0 +1,12 @@
+// pass.cpp
+
+#include "pass.h"
+
+bool PassManager::Run(AST& tree, Interner& symbols) {
+    bool changed = false;
+    if (tree.empty()) return changed;
+    for (const std::unique_ptr<Pass>& pass : passes) {
+        changed |= pass->Run(tree, symbols);
+    }
+    return changed;
+}
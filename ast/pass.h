@@ -0,0 +1,37 @@
+// pass.h
+
+#ifndef PASS_H
+#define PASS_H
+
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "ast.h"
+
+// A transformation of a finished tree that runs between parsing and
+// emission. A pass may rewrite nodes in place, shrink child ranges and
+// intern new symbols; it must leave a finished tree behind. Passes usually
+// walk the tree with an ASTVisitor (visitor.h).
+class Pass {
+public:
+    virtual ~Pass() = default;
+    virtual std::string_view Name() const = 0;
+    // Returns whether the tree changed.
+    virtual bool Run(AST& tree, Interner& symbols) = 0;
+};
+
+// Runs passes in the order they were added.
+class PassManager {
+public:
+    void Add(std::unique_ptr<Pass> pass) { passes.push_back(std::move(pass)); }
+    bool empty() const { return passes.empty(); }
+    size_t size() const { return passes.size(); }
+
+    // Returns whether any pass changed the tree.
+    bool Run(AST& tree, Interner& symbols);
+
+private:
+    std::vector<std::unique_ptr<Pass>> passes;
+};
+
+#endif // PASS_H
@@ -0,0 +1,91 @@
+// visitor.h
+
+#ifndef VISITOR_H
+#define VISITOR_H
+
+#include "ast.h"
+
+// Dispatch on a node's kind for anything that walks the tree. visit() is a
+// switch over the dense NodeKind values, which compiles to one jump table,
+// and calls the derived class's handler for the kind directly (CRTP, no
+// virtual calls). A derived class defines the visitX() handlers it cares
+// about; the rest fall through to a group handler (visitLiteral,
+// visitList) and then to visitNode, which does nothing unless overridden.
+//
+//   class Counter : public ASTVisitor<Counter> {
+//   public:
+//       int calls = 0;
+//       void visitFunctionCall(int) { calls++; }
+//   };
+template <typename Derived, typename Result = void>
+class ASTVisitor {
+public:
+    Result visit(NodeKind kind, int node) {
+        Derived& self = static_cast<Derived&>(*this);
+        switch (kind) {
+            case NodeKind::None: return self.visitNode(node);
+            case NodeKind::Program: return self.visitProgram(node);
+            case NodeKind::Function: return self.visitFunction(node);
+            case NodeKind::Params: return self.visitParams(node);
+            case NodeKind::Block: return self.visitBlock(node);
+            case NodeKind::Declaration: return self.visitDeclaration(node);
+            case NodeKind::Identifier: return self.visitIdentifier(node);
+            case NodeKind::FunctionCall: return self.visitFunctionCall(node);
+            case NodeKind::Arguments: return self.visitArguments(node);
+            case NodeKind::For: return self.visitFor(node);
+            case NodeKind::Forn: return self.visitForn(node);
+            case NodeKind::While: return self.visitWhile(node);
+            case NodeKind::If: return self.visitIf(node);
+            case NodeKind::Return: return self.visitReturn(node);
+            case NodeKind::Cout: return self.visitCout(node);
+            case NodeKind::Cin: return self.visitCin(node);
+            case NodeKind::Empty: return self.visitEmpty(node);
+            case NodeKind::BinaryOperator: return self.visitBinaryOperator(node);
+            case NodeKind::UnaryOperator: return self.visitUnaryOperator(node);
+            case NodeKind::PostfixOperator: return self.visitPostfixOperator(node);
+            case NodeKind::IntLiteral: return self.visitIntLiteral(node);
+            case NodeKind::FloatLiteral: return self.visitFloatLiteral(node);
+            case NodeKind::StringLiteral: return self.visitStringLiteral(node);
+            case NodeKind::CharLiteral: return self.visitCharLiteral(node);
+            case NodeKind::BooleanLiteral: return self.visitBooleanLiteral(node);
+        }
+        return self.visitNode(node);
+    }
+
+    Result visitNode(int) { return Result(); }
+
+    Result visitProgram(int node) { return self().visitNode(node); }
+    Result visitFunction(int node) { return self().visitNode(node); }
+    Result visitDeclaration(int node) { return self().visitNode(node); }
+    Result visitIdentifier(int node) { return self().visitNode(node); }
+    Result visitFunctionCall(int node) { return self().visitNode(node); }
+    Result visitFor(int node) { return self().visitNode(node); }
+    Result visitForn(int node) { return self().visitNode(node); }
+    Result visitWhile(int node) { return self().visitNode(node); }
+    Result visitIf(int node) { return self().visitNode(node); }
+    Result visitReturn(int node) { return self().visitNode(node); }
+    Result visitCout(int node) { return self().visitNode(node); }
+    Result visitCin(int node) { return self().visitNode(node); }
+    Result visitEmpty(int node) { return self().visitNode(node); }
+    Result visitBinaryOperator(int node) { return self().visitNode(node); }
+    Result visitUnaryOperator(int node) { return self().visitNode(node); }
+    Result visitPostfixOperator(int node) { return self().visitNode(node); }
+
+    // Params, Block, Arguments
+    Result visitList(int node) { return self().visitNode(node); }
+    Result visitParams(int node) { return self().visitList(node); }
+    Result visitBlock(int node) { return self().visitList(node); }
+    Result visitArguments(int node) { return self().visitList(node); }
+
+    Result visitLiteral(int node) { return self().visitNode(node); }
+    Result visitIntLiteral(int node) { return self().visitLiteral(node); }
+    Result visitFloatLiteral(int node) { return self().visitLiteral(node); }
+    Result visitStringLiteral(int node) { return self().visitLiteral(node); }
+    Result visitCharLiteral(int node) { return self().visitLiteral(node); }
+    Result visitBooleanLiteral(int node) { return self().visitLiteral(node); }
+
+private:
+    Derived& self() { return static_cast<Derived&>(*this); }
+};
+
+#endif // VISITOR_H
@@ -0,0 +1,37 @@
+// dfa_lexer.cpp
+
+#include "dfa_lexer.h"
+#include "dfa_tables.h"
+#include "lexer.h"
+
+DfaLexer::DfaLexer(std::string_view input) : cur(input.data()) {}
+
+Token DfaLexer::NextToken() {
+    const char* p = cur;
+    while (dfa::IsSpace(*p)) {
+        p++;
+    }
+
+    const char* start = p;
+    uint8_t state = dfa::kNext[dfa::S_START][dfa::ClassOf(*p)];
+    if (state == dfa::S_REJECT) {
+        // only the NUL sentinel is rejected straight from q0
+        cur = p;
+        return Token(TokenType::EOF_TOKEN, "");
+    }
+
+    // Longest match: every live state accepts, so stop at the first reject.
+    for (;;) {
+        uint8_t next = dfa::kNext[state][dfa::ClassOf(*++p)];
+        if (next == dfa::S_REJECT) break;
+        state = next;
+    }
+    cur = p;
+
+    std::string_view literal(start, p - start);
+    TokenType type = dfa::kAccept[state];
+    if (type == TokenType::IDENT) {
+        type = LookupIdent(literal);
+    }
+    return Token(type, literal);
+}
@@ -0,0 +1,21 @@
+#ifndef DFA_LEXER_H
+#define DFA_LEXER_H
+
+#include <string_view>
+#include "../token/token.h"
+
+// Table-driven lexer over the automaton in dfa_tables.h. Produces exactly the
+// same tokens as Lexer and can stand in for it anywhere.
+//
+// The input must be followed by a NUL byte (std::string and SourceBuffer both
+// guarantee this); the NUL is the only end-of-input check the scanner does.
+class DfaLexer {
+private:
+    const char* cur; // next unread byte
+
+public:
+    DfaLexer(std::string_view input);
+    Token NextToken();
+};
+
+#endif // DFA_LEXER_H
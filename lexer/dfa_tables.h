@@ -0,0 +1,273 @@
+// dfa_tables.h
+//
+// Compile-time tables for the lexing automaton drawn in DFA/dfa.gv.
+//
+// Bytes are first folded into a small set of character classes, then the
+// transition table maps (state, class) to the next state. Every state except
+// START and REJECT accepts, and no token needs backtracking, so the longest
+// match is simply "step until the next class would reject".
+//
+// NUL maps to its own class that rejects from every state. Running over a
+// buffer that is followed by a NUL byte therefore needs no bounds checks.
+
+#ifndef DFA_TABLES_H
+#define DFA_TABLES_H
+
+#include <array>
+#include <cstdint>
+#include "../token/token.h"
+
+namespace dfa {
+
+enum CharClass : uint8_t {
+    C_NUL,      // end of input sentinel
+    C_SPACE,    // ' ' \t \v \f \r
+    C_NEWLINE,  // whitespace too, but it also ends an unterminated literal
+    C_LETTER,   // a-z A-Z _
+    C_DIGIT,    // 0-9
+    C_DOT,
+    C_EQUAL,
+    C_PLUS,
+    C_MINUS,
+    C_BANG,
+    C_SLASH,
+    C_STAR,
+    C_LESS,
+    C_GREATER,
+    C_AMP,
+    C_PIPE,
+    C_SEMICOLON,
+    C_COMMA,
+    C_COLON,
+    C_LPAREN,
+    C_RPAREN,
+    C_LBRACE,
+    C_RBRACE,
+    C_LBRACKET,
+    C_RBRACKET,
+    C_DQUOTE,
+    C_SQUOTE,
+    C_BACKSLASH,
+    C_OTHER,
+    NUM_CLASSES
+};
+
+// State names follow DFA/dfa.gv where there is a counterpart: START is q0,
+// IDENT covers q65..q69, INT covers q3..q5, and the operator/delimiter
+// states split q1/q2 by the token they accept.
+enum State : uint8_t {
+    S_REJECT,
+    S_START,
+    S_IDENT,
+    S_INT,
+    S_FLOAT,
+    S_ASSIGN,
+    S_EQ,
+    S_PLUS,
+    S_PLUSPLUS,
+    S_MINUS,
+    S_MINUSMINUS,
+    S_BANG,
+    S_NOT_EQ,
+    S_SLASH,
+    S_ASTERISK,
+    S_LT,
+    S_LTE,
+    S_GT,
+    S_GTE,
+    S_AMP,      // lone '&' is ILLEGAL
+    S_AND,
+    S_PIPE,     // lone '|' is ILLEGAL
+    S_OR,
+    S_SEMICOLON,
+    S_COMMA,
+    S_COLON,
+    S_LPAREN,
+    S_RPAREN,
+    S_LBRACE,
+    S_RBRACE,
+    S_LBRACKET,
+    S_RBRACKET,
+    S_STRING,       // inside "..." (unterminated so far: ILLEGAL)
+    S_STRING_ESC,   // just after a backslash inside "..."
+    S_STRING_END,
+    S_CHAR,         // inside '...'
+    S_CHAR_ESC,
+    S_CHAR_END,
+    S_ILLEGAL,
+    NUM_STATES
+};
+
+using ClassTable = std::array<uint8_t, 256>;
+using TransitionTable = std::array<std::array<uint8_t, NUM_CLASSES>, NUM_STATES>;
+using AcceptTable = std::array<TokenType, NUM_STATES>;
+
+constexpr ClassTable MakeClassTable() {
+    ClassTable t{};
+    for (int c = 0; c < 256; c++) t[c] = C_OTHER;
+    t[0] = C_NUL;
+    t[' '] = t['\t'] = t['\v'] = t['\f'] = t['\r'] = C_SPACE;
+    t['\n'] = C_NEWLINE;
+    for (int c = 'a'; c <= 'z'; c++) t[c] = C_LETTER;
+    for (int c = 'A'; c <= 'Z'; c++) t[c] = C_LETTER;
+    t['_'] = C_LETTER;
+    for (int c = '0'; c <= '9'; c++) t[c] = C_DIGIT;
+    t['.'] = C_DOT;
+    t['='] = C_EQUAL;
+    t['+'] = C_PLUS;
+    t['-'] = C_MINUS;
+    t['!'] = C_BANG;
+    t['/'] = C_SLASH;
+    t['*'] = C_STAR;
+    t['<'] = C_LESS;
+    t['>'] = C_GREATER;
+    t['&'] = C_AMP;
+    t['|'] = C_PIPE;
+    t[';'] = C_SEMICOLON;
+    t[','] = C_COMMA;
+    t[':'] = C_COLON;
+    t['('] = C_LPAREN;
+    t[')'] = C_RPAREN;
+    t['{'] = C_LBRACE;
+    t['}'] = C_RBRACE;
+    t['['] = C_LBRACKET;
+    t[']'] = C_RBRACKET;
+    t['"'] = C_DQUOTE;
+    t['\''] = C_SQUOTE;
+    t['\\'] = C_BACKSLASH;
+    return t;
+}
+
+constexpr TransitionTable MakeTransitionTable() {
+    TransitionTable t{};  // everything rejects unless listed below
+
+    // q0: whitespace loops, everything else picks the token kind
+    t[S_START][C_SPACE] = S_START;
+    t[S_START][C_NEWLINE] = S_START;
+    t[S_START][C_LETTER] = S_IDENT;
+    t[S_START][C_DIGIT] = S_INT;
+    t[S_START][C_DOT] = S_ILLEGAL;
+    t[S_START][C_EQUAL] = S_ASSIGN;
+    t[S_START][C_PLUS] = S_PLUS;
+    t[S_START][C_MINUS] = S_MINUS;
+    t[S_START][C_BANG] = S_BANG;
+    t[S_START][C_SLASH] = S_SLASH;
+    t[S_START][C_STAR] = S_ASTERISK;
+    t[S_START][C_LESS] = S_LT;
+    t[S_START][C_GREATER] = S_GT;
+    t[S_START][C_AMP] = S_AMP;
+    t[S_START][C_PIPE] = S_PIPE;
+    t[S_START][C_SEMICOLON] = S_SEMICOLON;
+    t[S_START][C_COMMA] = S_COMMA;
+    t[S_START][C_COLON] = S_COLON;
+    t[S_START][C_LPAREN] = S_LPAREN;
+    t[S_START][C_RPAREN] = S_RPAREN;
+    t[S_START][C_LBRACE] = S_LBRACE;
+    t[S_START][C_RBRACE] = S_RBRACE;
+    t[S_START][C_LBRACKET] = S_LBRACKET;
+    t[S_START][C_RBRACKET] = S_RBRACKET;
+    t[S_START][C_DQUOTE] = S_STRING;
+    t[S_START][C_SQUOTE] = S_CHAR;
+    t[S_START][C_BACKSLASH] = S_ILLEGAL;
+    t[S_START][C_OTHER] = S_ILLEGAL;
+
+    // identifiers: [a-zA-Z_][a-zA-Z0-9_]*
+    t[S_IDENT][C_LETTER] = S_IDENT;
+    t[S_IDENT][C_DIGIT] = S_IDENT;
+
+    // numbers: [0-9]+ ( "." [0-9]* )?
+    t[S_INT][C_DIGIT] = S_INT;
+    t[S_INT][C_DOT] = S_FLOAT;
+    t[S_FLOAT][C_DIGIT] = S_FLOAT;
+
+    // two-character operators
+    t[S_ASSIGN][C_EQUAL] = S_EQ;
+    t[S_PLUS][C_PLUS] = S_PLUSPLUS;
+    t[S_MINUS][C_MINUS] = S_MINUSMINUS;
+    t[S_BANG][C_EQUAL] = S_NOT_EQ;
+    t[S_LT][C_EQUAL] = S_LTE;
+    t[S_GT][C_EQUAL] = S_GTE;
+    t[S_AMP][C_AMP] = S_AND;
+    t[S_PIPE][C_PIPE] = S_OR;
+
+    // string and char literals: anything but the closing quote, with
+    // backslash escapes; a newline or NUL before the quote leaves the
+    // literal unterminated
+    for (int c = 0; c < NUM_CLASSES; c++) {
+        if (c == C_NUL || c == C_NEWLINE) continue;
+        t[S_STRING][c] = S_STRING;
+        t[S_STRING_ESC][c] = S_STRING;
+        t[S_CHAR][c] = S_CHAR;
+        t[S_CHAR_ESC][c] = S_CHAR;
+    }
+    t[S_STRING][C_DQUOTE] = S_STRING_END;
+    t[S_STRING][C_BACKSLASH] = S_STRING_ESC;
+    t[S_CHAR][C_SQUOTE] = S_CHAR_END;
+    t[S_CHAR][C_BACKSLASH] = S_CHAR_ESC;
+
+    return t;
+}
+
+constexpr AcceptTable MakeAcceptTable() {
+    AcceptTable t{};
+    for (int s = 0; s < NUM_STATES; s++) t[s] = TokenType::ILLEGAL;
+    t[S_START] = TokenType::EOF_TOKEN;
+    t[S_IDENT] = TokenType::IDENT;
+    t[S_INT] = TokenType::INT_LITERAL;
+    t[S_FLOAT] = TokenType::FLOAT_LITERAL;
+    t[S_ASSIGN] = TokenType::ASSIGN;
+    t[S_EQ] = TokenType::EQ;
+    t[S_PLUS] = TokenType::PLUS;
+    t[S_PLUSPLUS] = TokenType::PLUSPLUS;
+    t[S_MINUS] = TokenType::MINUS;
+    t[S_MINUSMINUS] = TokenType::MINUSMINUS;
+    t[S_BANG] = TokenType::BANG;
+    t[S_NOT_EQ] = TokenType::NOT_EQ;
+    t[S_SLASH] = TokenType::SLASH;
+    t[S_ASTERISK] = TokenType::ASTERISK;
+    t[S_LT] = TokenType::LT;
+    t[S_LTE] = TokenType::LTE;
+    t[S_GT] = TokenType::GT;
+    t[S_GTE] = TokenType::GTE;
+    t[S_AND] = TokenType::AND;
+    t[S_OR] = TokenType::OR;
+    t[S_SEMICOLON] = TokenType::SEMICOLON;
+    t[S_COMMA] = TokenType::COMMA;
+    t[S_COLON] = TokenType::COLON;
+    t[S_LPAREN] = TokenType::LPAREN;
+    t[S_RPAREN] = TokenType::RPAREN;
+    t[S_LBRACE] = TokenType::LBRACE;
+    t[S_RBRACE] = TokenType::RBRACE;
+    t[S_LBRACKET] = TokenType::LBRACKET;
+    t[S_RBRACKET] = TokenType::RBRACKET;
+    t[S_STRING_END] = TokenType::STRING_LITERAL;
+    t[S_CHAR_END] = TokenType::CHAR_LITERAL;
+    return t;
+}
+
+inline constexpr ClassTable kClass = MakeClassTable();
+inline constexpr TransitionTable kNext = MakeTransitionTable();
+inline constexpr AcceptTable kAccept = MakeAcceptTable();
+
+// No transition may leave the automaton on the NUL sentinel, otherwise the
+// unchecked scanners could run off the end of the buffer.
+constexpr bool RejectsOnNul() {
+    for (int s = 0; s < NUM_STATES; s++) {
+        if (kNext[s][C_NUL] != S_REJECT) return false;
+    }
+    return true;
+}
+static_assert(RejectsOnNul(), "the NUL sentinel must end every token");
+
+inline uint8_t ClassOf(char c) {
+    return kClass[static_cast<unsigned char>(c)];
+}
+
+inline bool IsSpace(char c) {
+    uint8_t cls = ClassOf(c);
+    return cls == C_SPACE || cls == C_NEWLINE;
+}
+
+}  // namespace dfa
+
+#endif // DFA_TABLES_H
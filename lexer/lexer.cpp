@@ -1,11 +1,20 @@
 // lexer.cpp
 
 #include "lexer.h"
-#include <cctype>
-#include <unordered_map>
+#include "scan.h"
+#include <array>
 
-// Define keywords map
-std::unordered_map<std::string, TokenType> keywords = {
+// Keywords are recognized with a perfect hash over (length, first byte,
+// last byte). The table is built and checked for collisions at compile time,
+// so a lookup is one hash, one load and at most one short compare.
+namespace {
+
+struct Keyword {
+    std::string_view text;
+    TokenType type;
+};
+
+constexpr Keyword kKeywords[] = {
     {"int", TokenType::INT},
     {"float", TokenType::FLOAT},
     {"char", TokenType::CHAR},
@@ -15,33 +24,66 @@ std::unordered_map<std::string, TokenType> keywords = {
     {"void", TokenType::VOID},
     {"forn", TokenType::FORN},
     {"for", TokenType::FOR},
-    {"forn", TokenType::FOR},
     {"while", TokenType::WHILE},
     {"cout", TokenType::COUT},
+    {"cin", TokenType::CIN},
     {"if", TokenType::IF},
     {"else", TokenType::ELSE},
     {"return", TokenType::RETURN},
     {"true", TokenType::TRUE},
     {"false", TokenType::FALSE},
-    // Add other keywords as necessary
+    // Add other keywords as necessary (the static_assert below will catch
+    // a collision; retune KeywordHash if it fires)
 };
 
+constexpr size_t kKeywordSlots = 32;
+constexpr size_t kMinKeywordLength = 2;
+constexpr size_t kMaxKeywordLength = 7;
+
+constexpr size_t KeywordHash(std::string_view s) {
+    return (s.size() + (unsigned char)s.front() + 12 * (unsigned char)s.back()) % kKeywordSlots;
+}
+
+constexpr std::array<Keyword, kKeywordSlots> MakeKeywordTable() {
+    std::array<Keyword, kKeywordSlots> table{};
+    for (const Keyword& k : kKeywords) {
+        table[KeywordHash(k.text)] = k;
+    }
+    return table;
+}
+
+constexpr std::array<Keyword, kKeywordSlots> kKeywordTable = MakeKeywordTable();
+
+constexpr bool KeywordHashIsPerfect() {
+    for (const Keyword& k : kKeywords) {
+        if (k.text.size() < kMinKeywordLength || k.text.size() > kMaxKeywordLength) return false;
+        if (kKeywordTable[KeywordHash(k.text)].text != k.text) return false;
+    }
+    return true;
+}
+static_assert(KeywordHashIsPerfect(), "keyword hash has a collision");
+
+}  // namespace
+
 // Function to lookup identifiers and keywords
-TokenType LookupIdent(const std::string& ident) {
-    auto it = keywords.find(ident);
-    if (it != keywords.end()) {
-        return it->second;
+TokenType LookupIdent(std::string_view ident) {
+    if (ident.size() < kMinKeywordLength || ident.size() > kMaxKeywordLength) {
+        return TokenType::IDENT;
+    }
+    const Keyword& k = kKeywordTable[KeywordHash(ident)];
+    if (k.text == ident) {
+        return k.type;
     }
     return TokenType::IDENT;
 }
 
-Lexer::Lexer(const std::string& input)
+Lexer::Lexer(std::string_view input)
     : input(input), position(0), readPosition(0), ch(0) {
     ReadChar();
 }
 
 void Lexer::ReadChar() {
-    if (readPosition >= (int)input.size()) {
+    if (readPosition >= input.size()) {
         ch = 0;
     } else {
         ch = input[readPosition];
@@ -51,50 +93,96 @@ void Lexer::ReadChar() {
 }
 
 char Lexer::PeekChar() {
-    if (readPosition >= (int)input.size()) {
+    if (readPosition >= input.size()) {
         return 0;
     } else {
         return input[readPosition];
     }
 }
 
+// Moves straight to newPosition, as if ReadChar had been called up to it.
+void Lexer::SkipTo(size_t newPosition) {
+    readPosition = newPosition;
+    ReadChar();
+}
+
+const char* Lexer::Cursor() const {
+    return input.data() + position;
+}
+
+const char* Lexer::End() const {
+    return input.data() + input.size();
+}
+
 void Lexer::SkipWhitespace() {
-    while (std::isspace(ch)) {
-        ReadChar();
-    }
+    if (!scan::IsSpace(ch)) return;
+    SkipTo(position + scan::WhitespaceRun(Cursor(), End()));
 }
 
 bool Lexer::IsLetter(char ch) {
-    return std::isalpha(ch) || ch == '_';
+    return scan::IsIdentStart(ch);
 }
 
 bool Lexer::IsDigit(char ch) {
-    return std::isdigit(ch);
+    return scan::IsDigit(ch);
 }
 
-std::string Lexer::ReadIdentifier() {
+std::string_view Lexer::ReadIdentifier() {
     size_t startPosition = position;
-    while (IsLetter(ch) || IsDigit(ch)) {
-        ReadChar();
-    }
+    SkipTo(position + scan::IdentifierRun(Cursor(), End()));
     return input.substr(startPosition, position - startPosition);
 }
 
-std::string Lexer::ReadNumber() {
+std::string_view Lexer::ReadNumber() {
     size_t startPosition = position;
-    while (IsDigit(ch)) {
-        ReadChar();
-    }
+    SkipTo(position + scan::DigitRun(Cursor(), End()));
     if (ch == '.') {
         ReadChar(); // Consume '.'
-        while (IsDigit(ch)) {
-            ReadChar();
-        }
+        SkipTo(position + scan::DigitRun(Cursor(), End()));
     }
     return input.substr(startPosition, position - startPosition);
 }
 
-Token Lexer::NewToken(TokenType type, const std::string& literal) {
+TokenBuffer Lexer::Tokenize(Arena* arena) {
+    TokenBuffer tokens(input, arena);
+    // typical programs run at three to five bytes per token
+    tokens.Reserve(input.size() / 4 + 1);
+    Token tok = NextToken();
+    while (tok.type != TokenType::EOF_TOKEN) {
+        tokens.Push(tok.type, tok.literal);
+        tok = NextToken();
+    }
+    tokens.Push(tok.type, tok.literal);
+    return tokens;
+}
+
+// Reads a string or char literal starting at its opening quote. The token
+// keeps the raw slice, quotes and escapes included; DecodeLiteral turns it
+// into its value only when someone needs it. A literal can't run past the
+// end of its line, so without a closing quote the slice up to the newline
+// comes back as ILLEGAL.
+Token Lexer::ReadQuoted(TokenType type) {
+    char quote = ch;
+    int start = position;
+    int pos = position + 1;
+    int size = input.size();
+    for (;;) {
+        pos += scan::QuotedRun(input.data() + pos, End(), quote);
+        if (pos >= size) break;
+        if (input[pos] == quote) {
+            SkipTo(pos + 1);
+            return Token(type, input.substr(start, pos + 1 - start));
+        }
+        if (input[pos] != '\\') break;  // newline or NUL
+        pos++;  // the backslash
+        if (pos >= size || input[pos] == '\n' || input[pos] == '\0') break;
+        pos++;  // the escaped byte
+    }
+    SkipTo(pos);
+    return Token(TokenType::ILLEGAL, input.substr(start, pos - start));
+}
+
+Token Lexer::NewToken(TokenType type, std::string_view literal) {
     return Token(type, literal);
 }
 
@@ -106,137 +194,125 @@ Token Lexer::NextToken() {
     switch (ch) {
         case '=':
             if (PeekChar() == '=') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::EQ, literal);
+                tok = NewToken(TokenType::EQ, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::ASSIGN, std::string(1, ch));
+                tok = NewToken(TokenType::ASSIGN, input.substr(position, 1));
             }
             break;
         case '+':
             if (PeekChar() == '+') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::PLUSPLUS, literal);
+                tok = NewToken(TokenType::PLUSPLUS, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::PLUS, std::string(1, ch));
+                tok = NewToken(TokenType::PLUS, input.substr(position, 1));
             }
             break;
         case '-':
             if (PeekChar() == '-') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::MINUSMINUS, literal);
+                tok = NewToken(TokenType::MINUSMINUS, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::MINUS, std::string(1, ch));
+                tok = NewToken(TokenType::MINUS, input.substr(position, 1));
             }
             break;
         case '!':
             if (PeekChar() == '=') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::NOT_EQ, literal);
+                tok = NewToken(TokenType::NOT_EQ, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::BANG, std::string(1, ch));
+                tok = NewToken(TokenType::BANG, input.substr(position, 1));
             }
             break;
         case '/':
-            tok = NewToken(TokenType::SLASH, std::string(1, ch));
+            tok = NewToken(TokenType::SLASH, input.substr(position, 1));
             break;
         case '*':
-            tok = NewToken(TokenType::ASTERISK, std::string(1, ch));
+            tok = NewToken(TokenType::ASTERISK, input.substr(position, 1));
             break;
         case '<':
             if (PeekChar() == '=') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::LTE, literal);
+                tok = NewToken(TokenType::LTE, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::LT, std::string(1, ch));
+                tok = NewToken(TokenType::LT, input.substr(position, 1));
             }
             break;
         case '>':
             if (PeekChar() == '=') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::GTE, literal);
+                tok = NewToken(TokenType::GTE, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::GT, std::string(1, ch));
+                tok = NewToken(TokenType::GT, input.substr(position, 1));
             }
             break;
         case '&':
             if (PeekChar() == '&') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::AND, literal);
+                tok = NewToken(TokenType::AND, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::ILLEGAL, std::string(1, ch));
+                tok = NewToken(TokenType::ILLEGAL, input.substr(position, 1));
             }
             break;
         case '|':
             if (PeekChar() == '|') {
-                char currentCh = ch;
                 ReadChar();
-                std::string literal = std::string(1, currentCh) + ch;
-                tok = NewToken(TokenType::OR, literal);
+                tok = NewToken(TokenType::OR, input.substr(position - 1, 2));
             } else {
-                tok = NewToken(TokenType::ILLEGAL, std::string(1, ch));
+                tok = NewToken(TokenType::ILLEGAL, input.substr(position, 1));
             }
             break;
         case ';':
-            tok = NewToken(TokenType::SEMICOLON, std::string(1, ch));
+            tok = NewToken(TokenType::SEMICOLON, input.substr(position, 1));
             break;
         case ',':
-            tok = NewToken(TokenType::COMMA, std::string(1, ch));
+            tok = NewToken(TokenType::COMMA, input.substr(position, 1));
             break;
         case ':':
-            tok = NewToken(TokenType::COLON, std::string(1, ch));
+            tok = NewToken(TokenType::COLON, input.substr(position, 1));
             break;
         case '(':
-            tok = NewToken(TokenType::LPAREN, std::string(1, ch));
+            tok = NewToken(TokenType::LPAREN, input.substr(position, 1));
             break;
         case ')':
-            tok = NewToken(TokenType::RPAREN, std::string(1, ch));
+            tok = NewToken(TokenType::RPAREN, input.substr(position, 1));
             break;
         case '{':
-            tok = NewToken(TokenType::LBRACE, std::string(1, ch));
+            tok = NewToken(TokenType::LBRACE, input.substr(position, 1));
             break;
         case '}':
-            tok = NewToken(TokenType::RBRACE, std::string(1, ch));
+            tok = NewToken(TokenType::RBRACE, input.substr(position, 1));
             break;
         case '[':
-            tok = NewToken(TokenType::LBRACKET, std::string(1, ch));
+            tok = NewToken(TokenType::LBRACKET, input.substr(position, 1));
             break;
         case ']':
-            tok = NewToken(TokenType::RBRACKET, std::string(1, ch));
+            tok = NewToken(TokenType::RBRACKET, input.substr(position, 1));
             break;
+        case '"':
+            return ReadQuoted(TokenType::STRING_LITERAL);
+        case '\'':
+            return ReadQuoted(TokenType::CHAR_LITERAL);
         case 0:
             tok.type = TokenType::EOF_TOKEN;
             tok.literal = "";
             break;
         default:
             if (IsLetter(ch)) {
-                std::string ident = ReadIdentifier();
+                std::string_view ident = ReadIdentifier();
                 TokenType type = LookupIdent(ident);
                 tok = Token(type, ident);
                 return tok;  // Early return
             } else if (IsDigit(ch)) {
-                std::string number = ReadNumber();
-                if (number.find('.') != std::string::npos) {
+                std::string_view number = ReadNumber();
+                if (number.find('.') != std::string_view::npos) {
                     tok = Token(TokenType::FLOAT_LITERAL, number);
                 } else {
                     tok = Token(TokenType::INT_LITERAL, number);
                 }
                 return tok;  // Early return
             } else {
-                tok = NewToken(TokenType::ILLEGAL, std::string(1, ch));
+                tok = NewToken(TokenType::ILLEGAL, input.substr(position, 1));
             }
             break;
     }
@@ -2,28 +2,42 @@
 #define LEXER_H
 
 #include <string>
+#include <string_view>
 #include "../token/token.h" 
+#include "../token/token_buffer.h"
+
+// Maps an identifier to its keyword token type, or IDENT.
+TokenType LookupIdent(std::string_view ident);
 
 class Lexer {
 private:
-    std::string input;
-    int position;     // current position in input (points to current char)
-    int readPosition; // current reading position in input (after current char)
-    char ch;          // current char under examination
+    std::string_view input; // not owned, see Lexer(std::string_view)
+    size_t position;     // current position in input (points to current char)
+    size_t readPosition; // current reading position in input (after current char)
+    char ch;             // current char under examination
 
     void ReadChar();
     char PeekChar();
-    std::string ReadIdentifier();
-    std::string ReadNumber();
+    void SkipTo(size_t newPosition);
+    const char* Cursor() const;
+    const char* End() const;
+    std::string_view ReadIdentifier();
+    std::string_view ReadNumber();
+    Token ReadQuoted(TokenType type);
     void SkipWhitespace();
     bool IsLetter(char ch);
     bool IsDigit(char ch);
 
 public:
-    Lexer(const std::string& input);
+    // The lexer does not copy its input; every token it returns points into
+    // it, so the caller keeps the text alive (see SourceBuffer).
+    Lexer(std::string_view input);
     Token NextToken();
+    // Lexes the rest of the input, EOF token included. The buffer is
+    // allocated from arena when one is given.
+    TokenBuffer Tokenize(Arena* arena = nullptr);
 
-    Token NewToken(TokenType type, const std::string& literal);
+    Token NewToken(TokenType type, std::string_view literal);
 };
 
 #endif // LEXER_H
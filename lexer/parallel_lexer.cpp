@@ -0,0 +1,89 @@
+// parallel_lexer.cpp
+
+#include "parallel_lexer.h"
+#include "lexer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+std::vector<size_t> FindChunkBoundaries(std::string_view source, size_t chunks) {
+    std::vector<size_t> boundaries = {0};
+    if (chunks == 0) chunks = 1;
+    size_t step = source.size() / chunks;
+    for (size_t i = 1; i < chunks; i++) {
+        size_t from = std::max(boundaries.back(), i * step);
+        if (from >= source.size()) break;
+        // No token contains a newline (string and char literals can't span
+        // lines either), so the byte after one always starts a fresh token
+        // or whitespace, and no quote tracking is needed.
+        const void* nl = std::memchr(source.data() + from, '\n', source.size() - from);
+        if (!nl) break;
+        size_t next = static_cast<const char*>(nl) - source.data() + 1;
+        if (next < source.size() && next > boundaries.back()) {
+            boundaries.push_back(next);
+        }
+    }
+    return boundaries;
+}
+
+TokenBuffer TokenizeParallel(std::string_view source, unsigned threads, size_t minChunkBytes,
+                             Arena* arena) {
+    // The serial lexer stops at the first NUL byte, so nothing past it counts.
+    std::string_view text = source;
+    if (const void* nul = std::memchr(source.data(), '\0', source.size())) {
+        text = source.substr(0, static_cast<const char*>(nul) - source.data());
+    }
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (minChunkBytes == 0) minChunkBytes = 1;
+    // a few chunks per worker so a slow chunk doesn't hold up the rest
+    size_t chunks = std::min<size_t>(4 * threads, text.size() / minChunkBytes);
+
+    if (chunks < 2) {
+        Lexer lexer(source);
+        return lexer.Tokenize(arena);
+    }
+
+    std::vector<size_t> boundaries = FindChunkBoundaries(text, chunks);
+    boundaries.push_back(text.size());
+    size_t count = boundaries.size() - 1;
+
+    std::vector<TokenBuffer> parts(count);
+    std::atomic<size_t> nextChunk(0);
+    auto worker = [&]() {
+        for (size_t c = nextChunk++; c < count; c = nextChunk++) {
+            Lexer lexer(text.substr(boundaries[c], boundaries[c + 1] - boundaries[c]));
+            TokenBuffer part(source);
+            Token tok = lexer.NextToken();
+            while (tok.type != TokenType::EOF_TOKEN) {
+                part.Push(tok.type, tok.literal);
+                tok = lexer.NextToken();
+            }
+            parts[c] = std::move(part);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    size_t workers = std::min<size_t>(threads, count);
+    for (size_t i = 1; i < workers; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();  // the calling thread works too
+    for (std::thread& t : pool) {
+        t.join();
+    }
+
+    size_t total = 1;
+    for (const TokenBuffer& part : parts) {
+        total += part.Size();
+    }
+    TokenBuffer tokens(source, arena);
+    tokens.Reserve(total);
+    for (const TokenBuffer& part : parts) {
+        tokens.Append(part);
+    }
+    tokens.Push(TokenType::EOF_TOKEN, "");
+    return tokens;
+}
@@ -0,0 +1,29 @@
+#ifndef PARALLEL_LEXER_H
+#define PARALLEL_LEXER_H
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+#include "../token/token_buffer.h"
+
+// Parallel front end for large sources. The source is cut into chunks at
+// safe boundaries (points no token can span), each chunk is lexed by its own
+// Lexer on a pool of worker threads, and the per-chunk buffers are stitched
+// back together in order. The result is identical to Lexer::Tokenize.
+//
+// Inputs smaller than a couple of chunks are simply lexed on the calling
+// thread.
+
+constexpr size_t kMinChunkBytes = 1 << 20;
+
+// Chunk start offsets, beginning with 0. Each chunk boundary sits just after
+// a newline, which is never inside a token, literals included.
+std::vector<size_t> FindChunkBoundaries(std::string_view source, size_t chunks);
+
+// threads == 0 uses one worker per hardware thread. Only the stitched
+// result comes from arena; the workers' chunk buffers use the heap, since
+// an arena belongs to one thread.
+TokenBuffer TokenizeParallel(std::string_view source, unsigned threads = 0,
+                             size_t minChunkBytes = kMinChunkBytes, Arena* arena = nullptr);
+
+#endif // PARALLEL_LEXER_H
@@ -0,0 +1,203 @@
+// scan.cpp
+
+#include "scan.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define SCAN_X86 1
+#endif
+
+namespace {
+
+using scan::IsDigit;
+using scan::IsIdent;
+using scan::IsSpace;
+
+template <bool (*In)(unsigned char)>
+size_t ScalarRun(const char* p, const char* end) {
+    const char* start = p;
+    while (p < end && In((unsigned char)*p)) {
+        p++;
+    }
+    return p - start;
+}
+
+inline bool EndsQuoted(unsigned char c, char quote) {
+    return c == (unsigned char)quote || c == '\\' || c == '\n' || c == '\0';
+}
+
+size_t ScalarQuotedRun(const char* p, const char* end, char quote) {
+    const char* start = p;
+    while (p < end && !EndsQuoted((unsigned char)*p, quote)) {
+        p++;
+    }
+    return p - start;
+}
+
+const scan::Kernels kScalar = {
+    "scalar",
+    ScalarRun<IsSpace>,
+    ScalarRun<IsIdent>,
+    ScalarRun<IsDigit>,
+    ScalarQuotedRun,
+};
+
+#ifdef SCAN_X86
+
+// The vector kernels build a byte mask of "in class" lanes, invert it and
+// count trailing zeros to find the first byte that ends the run. The last
+// partial vector is finished by the scalar loop so nothing past `end` is read.
+//
+// Range checks use the unsigned-min trick: (v - lo) <= width exactly when
+// min(v - lo, width) == v - lo.
+
+inline __m128i InRange128(__m128i v, char lo, char width) {
+    __m128i t = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(width)), t);
+}
+
+inline __m128i SpaceMask128(__m128i v) {
+    return _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+                        InRange128(v, '\t', '\r' - '\t'));
+}
+
+inline __m128i DigitMask128(__m128i v) {
+    return InRange128(v, '0', 9);
+}
+
+inline __m128i IdentMask128(__m128i v) {
+    __m128i alpha = InRange128(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z' - 'a');
+    __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(alpha, under), DigitMask128(v));
+}
+
+template <__m128i (*Mask)(__m128i), bool (*In)(unsigned char)>
+size_t Sse2Run(const char* p, const char* end) {
+    const char* start = p;
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        unsigned out = ~(unsigned)_mm_movemask_epi8(Mask(v)) & 0xFFFFu;
+        if (out) return (p - start) + __builtin_ctz(out);
+        p += 16;
+    }
+    return (p - start) + ScalarRun<In>(p, end);
+}
+
+// Quoted runs look for the first stop byte instead of the first non-member.
+size_t Sse2QuotedRun(const char* p, const char* end, char quote) {
+    const char* start = p;
+    const __m128i q = _mm_set1_epi8(quote);
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i zero = _mm_setzero_si128();
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        __m128i stop = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, q), _mm_cmpeq_epi8(v, backslash)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, newline), _mm_cmpeq_epi8(v, zero)));
+        unsigned hit = (unsigned)_mm_movemask_epi8(stop);
+        if (hit) return (p - start) + __builtin_ctz(hit);
+        p += 16;
+    }
+    return (p - start) + ScalarQuotedRun(p, end, quote);
+}
+
+const scan::Kernels kSse2 = {
+    "sse2",
+    Sse2Run<SpaceMask128, IsSpace>,
+    Sse2Run<IdentMask128, IsIdent>,
+    Sse2Run<DigitMask128, IsDigit>,
+    Sse2QuotedRun,
+};
+
+#define SCAN_AVX2 __attribute__((target("avx2")))
+
+SCAN_AVX2 inline __m256i InRange256(__m256i v, char lo, char width) {
+    __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(width)), t);
+}
+
+SCAN_AVX2 inline __m256i SpaceMask256(__m256i v) {
+    return _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                           InRange256(v, '\t', '\r' - '\t'));
+}
+
+SCAN_AVX2 inline __m256i DigitMask256(__m256i v) {
+    return InRange256(v, '0', 9);
+}
+
+SCAN_AVX2 inline __m256i IdentMask256(__m256i v) {
+    __m256i alpha = InRange256(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z' - 'a');
+    __m256i under = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    return _mm256_or_si256(_mm256_or_si256(alpha, under), DigitMask256(v));
+}
+
+template <__m256i (*Mask)(__m256i), bool (*In)(unsigned char)>
+SCAN_AVX2 size_t Avx2Run(const char* p, const char* end) {
+    const char* start = p;
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        unsigned out = ~(unsigned)_mm256_movemask_epi8(Mask(v));
+        if (out) return (p - start) + __builtin_ctz(out);
+        p += 32;
+    }
+    return (p - start) + ScalarRun<In>(p, end);
+}
+
+SCAN_AVX2 size_t Avx2QuotedRun(const char* p, const char* end, char quote) {
+    const char* start = p;
+    const __m256i q = _mm256_set1_epi8(quote);
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i zero = _mm256_setzero_si256();
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        __m256i stop = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, q), _mm256_cmpeq_epi8(v, backslash)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, newline), _mm256_cmpeq_epi8(v, zero)));
+        unsigned hit = (unsigned)_mm256_movemask_epi8(stop);
+        if (hit) return (p - start) + __builtin_ctz(hit);
+        p += 32;
+    }
+    return (p - start) + ScalarQuotedRun(p, end, quote);
+}
+
+const scan::Kernels kAvx2 = {
+    "avx2",
+    Avx2Run<SpaceMask256, IsSpace>,
+    Avx2Run<IdentMask256, IsIdent>,
+    Avx2Run<DigitMask256, IsDigit>,
+    Avx2QuotedRun,
+};
+
+bool HasAvx2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+#endif // SCAN_X86
+
+const scan::Kernels* Select() {
+#ifdef SCAN_X86
+    if (HasAvx2()) return &kAvx2;
+    return &kSse2;  // baseline on every x86-64 CPU
+#else
+    return &kScalar;
+#endif
+}
+
+}  // namespace
+
+namespace scan {
+
+const Kernels* active = Select();
+
+std::vector<const Kernels*> Supported() {
+    std::vector<const Kernels*> kernels = {&kScalar};
+#ifdef SCAN_X86
+    kernels.push_back(&kSse2);
+    if (HasAvx2()) kernels.push_back(&kAvx2);
+#endif
+    return kernels;
+}
+
+}  // namespace scan
@@ -0,0 +1,75 @@
+// scan.h
+//
+// Vectorized run scanners for the lexer. Each one returns how many leading
+// bytes of [p, end) belong to its character class, so the lexer can jump
+// over a whole run of indentation, an identifier or a digit string at once.
+//
+// The classes match the "C" locale: whitespace is ' ' and \t \n \v \f \r,
+// identifiers are [A-Za-z0-9_], digits are [0-9]. Quoted runs are the body
+// of a string or char literal: everything up to the closing quote, a
+// backslash, a newline or a NUL.
+//
+// The implementation is picked once at startup from the CPU: AVX2 (32 bytes
+// per step), SSE2 (16 bytes) or a plain scalar loop on other targets.
+
+#ifndef SCAN_H
+#define SCAN_H
+
+#include <cstddef>
+#include <vector>
+
+namespace scan {
+
+// The character classes above, shared by the kernels and the lexer's own
+// one-byte checks so both agree on every byte, including those >= 0x80.
+inline bool IsSpace(unsigned char c) {
+    return c == ' ' || (unsigned char)(c - '\t') <= '\r' - '\t';
+}
+
+inline bool IsDigit(unsigned char c) {
+    return (unsigned char)(c - '0') <= 9;
+}
+
+inline bool IsIdentStart(unsigned char c) {
+    // c | 0x20 folds A-Z onto a-z without touching '_'
+    return (unsigned char)((c | 0x20) - 'a') <= 'z' - 'a' || c == '_';
+}
+
+inline bool IsIdent(unsigned char c) {
+    return IsDigit(c) || IsIdentStart(c);
+}
+
+struct Kernels {
+    const char* name;
+    size_t (*whitespaceRun)(const char* p, const char* end);
+    size_t (*identifierRun)(const char* p, const char* end);
+    size_t (*digitRun)(const char* p, const char* end);
+    size_t (*quotedRun)(const char* p, const char* end, char quote);
+};
+
+// The kernels chosen for this CPU.
+extern const Kernels* active;
+
+// Every implementation this CPU can run, scalar first. Used by the tests to
+// check the vector kernels against the scalar ones.
+std::vector<const Kernels*> Supported();
+
+inline size_t WhitespaceRun(const char* p, const char* end) {
+    return active->whitespaceRun(p, end);
+}
+
+inline size_t IdentifierRun(const char* p, const char* end) {
+    return active->identifierRun(p, end);
+}
+
+inline size_t DigitRun(const char* p, const char* end) {
+    return active->digitRun(p, end);
+}
+
+inline size_t QuotedRun(const char* p, const char* end, char quote) {
+    return active->quotedRun(p, end, quote);
+}
+
+}  // namespace scan
+
+#endif // SCAN_H
@@ -0,0 +1,87 @@
+// stream_lexer.cpp
+
+#include "stream_lexer.h"
+#include "dfa_tables.h"
+#include "lexer.h"
+
+#include <cerrno>
+#include <cstring>
+#include <unistd.h>
+
+StreamLexer::StreamLexer(int fd, size_t chunkSize)
+    : fd(fd), chunkSize(chunkSize ? chunkSize : 1), buffer(2 * this->chunkSize + 1, '\0'),
+      pos(0), end(0), eof(false), failed(false) {}
+
+bool StreamLexer::Refill(size_t keepFrom) {
+    if (eof) return false;
+
+    size_t keep = end - keepFrom;
+    std::memmove(buffer.data(), buffer.data() + keepFrom, keep);
+    pos -= keepFrom;
+    end = keep;
+
+    // Only a single token longer than a chunk can make the window grow.
+    if (buffer.size() < end + chunkSize + 1) {
+        buffer.resize(end + chunkSize + 1);
+    }
+
+    ssize_t n;
+    do {
+        n = read(fd, buffer.data() + end, chunkSize);
+    } while (n < 0 && errno == EINTR);
+
+    if (n <= 0) {
+        failed = n < 0;
+        eof = true;
+    } else {
+        end += n;
+    }
+    buffer[end] = '\0';
+    return n > 0;
+}
+
+Token StreamLexer::NextToken() {
+    for (;;) {
+        const char* buf = buffer.data();
+
+        while (dfa::IsSpace(buf[pos])) {
+            pos++;
+        }
+        if (pos == end) {
+            // ran into the sentinel: read more unless the input is done
+            if (Refill(pos)) continue;
+            return Token(TokenType::EOF_TOKEN, "");
+        }
+
+        size_t start = pos;
+        uint8_t state = dfa::kNext[dfa::S_START][dfa::ClassOf(buf[start])];
+        if (state == dfa::S_REJECT) {
+            // a NUL byte inside the input ends it, as it does for Lexer
+            return Token(TokenType::EOF_TOKEN, "");
+        }
+
+        size_t p = start + 1;
+        for (;;) {
+            uint8_t next = dfa::kNext[state][dfa::ClassOf(buf[p])];
+            if (next == dfa::S_REJECT) break;
+            state = next;
+            p++;
+        }
+
+        if (p == end && !eof) {
+            // The token runs into the end of the window and may continue in
+            // the next chunk. Keep it, read more and scan it again.
+            pos = start;
+            Refill(start);
+            continue;
+        }
+
+        pos = p;
+        std::string_view literal(buf + start, p - start);
+        TokenType type = dfa::kAccept[state];
+        if (type == TokenType::IDENT) {
+            type = LookupIdent(literal);
+        }
+        return Token(type, literal);
+    }
+}
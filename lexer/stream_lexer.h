@@ -0,0 +1,45 @@
+#ifndef STREAM_LEXER_H
+#define STREAM_LEXER_H
+
+#include <cstddef>
+#include <vector>
+#include "../token/token.h"
+
+// Lexer that reads its input from a file descriptor in fixed-size chunks, so
+// memory stays bounded by the chunk size (plus the longest single token) no
+// matter how large the input is. It runs the same automaton as DfaLexer and
+// returns the same tokens as Lexer.
+//
+// Unlike Lexer, a token's literal is only valid until the next call to
+// NextToken, because the window it points into is recycled.
+class StreamLexer {
+public:
+    static constexpr size_t kDefaultChunkSize = 1 << 16;
+
+    // Does not take ownership of fd.
+    explicit StreamLexer(int fd, size_t chunkSize = kDefaultChunkSize);
+    Token NextToken();
+
+    // True if a read on the descriptor failed; the stream ends there.
+    bool Failed() const { return failed; }
+
+private:
+    // Slides the bytes from keepFrom onward to the front of the window and
+    // reads the next chunk behind them. Returns false once the input is
+    // exhausted.
+    bool Refill(size_t keepFrom);
+
+    int fd;
+    size_t chunkSize;
+    // Window over the input. Tokens must be contiguous to be handed out as
+    // string_views, so instead of wrapping around like a ring buffer the
+    // unread tail is moved to the front before each read. buffer[end] is
+    // always a NUL sentinel.
+    std::vector<char> buffer;
+    size_t pos;  // next unread byte
+    size_t end;  // one past the last byte read so far
+    bool eof;
+    bool failed;
+};
+
+#endif // STREAM_LEXER_H
@@ -6,57 +6,215 @@
 
 #include "token/token.h"
 #include "lexer/lexer.h"
+#include "lexer/parallel_lexer.h"
 #include "parser/parser.h"
+#include "parser/parallel_parser.h"
 #include "ast/ast.h"
 #include "processor/processor.h"
+#include "processor/stream_translator.h"
+#include "processor/precompiled_header.h"
+#include "source/source.h"
+#include "memory/arena.h"
+#include "ast/ast_file.h"
+#include "optimizer/passes.h"
 
+#include <csignal>
+#include <functional>
+#include <fcntl.h>
+#include <unistd.h>
 
-int main(int argc, char* argv[]) {
+// Where the translation goes. makeTarget is only called once the input is
+// open, so a missing input neither truncates the output file nor starts a
+// --pipe command. preambleHeader is the precompiled preamble to include,
+// or "" to write the preamble itself.
+struct Output {
+    std::function<std::unique_ptr<OutputTarget>()> makeTarget;
+    std::string preambleHeader;
+};
+
+// Every path that holds the whole tree writes it through here
+int writeTranslation(Processor& processor, const Output& output) {
+    processor.setOutput(output.makeTarget());
+    processor.setPreambleHeader(output.preambleHeader);
+    return processor.process() ? 0 : 1;
+}
 
-    if(argc != 2) {
-        std::cout << "Usage: ./main <file>\n";
+// Bounded-memory translation: no token or AST dump, since neither is ever
+// whole in memory. Each unit is only part of the program, so it gets the
+// unit-safe passes.
+int translateStream(const char* path, const Output& output, bool optimize) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error opening file" << std::endl;
         return 1;
     }
+    PassManager passes;
+    if (optimize) AddStandardPasses(passes, false);
+    StreamResult result = TranslateStream(fd, output.makeTarget(), StreamLexer::kDefaultChunkSize,
+                                          nullptr, optimize ? &passes : nullptr, output.preambleHeader);
+    close(fd);
+    for (const std::string& error : result.errors) {
+        std::cerr << error << '\n';
+    }
+    return result.ok ? 0 : 1;
+}
 
-    std::ifstream file(argv[1]);
-    if (!file.is_open()) {
+
+// Translation through the parse cache: an unchanged source maps its tree
+// from cacheDir and skips lexing and parsing; a fresh parse without errors
+// is stored there for next time. The cache holds trees as parsed, so passes
+// run on a copy of a mapped tree.
+int translateCached(const char* cacheDir, const char* path, const Output& output, PassManager* passes) {
+    SourceBuffer source;
+    if (!source.Open(path)) {
         std::cerr << "Error opening file" << std::endl;
         return 1;
     }
-    std::string program((std::istreambuf_iterator<char>(file)),
-                        std::istreambuf_iterator<char>());
+    // too large for one TokenBuffer, and so for the cache
+    if (source.View().size() > TokenBuffer::kMaxSourceBytes) {
+        return translateStream(path, output, passes != nullptr);
+    }
+    ParseCache cache(cacheDir);
 
-    file.close();
+    MappedAST mapped;
+    if (cache.Load(source.View(), mapped)) {
+        if (!passes) {
+            Processor processor(mapped.Tree(), mapped.Names(), "");
+            return writeTranslation(processor, output);
+        }
+        AST tree;
+        tree.Append(mapped.Tree());
+        Interner symbols;
+        symbols.InternAll(mapped.Names());
+        passes->Run(tree, symbols);
+        Processor processor(std::move(tree), symbols, "");
+        return writeTranslation(processor, output);
+    }
+
+    Arena arena;
+    Parser parser(TokenizeParallel(source.View(), 0, kMinChunkBytes, &arena));
+    ParseProgramParallel(parser);
+    for (const std::string& error : parser.errors) {
+        std::cerr << error << '\n';
+    }
+    if (parser.errors.empty()) {
+        cache.Store(source.View(), parser.nodes.View(), parser.names().Table());
+    }
+    if (passes) passes->Run(parser.nodes, parser.names());
+    Processor processor(std::move(parser.nodes), parser.names(), "");
+    return writeTranslation(processor, output);
+}
 
-    // Initialize Lexer
-    Lexer lexer(program);
+int main(int argc, char* argv[]) {
 
-    // Get tokens
-    std::vector<Token> tokens;
-    Token tok = lexer.NextToken();
-    while (tok.type != TokenType::EOF_TOKEN) {
-        tokens.push_back(tok);
-        std::cout << TokenTypeToString(tok.type) << '\n';
-        tok = lexer.NextToken();
+    // The translation goes to test.cpp unless -o names another file ("-"
+    // is stdout) or --pipe gives a command to feed it to, e.g. the compiler.
+    // -O0 writes the tree as parsed, without the optimization passes.
+    // --pch keeps the preamble precompiled in a directory for the compiler
+    // command given by --cxx, and the output includes it instead.
+    bool stream = false;
+    bool optimize = true;
+    const char* cacheDir = nullptr;
+    const char* pchDir = nullptr;
+    std::string compiler = "g++ -std=c++17";
+    std::string outputPath = "test.cpp";
+    const char* pipeCommand = nullptr;
+    int arg = 1;
+    for (; arg + 1 < argc; arg++) {
+        std::string option = argv[arg];
+        if (option == "--stream") {
+            stream = true;
+        } else if (option == "-O0") {
+            optimize = false;
+        } else if (option == "--cache" && arg + 2 < argc) {
+            cacheDir = argv[++arg];
+        } else if (option == "--pch" && arg + 2 < argc) {
+            pchDir = argv[++arg];
+        } else if (option == "--cxx" && arg + 2 < argc) {
+            compiler = argv[++arg];
+        } else if (option == "-o" && arg + 2 < argc) {
+            outputPath = argv[++arg];
+            pipeCommand = nullptr;
+        } else if (option == "--pipe" && arg + 2 < argc) {
+            pipeCommand = argv[++arg];
+        } else {
+            break;
+        }
+    }
+    if(arg + 1 != argc) {
+        std::cout << "Usage: ./main [--stream | --cache <dir>] [-O0] [-o <out> | --pipe <command>]"
+                     " [--pch <dir> [--cxx <compiler command>]] <file>\n";
+        return 1;
     }
-    tokens.push_back(tok); // Add the EOF token
+    const char* path = argv[arg];
+    Output output;
+    output.makeTarget = [&]() -> std::unique_ptr<OutputTarget> {
+        if (pipeCommand) {
+            // a command that exits early shows up as a failed write
+            signal(SIGPIPE, SIG_IGN);
+            return std::make_unique<PipeTarget>(pipeCommand);
+        }
+        if (outputPath == "-") return std::make_unique<FdTarget>(STDOUT_FILENO);
+        return std::make_unique<FileTarget>(outputPath);
+    };
+    // With -o - stdout carries the translation, so the token and AST dumps
+    // are skipped; errors go to stderr on every path
+    bool dump = pipeCommand || outputPath != "-";
+    PassManager passes;
+    if (optimize) AddStandardPasses(passes);
+    PassManager* run = optimize ? &passes : nullptr;
 
-    Parser parser(tokens);
-    parser.parseProgram();
+    // without the header the output carries the preamble itself
+    if (pchDir) {
+        std::string error;
+        output.preambleHeader = PreambleCache(pchDir).Header(compiler, &error);
+        if (output.preambleHeader.empty()) std::cerr << "Precompiled preamble: " << error << std::endl;
+    }
+
+    if (stream) {
+        return translateStream(path, output, optimize);
+    }
+    if (cacheDir) {
+        return translateCached(cacheDir, path, output, run);
+    }
 
-    parser.printNodes();
+    // The mapped source backs every token literal, so it stays alive until
+    // the processor has written the output.
+    SourceBuffer source;
+    if (!source.Open(path)) {
+        std::cerr << "Error opening file" << std::endl;
+        return 1;
+    }
+    // One TokenBuffer cannot address a larger source, so it is translated a
+    // function at a time instead
+    if (source.View().size() > TokenBuffer::kMaxSourceBytes) {
+        return translateStream(path, output, optimize);
+    }
+
+    // Tokens, nodes and the emitter's work stack all come from one arena,
+    // torn down in one go at exit
+    Arena arena;
+
+    // Get tokens (large inputs are lexed on all cores)
+    TokenBuffer tokens = TokenizeParallel(source.View(), 0, kMinChunkBytes, &arena);
+    if (dump) {
+        for (size_t i = 0; i + 1 < tokens.Size(); i++) {
+            std::cout << TokenTypeToString(tokens.Type(i)) << '\n';
+        }
+    }
+
+    Parser parser(std::move(tokens));
+    ParseProgramParallel(parser);  // functions are parsed on all cores too
+
+    if (dump) parser.printNodes();
 
     //print out the errors
     std::vector<std::string> errors = parser.Errors();
     for (std::string error : errors) {
-        std::cout << error << '\n';
+        std::cerr << error << '\n';
     }
 
-    std::vector<ASTNode> nodes = parser.nodes;
-    std::string output = "test.cpp";
-
-    Processor processor(nodes, output);
-    processor.process();
-
-    return 0;
+    if (run) run->Run(parser.nodes, parser.names());
+    Processor processor(std::move(parser.nodes), parser.names(), "");
+    return writeTranslation(processor, output);
 }
@@ -0,0 +1,98 @@
+// arena.cpp
+
+#include "arena.h"
+
+#include <cstdint>
+#include <sys/mman.h>
+
+namespace {
+
+constexpr size_t kHugePage = 2 << 20;
+
+size_t RoundUp(size_t n, size_t to) {
+    return (n + to - 1) / to * to;
+}
+
+char* Map(size_t size, bool hugePages) {
+    void* p = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (hugePages) {
+        p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+    if (p == MAP_FAILED) {
+        p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+        if (hugePages) madvise(p, size, MADV_HUGEPAGE);
+#endif
+    }
+    return static_cast<char*>(p);
+}
+
+}  // namespace
+
+Arena::Arena(size_t blockSize, bool hugePages)
+    : blockSize(hugePages ? RoundUp(blockSize ? blockSize : 1, kHugePage) : (blockSize ? blockSize : 1)),
+      hugePages(hugePages), current(0), next(nullptr), limit(nullptr), usedBefore(0) {}
+
+Arena::~Arena() {
+    for (const Block& block : blocks) {
+        munmap(block.base, block.size);
+    }
+}
+
+void* Arena::Allocate(size_t bytes, size_t align) {
+    uintptr_t mask = align - 1;
+    uintptr_t p = (reinterpret_cast<uintptr_t>(next) + mask) & ~mask;
+    // next is null before the first block, which always takes this branch
+    if (!next || p + bytes > reinterpret_cast<uintptr_t>(limit)) {
+        NextBlock(bytes, align);
+        p = (reinterpret_cast<uintptr_t>(next) + mask) & ~mask;
+    }
+    next = reinterpret_cast<char*>(p + bytes);
+    return reinterpret_cast<void*>(p);
+}
+
+// Moves on to the first kept block after current that fits, mapping a new
+// one (at least blockSize, bigger for a large request) if none does.
+void Arena::NextBlock(size_t bytes, size_t align) {
+    size_t need = bytes + align;
+    size_t from = next ? current + 1 : 0;
+    if (next) usedBefore += next - blocks[current].base;
+
+    for (size_t i = from; i < blocks.size(); i++) {
+        if (blocks[i].size >= need) {
+            // skipped blocks sit idle until the next Reset
+            current = i;
+            next = blocks[i].base;
+            limit = next + blocks[i].size;
+            return;
+        }
+    }
+
+    size_t size = need > blockSize ? RoundUp(need, hugePages ? kHugePage : 4096) : blockSize;
+    Block block = {Map(size, hugePages), size};
+    blocks.insert(blocks.begin() + from, block);
+    current = from;
+    next = block.base;
+    limit = next + size;
+}
+
+void Arena::Reset() {
+    current = 0;
+    next = blocks.empty() ? nullptr : blocks[0].base;
+    limit = blocks.empty() ? nullptr : blocks[0].base + blocks[0].size;
+    usedBefore = 0;
+}
+
+size_t Arena::Used() const {
+    return usedBefore + (next ? next - blocks[current].base : 0);
+}
+
+size_t Arena::Reserved() const {
+    size_t total = 0;
+    for (const Block& block : blocks) total += block.size;
+    return total;
+}
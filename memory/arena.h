@@ -0,0 +1,90 @@
+// arena.h
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// Bump allocator for one compilation session. Memory comes from a few large
+// mmap'd blocks; an allocation is an align-and-advance of a pointer, freeing
+// is a no-op, and Reset() rewinds to the first block in O(1) so the next
+// program reuses the same pages. Blocks are only unmapped when the arena is
+// destroyed.
+//
+// With hugePages the blocks are rounded to 2 MiB and mapped with
+// MAP_HUGETLB, falling back to transparent huge pages (madvise) when no
+// huge pages are reserved.
+//
+// Not thread-safe: give each thread its own arena, or none.
+class Arena {
+public:
+    static constexpr size_t kDefaultBlockSize = 1 << 20;
+
+    explicit Arena(size_t blockSize = kDefaultBlockSize, bool hugePages = false);
+    ~Arena();
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    void* Allocate(size_t bytes, size_t align);
+    // Everything allocated so far becomes invalid; containers drawing from
+    // the arena must be dead (or never touched again) by then.
+    void Reset();
+
+    size_t Used() const;      // bytes handed out since the last Reset
+    size_t Reserved() const;  // bytes mapped
+
+private:
+    struct Block {
+        char* base;
+        size_t size;
+    };
+    void NextBlock(size_t bytes, size_t align);
+
+    size_t blockSize;
+    bool hugePages;
+    std::vector<Block> blocks;
+    size_t current;       // block being bumped
+    char* next;           // next free byte in it
+    char* limit;
+    size_t usedBefore;    // bytes used in the blocks before current
+};
+
+// std-compatible allocator over an Arena. A null arena means the global
+// heap, so a container only uses an arena when it is given one. The arena
+// travels with the container on move, copy and swap.
+template <class T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = std::false_type;
+
+    ArenaAllocator(Arena* arena = nullptr) : arena(arena) {}
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.arena) {}
+
+    T* allocate(size_t n) {
+        if (arena) return static_cast<T*>(arena->Allocate(n * sizeof(T), alignof(T)));
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    void deallocate(T* p, size_t) {
+        if (!arena) ::operator delete(p);
+    }
+
+    template <class U>
+    bool operator==(const ArenaAllocator<U>& other) const { return arena == other.arena; }
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return arena != other.arena; }
+
+    Arena* arena;
+};
+
+template <class T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif // ARENA_H
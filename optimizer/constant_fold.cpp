@@ -0,0 +1,198 @@
+// constant_fold.cpp
+
+#include "constant_fold.h"
+
+#include <climits>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "../ast/visitor.h"
+
+namespace {
+
+// Nodes that open a scope for the declarations under them
+bool OpensScope(NodeKind kind) {
+    switch (kind) {
+        case NodeKind::Program:
+        case NodeKind::Function:
+        case NodeKind::Block:
+        case NodeKind::For:
+        case NodeKind::Forn:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Walks the tree in source order with an explicit stack, so deep nesting
+// doesn't touch the native stack. Each node is handled on the way out, when
+// its operands are already folded and every declaration before it has been
+// seen.
+class Folder : public ASTVisitor<Folder> {
+public:
+    Folder(AST& tree, Interner& symbols, bool wholeProgram)
+        : tree(tree), symbols(symbols), wholeProgram(wholeProgram),
+          constant(symbols.Size(), Interner::kNone), assigned(symbols.Size(), false) {}
+
+    bool Run() {
+        findAssignments();
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            int item = stack.back();
+            stack.pop_back();
+            if (item < 0) {
+                leave(~item);
+                continue;
+            }
+            if (OpensScope(tree[item].kind)) scopes.push_back(undo.size());
+            stack.push_back(~item);
+            ChildRange children = tree.Children(item);
+            switch (tree[item].kind) {
+                case NodeKind::Cout:
+                case NodeKind::Cin:
+                case NodeKind::PostfixOperator:
+                    break;
+                case NodeKind::FunctionCall:
+                    if (children.size() == 2) stack.push_back(children[1]);
+                    break;
+                default:
+                    for (size_t i = children.size(); i-- > 0;) stack.push_back(children[i]);
+            }
+        }
+        return changed;
+    }
+
+    void visitDeclaration(int node) {
+        Symbol name = tree[node].name;
+        Symbol value = Interner::kNone;
+        ChildRange init = tree.Children(node);
+        long long v;
+        bool topLevel = scopes.size() == 1;
+        if (tree[node].varType == TokenType::INT && init.size() == 1 && intValue(init[0], v) &&
+            !assigned[name] && (wholeProgram || !topLevel)) {
+            value = tree[init[0]].name;
+        }
+        bind(name, value);
+    }
+
+    // A read, not an assignment (which has the value as its child)
+    void visitIdentifier(int node) {
+        Symbol name = tree[node].name;
+        if (!tree.Children(node).empty() || name >= constant.size()) return;
+        if (constant[name] == Interner::kNone) return;
+        tree[node].kind = NodeKind::IntLiteral;
+        tree[node].name = constant[name];
+        changed = true;
+    }
+
+    void visitUnaryOperator(int node) {
+        ChildRange operand = tree.Children(node);
+        long long v;
+        if (operand.size() != 1 || !intValue(operand[0], v)) return;
+        if (tree[node].op == TokenType::MINUS) fold(node, -v);
+        else if (tree[node].op == TokenType::BANG) fold(node, v == 0);
+    }
+
+    void visitBinaryOperator(int node) {
+        ChildRange operands = tree.Children(node);
+        long long a, b;
+        if (operands.size() != 2 || !intValue(operands[0], a) || !intValue(operands[1], b)) return;
+        switch (tree[node].op) {
+            case TokenType::PLUS: fold(node, a + b); break;
+            case TokenType::MINUS: fold(node, a - b); break;
+            case TokenType::ASTERISK: fold(node, a * b); break;
+            // C++ division truncates toward zero, as it does here; the
+            // operands are ints, so INT_MIN / -1 can't come up
+            case TokenType::SLASH: if (b != 0) fold(node, a / b); break;
+            case TokenType::LT: fold(node, a < b); break;
+            case TokenType::GT: fold(node, a > b); break;
+            case TokenType::LTE: fold(node, a <= b); break;
+            case TokenType::GTE: fold(node, a >= b); break;
+            case TokenType::EQ: fold(node, a == b); break;
+            case TokenType::NOT_EQ: fold(node, a != b); break;
+            case TokenType::AND: fold(node, a != 0 && b != 0); break;
+            case TokenType::OR: fold(node, a != 0 || b != 0); break;
+            default: break;
+        }
+    }
+
+private:
+    // Names assigned, incremented or read into anywhere: never constant,
+    // whatever scope they are declared in.
+    void findAssignments() {
+        for (size_t i = 0; i < tree.size(); i++) {
+            const ASTNode& node = tree[i];
+            if (node.kind == NodeKind::Identifier && node.childCount > 0) {
+                mark(node.name);
+            } else if ((node.kind == NodeKind::PostfixOperator || node.kind == NodeKind::Cin) &&
+                       node.childCount == 1) {
+                const ASTNode& operand = tree[tree.Children(i)[0]];
+                if (operand.kind == NodeKind::Identifier) mark(operand.name);
+            }
+        }
+    }
+
+    void mark(Symbol name) {
+        if (name < assigned.size()) assigned[name] = true;
+    }
+
+    void leave(int node) {
+        visit(tree[node].kind, node);
+        if (!OpensScope(tree[node].kind)) return;
+        for (size_t i = undo.size(); i-- > scopes.back();) constant[undo[i].name] = undo[i].previous;
+        undo.resize(scopes.back());
+        scopes.pop_back();
+    }
+
+    // value is the literal symbol name now stands for, or kNone if it is a
+    // variable (which hides any constant of the same name outside)
+    void bind(Symbol name, Symbol value) {
+        if (name >= constant.size()) return;
+        undo.push_back({name, constant[name]});
+        constant[name] = value;
+    }
+
+    // The value of an int literal that C++ reads as an int
+    bool intValue(int node, long long& value) const {
+        if (tree[node].kind != NodeKind::IntLiteral || tree[node].name == Interner::kNone) return false;
+        std::string_view text = symbols.Name(tree[node].name);
+        if (text.empty() || text.size() > 24) return false;
+        char buffer[32];
+        text.copy(buffer, text.size());
+        buffer[text.size()] = '\0';
+        char* end;
+        value = std::strtoll(buffer, &end, 0);  // 0x.. and 0.. as C++ reads them
+        return *end == '\0' && value > INT_MIN && value <= INT_MAX;
+    }
+
+    void fold(int node, long long value) {
+        if (value <= INT_MIN || value > INT_MAX) return;
+        ASTNode& n = tree[node];
+        n.kind = NodeKind::IntLiteral;
+        n.op = TokenType::ILLEGAL;
+        n.name = symbols.Intern(std::to_string(value));
+        n.firstChild = 0;
+        n.childCount = 0;
+        changed = true;
+    }
+
+    struct Shadowed {
+        Symbol name;
+        Symbol previous;
+    };
+
+    AST& tree;
+    Interner& symbols;
+    bool wholeProgram;
+    bool changed = false;
+    std::vector<Symbol> constant;  // per variable name, its literal or kNone
+    std::vector<bool> assigned;
+    std::vector<Shadowed> undo;    // bindings to restore when a scope closes
+    std::vector<size_t> scopes;    // undo size when each open scope began
+};
+
+}  // namespace
+
+bool ConstantFoldPass::Run(AST& tree, Interner& symbols) {
+    return Folder(tree, symbols, wholeProgram).Run();
+}
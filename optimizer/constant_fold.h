@@ -0,0 +1,33 @@
+// constant_fold.h
+
+#ifndef CONSTANT_FOLD_H
+#define CONSTANT_FOLD_H
+
+#include "../ast/pass.h"
+
+// Folds BINARY and UNARY OPERATORs whose operands are int constants into a
+// single INT_LITERAL, and replaces each read of an int variable that is
+// declared with a constant initializer and never assigned or incremented
+// with the constant itself, so `int n = 10; ... n * 4` becomes `40`.
+//
+// Only what C++ would compute the same way in `int` is folded: a result
+// that overflows, divides by zero or is INT_MIN stays as written.
+// Comparisons and && / || fold to 0 or 1. Negative results are literals
+// spelled with their sign ("-3"), which is safe because unary minus over a
+// constant is folded too. The operand of COUT, CIN and ++ / -- and callee
+// names are left alone, as they have to stay identifiers.
+//
+// Assignments are collected over the whole tree, so a program translated
+// in units has to pass wholeProgram = false: a top-level variable may be
+// assigned in a later unit, so those are never propagated.
+class ConstantFoldPass : public Pass {
+public:
+    explicit ConstantFoldPass(bool wholeProgram = true) : wholeProgram(wholeProgram) {}
+    std::string_view Name() const override { return "constant-fold"; }
+    bool Run(AST& tree, Interner& symbols) override;
+
+private:
+    bool wholeProgram;
+};
+
+#endif // CONSTANT_FOLD_H
@@ -0,0 +1,304 @@
+// dead_code.cpp
+
+#include "dead_code.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+class Sweeper {
+public:
+    Sweeper(AST& tree, Interner& symbols, bool wholeProgram)
+        : tree(tree), symbols(symbols), wholeProgram(wholeProgram),
+          removed(tree.size(), false), uses(symbols.Size()),
+          parent(tree.size(), -1), position(tree.size(), 0) {}
+
+    bool Run() {
+        dropAfterReturns();
+        if (wholeProgram) dropUnreachableFunctions();
+        for (int top : tree.Children(0)) {
+            if (removed[top] || tree[top].kind != NodeKind::Function) continue;
+            sweep(top, localDeclarations(top));
+        }
+        if (wholeProgram) sweep(0, topLevelDeclarations());
+        compact();
+        return changed;
+    }
+
+private:
+    // Calls f on every live node under root (root included), parents first
+    template <typename F>
+    void forEach(int root, F f) {
+        stack.assign(1, root);
+        while (!stack.empty()) {
+            int node = stack.back();
+            stack.pop_back();
+            f(node);
+            ChildRange children = tree.Children(node);
+            for (size_t i = children.size(); i-- > 0;) {
+                if (!removed[children[i]]) stack.push_back(children[i]);
+            }
+        }
+    }
+
+    void dropAfterReturns() {
+        for (size_t i = 0; i < tree.size(); i++) {
+            if (tree[i].kind != NodeKind::Block) continue;
+            ChildRange statements = tree.Children(i);
+            for (size_t j = 0; j + 1 < statements.size(); j++) {
+                if (tree[statements[j]].kind == NodeKind::Return) {
+                    tree[i].childCount = static_cast<uint32_t>(j + 1);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // main() only calls solve, so everything else has to be reached from it
+    // or from an initializer of a top-level variable.
+    void dropUnreachableFunctions() {
+        Symbol solve = symbols.Find("solve");
+        std::unordered_map<Symbol, std::vector<int>> functions;
+        std::vector<int> work;
+        for (int top : tree.Children(0)) {
+            if (tree[top].kind == NodeKind::Function) functions[tree[top].name].push_back(top);
+            else work.push_back(top);
+        }
+        if (solve == Interner::kNone || !functions.count(solve)) return;
+
+        std::vector<bool> reached(tree.size(), false);
+        for (int f : functions[solve]) {
+            reached[f] = true;
+            work.push_back(f);
+        }
+        std::vector<int> callees;
+        while (!work.empty()) {
+            int root = work.back();
+            work.pop_back();
+            callees.clear();
+            forEach(root, [&](int node) {
+                ChildRange children = tree.Children(node);
+                if (tree[node].kind == NodeKind::FunctionCall && !children.empty()) {
+                    callees.push_back(tree[children[0]].name);
+                }
+            });
+            for (Symbol callee : callees) {
+                auto it = functions.find(callee);
+                if (it == functions.end()) continue;
+                for (int f : it->second) {
+                    if (reached[f]) continue;
+                    reached[f] = true;
+                    work.push_back(f);
+                }
+            }
+        }
+        for (const auto& entry : functions) {
+            for (int f : entry.second) {
+                if (reached[f]) continue;
+                removed[f] = true;
+                changed = true;
+            }
+        }
+    }
+
+    // No calls and no ++ / --, so evaluating it or not makes no difference
+    bool pure(int node) {
+        bool result = true;
+        forEach(node, [&](int n) {
+            NodeKind kind = tree[n].kind;
+            if (kind == NodeKind::FunctionCall || kind == NodeKind::PostfixOperator) result = false;
+        });
+        return result;
+    }
+
+    // Declarations that are statements of a block in function, not
+    // parameters or loop variables
+    std::vector<int> localDeclarations(int function) {
+        std::vector<int> blocks;
+        forEach(function, [&](int node) {
+            if (tree[node].kind == NodeKind::Block) blocks.push_back(node);
+        });
+        std::vector<int> declarations;
+        for (int block : blocks) {
+            for (int statement : tree.Children(block)) {
+                if (tree[statement].kind == NodeKind::Declaration) declarations.push_back(statement);
+            }
+        }
+        return declarations;
+    }
+
+    std::vector<int> topLevelDeclarations() {
+        std::vector<int> declarations;
+        for (int top : tree.Children(0)) {
+            if (!removed[top] && tree[top].kind == NodeKind::Declaration) declarations.push_back(top);
+        }
+        return declarations;
+    }
+
+    // Drops each of the candidates whose variable is never read under root,
+    // together with the statements that only assign it, then any that
+    // became unread by that.
+    void sweep(int root, const std::vector<int>& candidates) {
+        std::vector<Symbol> touched;
+        std::vector<int> writes;
+        auto use = [&](Symbol name) -> Use& {
+            if (!uses[name].touched) {
+                uses[name].touched = true;
+                touched.push_back(name);
+            }
+            return uses[name];
+        };
+        parent[root] = -1;
+        forEach(root, [&](int node) {
+            const ASTNode& n = tree[node];
+            ChildRange children = tree.Children(node);
+            for (size_t i = 0; i < children.size(); i++) {
+                parent[children[i]] = node;
+                position[children[i]] = static_cast<int>(i);
+            }
+            bool statement = parent[node] >= 0 && tree[parent[node]].kind == NodeKind::Block;
+            switch (n.kind) {
+                case NodeKind::Declaration:
+                case NodeKind::Function:
+                    if (n.name < uses.size()) use(n.name).declarations++;
+                    break;
+                case NodeKind::Identifier:
+                    if (n.name >= uses.size()) break;
+                    if (children.empty()) use(n.name).reads++;
+                    else if (statement) writes.push_back(node);
+                    else use(n.name).pinned = true;
+                    break;
+                case NodeKind::PostfixOperator:
+                case NodeKind::Cin:
+                    // the operand is written, not read; it is counted next
+                    for (int operand : children) {
+                        Symbol name = tree[operand].name;
+                        if (tree[operand].kind != NodeKind::Identifier || tree[operand].childCount ||
+                            name >= uses.size()) {
+                            continue;
+                        }
+                        use(name).reads--;
+                        if (n.kind == NodeKind::PostfixOperator && statement) writes.push_back(node);
+                        else use(name).pinned = true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        });
+
+        // An assignment with side effects has to stay, and so does its variable
+        std::unordered_map<Symbol, std::vector<int>> assignments;
+        for (int w : writes) {
+            Symbol name = written(w);
+            if (tree[w].kind == NodeKind::Identifier && !pure(tree.Children(w)[0])) {
+                uses[name].pinned = true;
+                continue;
+            }
+            assignments[name].push_back(w);
+            if (tree[w].kind == NodeKind::PostfixOperator) continue;
+            forEach(w, [&](int node) {
+                if (node != w && tree[node].kind == NodeKind::Identifier && tree[node].name == name &&
+                    !tree[node].childCount) {
+                    uses[name].ownReads++;
+                }
+            });
+        }
+
+        std::unordered_map<Symbol, int> declarationOf;
+        std::vector<int> work;
+        for (int d : candidates) {
+            if (!pure(d)) continue;
+            declarationOf[tree[d].name] = d;
+            work.push_back(d);
+        }
+        std::vector<int> dropped;
+        while (!work.empty()) {
+            int d = work.back();
+            work.pop_back();
+            Symbol name = tree[d].name;
+            if (removed[d] || name >= uses.size()) continue;
+            const Use& u = uses[name];
+            if (u.pinned || u.declarations != 1 || u.reads != u.ownReads) continue;
+            const std::vector<int>& own = assignments[name];
+            bool scoped = true;
+            for (int w : own) scoped = scoped && inScope(w, d);
+            if (!scoped) continue;
+
+            dropped.assign(1, d);
+            dropped.insert(dropped.end(), own.begin(), own.end());
+            for (int x : dropped) {
+                removed[x] = true;
+                changed = true;
+                if (tree[x].kind == NodeKind::PostfixOperator) continue;
+                forEach(x, [&](int node) {
+                    if (node == x || tree[node].kind != NodeKind::Identifier || tree[node].childCount) return;
+                    Symbol read = tree[node].name;
+                    if (read >= uses.size()) return;
+                    Use& r = uses[read];
+                    r.reads--;
+                    if (read == name) r.ownReads--;
+                    if (r.reads != r.ownReads) return;
+                    auto it = declarationOf.find(read);
+                    if (it != declarationOf.end()) work.push_back(it->second);
+                });
+            }
+        }
+        for (Symbol name : touched) uses[name] = Use();
+    }
+
+    Symbol written(int write) const {
+        if (tree[write].kind == NodeKind::Identifier) return tree[write].name;
+        return tree[tree.Children(write)[0]].name;
+    }
+
+    // Whether statement runs where declaration d is visible: under the
+    // block d is in, in a statement after d
+    bool inScope(int statement, int d) const {
+        int block = parent[d];
+        int at = statement;
+        while (at >= 0 && parent[at] != block) at = parent[at];
+        return at >= 0 && position[at] > position[d];
+    }
+
+    // Closes the gaps dropped nodes leave in their parents' child ranges
+    void compact() {
+        for (size_t i = 0; i < tree.size(); i++) {
+            uint32_t first = tree[i].firstChild;
+            uint32_t kept = 0;
+            for (uint32_t j = 0; j < tree[i].childCount; j++) {
+                int child = tree.edges[first + j];
+                if (!removed[child]) tree.edges[first + kept++] = child;
+            }
+            tree[i].childCount = kept;
+        }
+    }
+
+    AST& tree;
+    Interner& symbols;
+    bool wholeProgram;
+    bool changed = false;
+    // How a name is used under the root of a sweep
+    struct Use {
+        int reads = 0;         // as a value, own assignments included
+        int ownReads = 0;      // inside the name's own droppable assignments
+        int declarations = 0;  // variables, parameters and functions
+        bool pinned = false;   // written where the write can't just be dropped
+        bool touched = false;
+    };
+
+    std::vector<bool> removed;
+    std::vector<Use> uses;     // per name during a sweep
+    std::vector<int> parent;   // filled by each sweep for the nodes under its root
+    std::vector<int> position; // index among the parent's children
+    std::vector<int> stack;
+};
+
+}  // namespace
+
+bool DeadCodePass::Run(AST& tree, Interner& symbols) {
+    if (tree.empty()) return false;
+    return Sweeper(tree, symbols, wholeProgram).Run();
+}
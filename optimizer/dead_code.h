@@ -0,0 +1,36 @@
+// dead_code.h
+
+#ifndef DEAD_CODE_H
+#define DEAD_CODE_H
+
+#include "../ast/pass.h"
+
+// Drops what the translated program can never run or read:
+//   - statements after a RETURN in the same block;
+//   - functions not reachable from solve (or from a top-level initializer)
+//     over the call graph, when the tree has a solve;
+//   - declarations whose variable is never read, together with the
+//     statements that only write it (`w = a + 1;`, `w = w + 1;`, `w++;`),
+//     as long as the initializer and the assigned values can't have side
+//     effects (no calls, no ++ / --). A variable read into by CIN, or
+//     assigned anywhere but as a statement of its own, stays. Dropping one
+//     can leave others unread, so this runs to a fixed point.
+// Reads are counted by name per function (per program for top-level
+// variables), so a name that is declared twice anywhere in its function
+// keeps its declaration, and so does one assigned outside the
+// declaration's scope.
+//
+// With wholeProgram false the tree is one unit of a larger program, whose
+// later units may call its functions or read its top-level variables, so
+// only statements after a return and function-local declarations go.
+class DeadCodePass : public Pass {
+public:
+    explicit DeadCodePass(bool wholeProgram = true) : wholeProgram(wholeProgram) {}
+    std::string_view Name() const override { return "dead-code"; }
+    bool Run(AST& tree, Interner& symbols) override;
+
+private:
+    bool wholeProgram;
+};
+
+#endif // DEAD_CODE_H
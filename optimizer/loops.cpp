@@ -0,0 +1,659 @@
+// loops.cpp
+
+#include "loops.h"
+
+#include <climits>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// Nodes that open a scope for the declarations under them
+bool OpensScope(NodeKind kind) {
+    switch (kind) {
+        case NodeKind::Program:
+        case NodeKind::Function:
+        case NodeKind::Block:
+        case NodeKind::For:
+        case NodeKind::Forn:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool IsLoop(NodeKind kind) {
+    return kind == NodeKind::For || kind == NodeKind::While || kind == NodeKind::Forn;
+}
+
+// Operators over ints whose result is an int again
+bool IntOperator(NodeKind kind, TokenType op) {
+    if (kind == NodeKind::UnaryOperator) return op == TokenType::MINUS || op == TokenType::BANG;
+    switch (op) {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::ASTERISK:
+        case TokenType::SLASH:
+        case TokenType::LT:
+        case TokenType::GT:
+        case TokenType::LTE:
+        case TokenType::GTE:
+        case TokenType::EQ:
+        case TokenType::NOT_EQ:
+        case TokenType::AND:
+        case TokenType::OR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// What a loop body does, by variable name
+struct Effects {
+    std::unordered_set<Symbol> reads, writes, declares;
+    bool io = false;            // prints or reads input
+    bool returns = false;
+    bool calls = false;         // a function that isn't const
+    bool mayNotFinish = false;  // loops, divides or calls anything
+
+    bool mentions(Symbol name) const {
+        return reads.count(name) || writes.count(name) || declares.count(name);
+    }
+};
+
+class LoopOptimizer {
+public:
+    LoopOptimizer(AST& tree, Interner& symbols) : tree(tree), symbols(symbols) {}
+
+    bool Run() {
+        resolve();
+        findConstFunctions();
+        for (int block : blocksInnermostFirst()) optimizeBlock(block);
+        return changed;
+    }
+
+private:
+    // Calls f on every node under root (root included), parents first
+    template <typename F>
+    void forEach(int root, F f) {
+        std::vector<int> stack = {root};
+        while (!stack.empty()) {
+            int node = stack.back();
+            stack.pop_back();
+            f(node);
+            ChildRange children = tree.Children(node);
+            for (size_t i = children.size(); i-- > 0;) stack.push_back(children[i]);
+        }
+    }
+
+    bool isCallee(int node) const {
+        int p = parent[node];
+        return p >= 0 && tree[p].kind == NodeKind::FunctionCall && tree.Children(p)[0] == node;
+    }
+
+    int add(const ASTNode& node, int parentNode) {
+        int index = tree.Add();
+        tree[index] = node;
+        parent.push_back(parentNode);
+        size.push_back(1);
+        type.push_back(TokenType::ILLEGAL);
+        local.push_back(false);
+        return index;
+    }
+
+    // Records each node's parent, and for each variable mention the type it
+    // was declared with and whether that declaration is inside the function
+    // the mention is in. Undeclared names (the preamble's) stay ILLEGAL.
+    void resolve() {
+        parent.assign(tree.size(), -1);
+        size.assign(tree.size(), 1);
+        type.assign(tree.size(), TokenType::ILLEGAL);
+        local.assign(tree.size(), false);
+        struct Binding {
+            TokenType type = TokenType::ILLEGAL;
+            size_t depth = 0;  // undo size when it was bound
+        };
+        struct Shadowed {
+            Symbol name;
+            Binding previous;
+        };
+        std::vector<Binding> bound(symbols.Size());
+        std::vector<Shadowed> undo;
+        std::vector<size_t> scopes;
+        size_t functionStart = SIZE_MAX;
+
+        std::vector<int> stack = {0};
+        while (!stack.empty()) {
+            int item = stack.back();
+            stack.pop_back();
+            if (item >= 0) {
+                if (OpensScope(tree[item].kind)) scopes.push_back(undo.size());
+                if (tree[item].kind == NodeKind::Function) functionStart = undo.size();
+                stack.push_back(~item);
+                ChildRange children = tree.Children(item);
+                for (size_t i = children.size(); i-- > 0;) {
+                    parent[children[i]] = item;
+                    stack.push_back(children[i]);
+                }
+                continue;
+            }
+            int node = ~item;
+            if (parent[node] >= 0) size[parent[node]] += size[node];
+            Symbol name = tree[node].name;
+            switch (tree[node].kind) {
+                case NodeKind::Declaration:
+                    if (name < bound.size()) {
+                        undo.push_back({name, bound[name]});
+                        bound[name] = {tree[node].varType, undo.size()};
+                    }
+                    break;
+                case NodeKind::Identifier:
+                    if (name < bound.size() && !isCallee(node)) {
+                        type[node] = bound[name].type;
+                        local[node] = bound[name].type != TokenType::ILLEGAL &&
+                                      bound[name].depth > functionStart;
+                    }
+                    break;
+                case NodeKind::Function:
+                    functionStart = SIZE_MAX;
+                    break;
+                default:
+                    break;
+            }
+            if (!OpensScope(tree[node].kind)) continue;
+            for (size_t i = undo.size(); i-- > scopes.back();) bound[undo[i].name] = undo[i].previous;
+            undo.resize(scopes.back());
+            scopes.pop_back();
+        }
+    }
+
+    // A function is const if it does no I/O, mentions no variable but
+    // its parameters and locals, and only calls const functions, so a call
+    // to it with the same arguments always gives the same value.
+    void findConstFunctions() {
+        std::unordered_map<Symbol, std::vector<Symbol>> callees;
+        for (int top : tree.Children(0)) {
+            if (tree[top].kind != NodeKind::Function) continue;
+            Symbol name = tree[top].name;
+            bool pure = !functions.count(name);  // overloads: give up
+            functions[name] = {tree[top].varType, false};
+            forEach(top, [&](int node) {
+                switch (tree[node].kind) {
+                    case NodeKind::Cout:
+                    case NodeKind::Cin:
+                        pure = false;
+                        break;
+                    case NodeKind::Identifier:
+                        if (!isCallee(node) && !local[node]) pure = false;
+                        break;
+                    case NodeKind::FunctionCall:
+                        callees[name].push_back(tree[tree.Children(node)[0]].name);
+                        break;
+                    default:
+                        break;
+                }
+            });
+            functions[name].isConst = pure;
+        }
+        for (bool again = true; again;) {
+            again = false;
+            for (auto& entry : functions) {
+                if (!entry.second.isConst) continue;
+                for (Symbol callee : callees[entry.first]) {
+                    auto it = functions.find(callee);
+                    if (it != functions.end() && it->second.isConst) continue;
+                    entry.second.isConst = false;
+                    again = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    bool constCall(int call) const {
+        auto it = functions.find(tree[tree.Children(call)[0]].name);
+        return it != functions.end() && it->second.isConst;
+    }
+
+    std::vector<int> blocksInnermostFirst() {
+        std::vector<int> blocks;
+        forEach(0, [&](int node) {
+            if (tree[node].kind == NodeKind::Block) blocks.push_back(node);
+        });
+        return std::vector<int>(blocks.rbegin(), blocks.rend());
+    }
+
+    void optimizeBlock(int block) {
+        ChildRange children = tree.Children(block);
+        std::vector<int> statements(children.begin(), children.end());
+        bool edited = false;
+
+        std::vector<int> fused;
+        for (int statement : statements) {
+            if (!fused.empty() && tryFuse(fused.back(), statement)) {
+                edited = true;
+                continue;
+            }
+            fused.push_back(statement);
+        }
+
+        std::vector<int> result;
+        for (int statement : fused) {
+            if (!IsLoop(tree[statement].kind)) {
+                result.push_back(statement);
+                continue;
+            }
+            size_t before = result.size();
+            hoist(statement, block, result);
+            if (result.size() != before) edited = true;
+            if (unroll(statement, result)) {
+                edited = true;
+                continue;
+            }
+            result.push_back(statement);
+        }
+        if (!edited) return;
+        tree.SetChildren(block, result);
+        for (int statement : result) parent[statement] = block;
+        changed = true;
+    }
+
+    Effects effectsOf(int root) {
+        Effects e;
+        forEach(root, [&](int node) {
+            const ASTNode& n = tree[node];
+            switch (n.kind) {
+                case NodeKind::Declaration:
+                    e.declares.insert(n.name);
+                    break;
+                case NodeKind::Identifier:
+                    if (isCallee(node)) break;
+                    if (n.childCount > 0) e.writes.insert(n.name);
+                    else e.reads.insert(n.name);
+                    break;
+                case NodeKind::PostfixOperator:
+                    for (int operand : tree.Children(node)) e.writes.insert(tree[operand].name);
+                    break;
+                case NodeKind::Cout:
+                    e.io = true;
+                    break;
+                case NodeKind::Cin:
+                    e.io = true;
+                    for (int operand : tree.Children(node)) e.writes.insert(tree[operand].name);
+                    break;
+                case NodeKind::Return:
+                    e.returns = true;
+                    break;
+                case NodeKind::FunctionCall:
+                    if (!constCall(node)) e.calls = true;
+                    e.mayNotFinish = true;
+                    break;
+                case NodeKind::For:
+                case NodeKind::Forn:
+                case NodeKind::While:
+                    e.mayNotFinish = true;
+                    break;
+                case NodeKind::BinaryOperator:
+                    if (n.op == TokenType::SLASH) e.mayNotFinish = true;
+                    break;
+                default:
+                    break;
+            }
+        });
+        return e;
+    }
+
+    // Bounds are fused only when they are the same literal or the same int
+    // variable, which neither loop changes.
+    bool sameBound(int a, int b, const Effects& first, const Effects& second) const {
+        const ASTNode& x = tree[a];
+        const ASTNode& y = tree[b];
+        if (x.kind != y.kind || x.name != y.name || x.childCount || y.childCount) return false;
+        if (x.kind == NodeKind::IntLiteral) return true;
+        if (x.kind != NodeKind::Identifier || type[a] != TokenType::INT || type[b] != TokenType::INT) {
+            return false;
+        }
+        if (first.writes.count(x.name) || second.writes.count(x.name) ||
+            first.declares.count(x.name) || second.declares.count(x.name)) {
+            return false;
+        }
+        return local[a] || !(first.calls || second.calls);
+    }
+
+    // Moves the body of forn b into forn a, if running both bodies per
+    // iteration gives what running all of a and then all of b did.
+    bool tryFuse(int a, int b) {
+        if (tree[a].kind != NodeKind::Forn || tree[b].kind != NodeKind::Forn) return false;
+        ChildRange first = tree.Children(a);
+        ChildRange second = tree.Children(b);
+        if (first.size() != 3 || second.size() != 3) return false;
+        int bodyA = first[2], bodyB = second[2];
+        if (size[bodyA] + size[bodyB] > LoopPass::kMaxLoopNodes) return false;
+        Symbol varA = tree[first[0]].name, varB = tree[second[0]].name;
+
+        Effects ea = effectsOf(bodyA);
+        Effects eb = effectsOf(bodyB);
+        if (!sameBound(first[1], second[1], ea, eb)) return false;
+        if (ea.returns || eb.returns || ea.calls || eb.calls) return false;
+        // Output has to come out the same even if the other body never
+        // gets past some iteration
+        if ((ea.io && (eb.io || eb.mayNotFinish)) || (eb.io && ea.mayNotFinish)) return false;
+        if (ea.writes.count(varA) || ea.declares.count(varA) ||
+            eb.writes.count(varB) || eb.declares.count(varB)) {
+            return false;
+        }
+        if (varA != varB && eb.mentions(varA)) return false;
+        for (Symbol name : ea.writes) {
+            if (eb.reads.count(name) || eb.writes.count(name)) return false;
+        }
+        for (Symbol name : eb.writes) {
+            if (ea.reads.count(name)) return false;
+        }
+        for (Symbol name : ea.declares) {
+            if (eb.mentions(name)) return false;
+        }
+        for (Symbol name : eb.declares) {
+            if (ea.mentions(name)) return false;
+        }
+
+        if (varA != varB) {
+            forEach(bodyB, [&](int node) {
+                if (tree[node].kind == NodeKind::Identifier && tree[node].name == varB && !isCallee(node)) {
+                    tree[node].name = varA;
+                }
+            });
+        }
+        ChildRange statementsA = tree.Children(bodyA);
+        ChildRange statementsB = tree.Children(bodyB);
+        std::vector<int> body(statementsA.begin(), statementsA.end());
+        body.insert(body.end(), statementsB.begin(), statementsB.end());
+        tree.SetChildren(bodyA, body);
+        for (int statement : body) parent[statement] = bodyA;
+        size[bodyA] += size[bodyB];
+        return true;
+    }
+
+    // Sets inv.once for each node under loop that computes the same int
+    // every time the loop evaluates it, and inv.anywhere if it also can't
+    // trap (no division, no calls), so it may be computed even where the loop
+    // wouldn't. Entries for nodes elsewhere are left from earlier loops.
+    void invariance(int loop) {
+        Effects e = effectsOf(loop);
+        if (inv.once.size() < tree.size()) {
+            inv.once.resize(tree.size());
+            inv.anywhere.resize(tree.size());
+        }
+        std::vector<int> order;
+        forEach(loop, [&](int node) { order.push_back(node); });
+        for (size_t i = order.size(); i-- > 0;) {
+            int node = order[i];
+            const ASTNode& n = tree[node];
+            ChildRange children = tree.Children(node);
+            bool once = false, anywhere = false;
+            switch (n.kind) {
+                case NodeKind::IntLiteral:
+                    once = anywhere = intLiteral(node);
+                    break;
+                case NodeKind::Identifier:
+                    once = anywhere = n.childCount == 0 && !isCallee(node) &&
+                                      type[node] == TokenType::INT &&
+                                      !e.writes.count(n.name) && !e.declares.count(n.name) &&
+                                      (local[node] || !e.calls);
+                    break;
+                case NodeKind::UnaryOperator:
+                case NodeKind::BinaryOperator:
+                    if (!IntOperator(n.kind, n.op)) break;
+                    once = anywhere = true;
+                    for (int c : children) {
+                        once = once && inv.once[c];
+                        anywhere = anywhere && inv.anywhere[c];
+                    }
+                    if (n.op == TokenType::SLASH) anywhere = false;
+                    break;
+                case NodeKind::FunctionCall: {
+                    if (children.size() != 2) break;
+                    auto it = functions.find(tree[children[0]].name);
+                    if (it == functions.end() || !it->second.isConst ||
+                        it->second.returns != TokenType::INT) {
+                        break;
+                    }
+                    once = true;
+                    for (int argument : tree.Children(children[1])) once = once && inv.once[argument];
+                    break;
+                }
+                default:
+                    break;
+            }
+            inv.once[node] = once;
+            inv.anywhere[node] = anywhere;
+        }
+    }
+
+    // The parts of a loop evaluated every time the statement runs, before
+    // anything else in it: the forn bound, or a for / while condition.
+    // Returns -1 for the rest.
+    int header(int loop) const {
+        ChildRange children = tree.Children(loop);
+        switch (tree[loop].kind) {
+            case NodeKind::Forn: return children.size() == 3 ? children[1] : -1;
+            case NodeKind::For: return children.size() == 4 ? children[1] : -1;
+            case NodeKind::While: return children.size() == 2 ? children[0] : -1;
+            default: return -1;
+        }
+    }
+
+    // Declares each largest invariant expression of loop in a new local
+    // appended to before, and reads that local in its place.
+    void hoist(int loop, int block, std::vector<int>& before) {
+        if (size[loop] > LoopPass::kMaxLoopNodes) return;
+        invariance(loop);
+        int head = header(loop);
+        // A for's init runs before its condition; if it could print, a trap
+        // in the condition must still come after that.
+        bool headFirst = head >= 0;
+        if (headFirst && tree[loop].kind == NodeKind::For) {
+            Effects init = effectsOf(tree.Children(loop)[0]);
+            headFirst = !init.calls;
+        }
+        if (headFirst) headFirst = !effectsOf(head).calls;
+
+        // (node, whether every evaluation of the loop evaluates it)
+        std::vector<std::pair<int, bool>> stack;
+        ChildRange parts = tree.Children(loop);
+        for (size_t i = parts.size(); i-- > 0;) {
+            if (tree[loop].kind == NodeKind::Forn && i == 0) continue;
+            if (tree[loop].kind == NodeKind::For && i == 0) continue;
+            stack.push_back({parts[i], headFirst && parts[i] == head});
+        }
+        while (!stack.empty()) {
+            auto [node, evaluated] = stack.back();
+            stack.pop_back();
+            const ASTNode& n = tree[node];
+            bool candidate = n.kind == NodeKind::BinaryOperator || n.kind == NodeKind::UnaryOperator ||
+                             n.kind == NodeKind::FunctionCall;
+            if (candidate && node < static_cast<int>(inv.once.size()) &&
+                (evaluated ? inv.once[node] : inv.anywhere[node])) {
+                before.push_back(hoistOut(node, loop, block));
+                continue;
+            }
+            ChildRange children = tree.Children(node);
+            switch (n.kind) {
+                // The condition runs whenever the IF does, a branch maybe not
+                case NodeKind::If:
+                    for (size_t i = children.size(); i-- > 1;) stack.push_back({children[i], false});
+                    if (!children.empty()) stack.push_back({children[0], evaluated});
+                    break;
+                case NodeKind::Cout:
+                case NodeKind::Cin:
+                case NodeKind::PostfixOperator:
+                    break;
+                case NodeKind::FunctionCall:
+                    if (children.size() == 2) {
+                        for (size_t i = tree.Children(children[1]).size(); i-- > 0;) {
+                            stack.push_back({tree.Children(children[1])[i], evaluated});
+                        }
+                    }
+                    break;
+                case NodeKind::BinaryOperator:
+                    if (children.size() == 2) {
+                        bool shortCircuit = n.op == TokenType::AND || n.op == TokenType::OR;
+                        stack.push_back({children[1], evaluated && !shortCircuit});
+                        stack.push_back({children[0], evaluated});
+                    }
+                    break;
+                case NodeKind::Forn:
+                    if (children.size() == 3) {
+                        stack.push_back({children[2], false});
+                        stack.push_back({children[1], false});
+                    }
+                    break;
+                default:
+                    for (size_t i = children.size(); i-- > 0;) stack.push_back({children[i], false});
+                    break;
+            }
+        }
+    }
+
+    // Replaces expression in its parent with a read of a fresh int local,
+    // and returns the declaration of that local
+    int hoistOut(int expression, int loop, int block) {
+        bool bound = tree[loop].kind == NodeKind::Forn && tree.Children(loop)[1] == expression;
+        Symbol name = fresh(bound ? "loop_bound" : "loop_inv");
+
+        ASTNode declaration;
+        declaration.kind = NodeKind::Declaration;
+        declaration.varType = TokenType::INT;
+        declaration.name = name;
+        int d = add(declaration, block);
+
+        ASTNode read;
+        read.kind = NodeKind::Identifier;
+        read.name = name;
+        int r = add(read, parent[expression]);
+        type[r] = TokenType::INT;
+        local[r] = true;
+
+        const ASTNode& p = tree[parent[expression]];
+        for (uint32_t i = 0; i < p.childCount; i++) {
+            int& edge = tree.edges[p.firstChild + i];
+            if (edge == expression) edge = r;
+        }
+        tree.SetChildren(d, {expression});
+        parent[expression] = d;
+        return d;
+    }
+
+    Symbol fresh(const char* prefix) {
+        std::string name;
+        do {
+            name = prefix + std::to_string(nextName++);
+        } while (symbols.Find(name) != Interner::kNone);
+        return symbols.Intern(name);
+    }
+
+    // Appends copies of the body of forn loop, one per iteration, to out
+    // instead of the loop, when its trip count is a small literal.
+    bool unroll(int loop, std::vector<int>& out) {
+        if (tree[loop].kind != NodeKind::Forn) return false;
+        ChildRange parts = tree.Children(loop);
+        if (parts.size() != 3 || !intLiteral(parts[1])) return false;
+        long long trips = std::strtoll(std::string(symbols.Name(tree[parts[1]].name)).c_str(), nullptr, 0);
+        if (trips < 0 || trips > LoopPass::kMaxUnrollTrips) return false;
+        Symbol var = tree[parts[0]].name;
+        int body = parts[2];
+
+        // Stops at the size limit, so a big body costs no more than a small one
+        size_t visited = 0;
+        std::vector<int> stack = {body};
+        while (!stack.empty()) {
+            if (++visited > LoopPass::kMaxUnrollNodes) return false;
+            int node = stack.back();
+            stack.pop_back();
+            const ASTNode& n = tree[node];
+            if (n.kind == NodeKind::Declaration && (n.name == var || parent[node] == body)) return false;
+            if (n.kind == NodeKind::Identifier && n.name == var && n.childCount > 0) return false;
+            if (n.kind == NodeKind::PostfixOperator || n.kind == NodeKind::Cout ||
+                n.kind == NodeKind::Cin) {
+                for (int operand : tree.Children(node)) {
+                    if (tree[operand].name == var) return false;
+                }
+            }
+            for (int child : tree.Children(node)) stack.push_back(child);
+        }
+
+        ChildRange statements = tree.Children(body);
+        std::vector<int> original(statements.begin(), statements.end());
+        for (long long k = 0; k < trips; k++) {
+            Symbol value = symbols.Intern(std::to_string(k));
+            for (int statement : original) out.push_back(copy(statement, var, value));
+        }
+        return true;
+    }
+
+    // Deep copy of root with each read of var turned into the literal value
+    int copy(int root, Symbol var, Symbol value) {
+        std::unordered_map<int, int> copyOf;
+        std::vector<int> order;
+        forEach(root, [&](int node) {
+            ASTNode n = tree[node];
+            if (n.kind == NodeKind::Identifier && n.name == var && n.childCount == 0 && !isCallee(node)) {
+                n.kind = NodeKind::IntLiteral;
+                n.name = value;
+            }
+            int p = node == root ? -1 : copyOf[parent[node]];
+            int c = add(n, p);
+            type[c] = n.kind == NodeKind::Identifier ? type[node] : TokenType::ILLEGAL;
+            local[c] = local[node];
+            copyOf[node] = c;
+            order.push_back(node);
+        });
+        std::vector<int> children;
+        for (int node : order) {
+            if (tree[node].childCount == 0) continue;
+            children.clear();
+            for (int child : tree.Children(node)) children.push_back(copyOf[child]);
+            tree.SetChildren(copyOf[node], children);
+        }
+        return copyOf[root];
+    }
+
+    // An int literal C++ reads as an int
+    bool intLiteral(int node) const {
+        if (tree[node].kind != NodeKind::IntLiteral || tree[node].name == Interner::kNone) return false;
+        std::string text(symbols.Name(tree[node].name));
+        if (text.empty() || text.size() > 24) return false;
+        char* end;
+        long long value = std::strtoll(text.c_str(), &end, 0);
+        return *end == '\0' && value > INT_MIN && value <= INT_MAX;
+    }
+
+    struct FunctionInfo {
+        TokenType returns = TokenType::ILLEGAL;
+        bool isConst = false;
+    };
+
+    struct Invariance {
+        std::vector<bool> once, anywhere;
+    };
+
+    AST& tree;
+    Interner& symbols;
+    bool changed = false;
+    int nextName = 0;
+    Invariance inv;
+    std::vector<int> parent;
+    std::vector<size_t> size;     // nodes under each, as parsed
+    std::vector<TokenType> type;  // of the variable an identifier names
+    std::vector<bool> local;      // declared in the identifier's function
+    std::unordered_map<Symbol, FunctionInfo> functions;
+};
+
+}  // namespace
+
+bool LoopPass::Run(AST& tree, Interner& symbols) {
+    if (tree.empty()) return false;
+    return LoopOptimizer(tree, symbols).Run();
+}
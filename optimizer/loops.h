@@ -0,0 +1,42 @@
+// loops.h
+
+#ifndef LOOPS_H
+#define LOOPS_H
+
+#include "../ast/pass.h"
+
+// Rewrites FOR, WHILE and FORN loops that are statements of a block:
+//
+//   - Adjacent forn loops over the same literal or unchanged variable bound
+//     are fused into one when neither can see the other's writes, neither
+//     returns or calls anything with side effects, and at most one does I/O.
+//   - A forn bound that is an expression is computed once into a local
+//     before the loop (`int loop_bound0 = f(n);`) instead of on every
+//     iteration, and so is any other int expression that can't change while
+//     the loop runs (`int loop_inv0 = (g * h);`). An expression is invariant
+//     if every variable it reads is an int the loop never assigns,
+//     increments or redeclares, and every call in it is to a function that
+//     only touches its own parameters and locals. Expressions the loop might
+//     not evaluate (the body, the update, the right side of && and ||) are
+//     only hoisted if they can't trap: no division and no calls.
+//   - A forn loop with a literal trip count of at most kMaxUnrollTrips and a
+//     body of at most kMaxUnrollNodes nodes that declares nothing at its top
+//     level is replaced by copies of its body, the loop variable read as
+//     0, 1, ... in each.
+//
+// Variables are resolved by scope, so a global or preamble variable (an
+// `ll`) is only treated as an int if it was declared in the source. Each
+// loop is analyzed over its whole subtree, so loops of more than
+// kMaxLoopNodes nodes are left alone; otherwise a deep nest of them would
+// take time quadratic in its depth.
+class LoopPass : public Pass {
+public:
+    static constexpr long long kMaxUnrollTrips = 4;
+    static constexpr size_t kMaxUnrollNodes = 40;
+    static constexpr size_t kMaxLoopNodes = 2048;
+
+    std::string_view Name() const override { return "loops"; }
+    bool Run(AST& tree, Interner& symbols) override;
+};
+
+#endif // LOOPS_H
@@ -0,0 +1,15 @@
+// passes.cpp
+
+#include "passes.h"
+#include "constant_fold.h"
+#include "dead_code.h"
+#include "loops.h"
+
+void AddStandardPasses(PassManager& passes, bool wholeProgram) {
+    passes.Add(std::make_unique<ConstantFoldPass>(wholeProgram));
+    passes.Add(std::make_unique<LoopPass>());
+    // again, for the loop variable reads unrolling turned into literals
+    passes.Add(std::make_unique<ConstantFoldPass>(wholeProgram));
+    // after folding, which leaves declarations whose reads it replaced unused
+    passes.Add(std::make_unique<DeadCodePass>(wholeProgram));
+}
@@ -0,0 +1,14 @@
+// passes.h
+
+#ifndef PASSES_H
+#define PASSES_H
+
+#include "../ast/pass.h"
+
+// The tree passes the translator runs between parsing and emission, in
+// order. wholeProgram is false when each tree is only one unit of a
+// program (TranslateStream), which rules out anything that has to see all
+// uses of a top-level name.
+void AddStandardPasses(PassManager& passes, bool wholeProgram = true);
+
+#endif // PASSES_H
@@ -0,0 +1,121 @@
+// parallel_parser.cpp
+
+#include "parallel_parser.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+bool IsFunctionStart(TokenType type, TokenType name, TokenType paren) {
+    if (name != TokenType::IDENT || paren != TokenType::LPAREN) return false;
+    switch (type) {
+    case TokenType::INT: case TokenType::FLOAT: case TokenType::CHAR:
+    case TokenType::BOOL: case TokenType::VARCHAR: case TokenType::VI:
+    case TokenType::VOID:
+        return true;
+    default:
+        return false;
+    }
+}
+
+std::vector<int> FindFunctionStarts(const TokenCursor& tokens) {
+    std::vector<int> starts;
+    int depth = 0;
+    for (int i = 0; i + 2 < tokens.Size(); i++) {
+        TokenType t = tokens.Type(i);
+        if (t == TokenType::LBRACE) {
+            depth++;
+        } else if (t == TokenType::RBRACE) {
+            // a stray '}' at the top is skipped by the parser, not matched
+            depth = std::max(0, depth - 1);
+        } else if (depth == 0 && IsFunctionStart(t, tokens.Type(i + 1), tokens.Type(i + 2))) {
+            starts.push_back(i);
+        }
+    }
+    return starts;
+}
+
+void ParseProgramParallel(Parser& parser, unsigned threads, size_t minChunkTokens) {
+    const TokenCursor& cursor = parser.cursor;
+    int size = cursor.Size();
+
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (minChunkTokens == 0) minChunkTokens = 1;
+    // a few chunks per worker so a slow chunk doesn't hold up the rest
+    size_t chunks = std::min<size_t>(4 * threads, size / minChunkTokens);
+
+    if (chunks < 2 || parser.idx != 0) {
+        parser.parseProgram();
+        return;
+    }
+
+    // Chunk boundaries at the first function start past each even split,
+    // so every chunk holds whole functions. Anything before the first
+    // function stays in chunk 0.
+    std::vector<int> starts = FindFunctionStarts(cursor);
+    std::vector<int> boundaries = {0};
+    size_t step = size / chunks;
+    auto next = starts.begin();
+    for (size_t i = 1; i < chunks; i++) {
+        next = std::lower_bound(next, starts.end(), static_cast<int>(i * step));
+        if (next == starts.end()) break;
+        if (*next > boundaries.back()) boundaries.push_back(*next);
+    }
+    boundaries.push_back(size);
+    size_t count = boundaries.size() - 1;
+    if (count < 2) {
+        parser.parseProgram();
+        return;
+    }
+
+    struct Part {
+        std::unique_ptr<Parser> parser;
+        std::vector<int> roots;
+    };
+    std::vector<Part> parts(count);
+    std::atomic<size_t> nextChunk(0);
+    auto worker = [&]() {
+        for (size_t c = nextChunk++; c < count; c = nextChunk++) {
+            Part& part = parts[c];
+            part.parser = std::make_unique<Parser>(cursor);
+            part.parser->idx = boundaries[c];
+            part.parser->parseTopLevel(boundaries[c + 1], part.roots);
+            part.parser->nodes.Finish();
+        }
+    };
+
+    std::vector<std::thread> pool;
+    size_t workers = std::min<size_t>(threads, count);
+    for (size_t i = 1; i < workers; i++) {
+        pool.emplace_back(worker);
+    }
+    worker();  // the calling thread works too
+    for (std::thread& t : pool) {
+        t.join();
+    }
+
+    // The serial parser reaches each boundary at the top level only if the
+    // chunk before it ended exactly there (the last one runs into EOF).
+    for (size_t c = 0; c + 1 < count; c++) {
+        if (parts[c].parser->idx != boundaries[c + 1]) {
+            parser.parseProgram();
+            return;
+        }
+    }
+
+    parser.nodes.clear();
+    int program = parser.createNode();
+    parser.nodes[program].kind = NodeKind::Program;
+
+    for (Part& part : parts) {
+        int offset = parser.nodes.Append(part.parser->nodes);
+        for (int root : part.roots) parser.nodes.AddChild(program, root + offset);
+        for (std::string& error : part.parser->errors) {
+            parser.errors.push_back(std::move(error));
+        }
+        parser.idx = part.parser->idx;
+        part.parser.reset();
+    }
+    parser.nodes.Finish();
+}
@@ -0,0 +1,34 @@
+#ifndef PARALLEL_PARSER_H
+#define PARALLEL_PARSER_H
+
+#include <cstddef>
+#include <vector>
+#include "parser.h"
+
+// Parallel front end for programs made of many top-level functions. A
+// brace-matching pre-pass over the tokens finds where each function starts,
+// runs of whole functions are parsed on a pool of worker threads, each into
+// its own node arena, and the arenas are concatenated under PROGRAM with
+// their child indices shifted. The nodes and errors are identical to
+// Parser::parseProgram.
+//
+// A chunk is only trusted if its parse ends exactly where the next one
+// starts; otherwise (unbalanced braces, a function that doesn't close) the
+// program is parsed again serially. Programs under a couple of chunks are
+// simply parsed on the calling thread.
+
+constexpr size_t kMinChunkTokens = 1 << 16;
+
+// True for the three tokens that open a function definition: a type, an
+// identifier and '('. Only meaningful at brace depth 0.
+bool IsFunctionStart(TokenType type, TokenType name, TokenType paren);
+
+// Token indices where a top-level function definition starts (a type, an
+// identifier and '(' at brace depth 0), ascending.
+std::vector<int> FindFunctionStarts(const TokenCursor& tokens);
+
+// threads == 0 uses one worker per hardware thread.
+void ParseProgramParallel(Parser& parser, unsigned threads = 0,
+                          size_t minChunkTokens = kMinChunkTokens);
+
+#endif // PARALLEL_PARSER_H
@@ -1,36 +1,148 @@
 // parser.cpp
 
 #include "parser.h"
-#include <unordered_map>
+#include <array>
 #include <queue>
 #include <iostream>
 using namespace std;
 
+// Dispatch tables indexed by TokenType, built at compile time. Picking the
+// statement parser for a leading token, or the prefix/infix handler and
+// binding power for an expression token, is a single indexed load.
+namespace {
+
+constexpr size_t kTokenTypes = static_cast<size_t>(TokenType::VOID) + 1;
+
+constexpr size_t Index(TokenType t) { return static_cast<size_t>(t); }
+
+using StatementFn = int (Parser::*)();
+using PrefixFn = int (Parser::*)();
+using InfixFn = int (Parser::*)(int);
+
+// Pratt rule for one token type: how it starts an expression, how it
+// continues one, and how tightly it binds on each side. Binary operators are
+// left-associative, so the right side binds one level tighter.
+struct ExpressionRule {
+    PrefixFn prefix = nullptr;
+    InfixFn infix = nullptr;
+    int leftPower = 0;
+    int rightPower = 0;
+};
+
+constexpr std::array<ExpressionRule, kTokenTypes> MakeExpressionRules() {
+    std::array<ExpressionRule, kTokenTypes> rules{};
+
+    rules[Index(TokenType::IDENT)].prefix = &Parser::parseIdentifier;
+    for (TokenType t : {TokenType::INT_LITERAL, TokenType::FLOAT_LITERAL, TokenType::STRING_LITERAL,
+                        TokenType::CHAR_LITERAL, TokenType::BOOLEAN_LITERAL}) {
+        rules[Index(t)].prefix = &Parser::parseLiteral;
+    }
+    rules[Index(TokenType::LPAREN)].prefix = &Parser::parseGroupedExpression;
+    rules[Index(TokenType::MINUS)].prefix = &Parser::parsePrefixExpression;
+    rules[Index(TokenType::BANG)].prefix = &Parser::parsePrefixExpression;
+
+    auto binary = [&rules](TokenType t, Parser::Precedence power) {
+        rules[Index(t)].infix = &Parser::parseInfixExpression;
+        rules[Index(t)].leftPower = power;
+        rules[Index(t)].rightPower = power + 1;
+    };
+    binary(TokenType::OR, Parser::OR);
+    binary(TokenType::AND, Parser::AND);
+    binary(TokenType::EQ, Parser::EQUALS);
+    binary(TokenType::NOT_EQ, Parser::EQUALS);
+    binary(TokenType::LT, Parser::LESSGREATER);
+    binary(TokenType::LTE, Parser::LESSGREATER);
+    binary(TokenType::GT, Parser::LESSGREATER);
+    binary(TokenType::GTE, Parser::LESSGREATER);
+    binary(TokenType::PLUS, Parser::SUM);
+    binary(TokenType::MINUS, Parser::SUM);
+    binary(TokenType::ASTERISK, Parser::PRODUCT);
+    binary(TokenType::SLASH, Parser::PRODUCT);
+    return rules;
+}
+
+constexpr std::array<ExpressionRule, kTokenTypes> kExpressionRules = MakeExpressionRules();
+
+// Statement parser by leading token; null means the token cannot start a
+// statement and is skipped.
+constexpr std::array<StatementFn, kTokenTypes> MakeStatementRules() {
+    std::array<StatementFn, kTokenTypes> rules{};
+
+    for (TokenType t : {TokenType::INT, TokenType::FLOAT, TokenType::CHAR, TokenType::BOOL,
+                        TokenType::VARCHAR, TokenType::VI, TokenType::VOID}) {
+        rules[Index(t)] = &Parser::parseTypeLedStatement;
+    }
+    rules[Index(TokenType::IDENT)] = &Parser::parseIdentLedStatement;
+    rules[Index(TokenType::RETURN)] = &Parser::parseReturnStatement;
+    rules[Index(TokenType::FOR)] = &Parser::parseForLoop;
+    rules[Index(TokenType::FORN)] = &Parser::parseFornLoop;
+    rules[Index(TokenType::WHILE)] = &Parser::parseWhileLoop;
+    rules[Index(TokenType::IF)] = &Parser::parseIfStatement;
+    rules[Index(TokenType::COUT)] = &Parser::parseCout;
+    rules[Index(TokenType::CIN)] = &Parser::parseCin;
+    rules[Index(TokenType::LBRACE)] = &Parser::parseBlock;
+    for (TokenType t : {TokenType::INT_LITERAL, TokenType::FLOAT_LITERAL, TokenType::STRING_LITERAL,
+                        TokenType::CHAR_LITERAL, TokenType::BOOLEAN_LITERAL}) {
+        rules[Index(t)] = &Parser::parseExpressionStatement;
+    }
+    return rules;
+}
+
+constexpr std::array<StatementFn, kTokenTypes> kStatementRules = MakeStatementRules();
+
+}  // namespace
+
 // // Constructor
-Parser::Parser(std::vector<Token> t) 
+Parser::Parser(TokenBuffer t)
+    : tokens(std::move(t)), nodes(tokens.SessionArena()),
+      blockStack(tokens.SessionArena()), expressionStack(tokens.SessionArena())
 {
 
     idx = 0;
-    tokens = t;
+    cursor = TokenCursor(tokens);
 }
 
-void Parser::dfs(int cur, int depth) {
+Parser::Parser(const TokenCursor& shared)
+    : idx(0), cursor(shared)
+{
+}
 
-    for(int i = 0; i < depth; i++) {
-        cout << "|";
-        if(i < depth-1) cout << "  ";
-    }
+std::string_view Parser::nodeName(int cur) const {
+    const ASTNode& node = nodes[cur];
+    if(node.name != Interner::kNone) return tokens.Names().Name(node.name);
+    if(IsListKind(node.kind)) return NodeKindName(node.kind);
+    return TokenText(node.op);
+}
 
-    if(depth) cout << "--";
-    
-    if(nodes[cur].type.size()) cout << nodes[cur].type << ' ';
-    else cout << "- ";
-    if(nodes[cur].varType.size()) cout << nodes[cur].varType << ' ';
-    else cout << "- ";
+// Preorder walk on printStack; children are pushed in reverse so they pop
+// in order.
+void Parser::dfs(int root, int rootDepth) {
+    printStack.clear();
+    printStack.push_back({root, rootDepth});
+
+    while(!printStack.empty()) {
+        int cur = printStack.back().first;
+        int depth = printStack.back().second;
+        printStack.pop_back();
+
+        for(int i = 0; i < depth; i++) {
+            cout << "|";
+            if(i < depth-1) cout << "  ";
+        }
+
+        if(depth) cout << "--";
+
+        NodeKind kind = nodes[cur].kind;
+        if(kind != NodeKind::None && !IsListKind(kind)) cout << NodeKindName(kind) << ' ';
+        else cout << "- ";
+        if(nodes[cur].varType != TokenType::ILLEGAL) cout << TokenText(nodes[cur].varType) << ' ';
+        else cout << "- ";
 
-    cout <<  nodes[cur].name << '\n';
-    for(int z : nodes[cur].children) {
-        dfs(z, depth+1);
+        cout <<  nodeName(cur) << '\n';
+        ChildRange children = nodes.Children(cur);
+        for(size_t i = children.size(); i-- > 0; ) {
+            printStack.push_back({children[i], depth+1});
+        }
     }
 }
 
@@ -41,8 +153,7 @@ void Parser::printNodes() {
 }
 
 int Parser::createNode() {
-    nodes.push_back({"", "", {}});
-    return nodes.size()-1;
+    return nodes.Add();
 }
 
 // Errors function moved to parser.h now 
@@ -51,12 +162,21 @@ int Parser::createNode() {
 void Parser::parseProgram() {
     nodes.clear();
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "PROGRAM";
+    nodes[nodeIdx].kind = NodeKind::Program;
 
-    while (!curTokenIs(TokenType::EOF_TOKEN)) {
+    std::vector<int> roots;
+    parseTopLevel(cursor.Size(), roots);
+    for (int root : roots) {
+        nodes.AddChild(nodeIdx, root);
+    }
+    nodes.Finish();
+}
+
+void Parser::parseTopLevel(int end, std::vector<int>& roots) {
+    while (idx < end && !curTokenIs(TokenType::EOF_TOKEN)) {
         int stmt = parseStatement();
         if (stmt != -1) {
-            nodes[nodeIdx].children.push_back(stmt);
+            roots.push_back(stmt);
         }
         else {
             nextToken();
@@ -69,41 +189,32 @@ int Parser::parseFunction() {
     bool valid = true;
     int nodeIdx = createNode();
 
-    nodes[nodeIdx].type = "FUNCTION";
+    nodes[nodeIdx].kind = NodeKind::Function;
 
     valid &= readTokenType();
     valid &= readToken(TokenType::IDENT);
     if(valid) {
-        nodes[nodeIdx].varType = tokens[idx-2].literal;
-        nodes[nodeIdx].name = tokens[idx-1].literal;
+        nodes[nodeIdx].varType = cursor.Type(idx-2);
+        nodes[nodeIdx].name = cursor.SymbolAt(idx-1);
     }
     valid &= readToken(TokenType::LPAREN);
 
     int ret = parseArguments();
     if(ret == -1) return -1;
     else {
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     }
     valid &= readToken(TokenType::RPAREN);
     valid &= readToken(TokenType::LBRACE);
 
-    ret = parseBlock();
-    if(ret == -1) return -1;
-    else {
-        nodes[nodeIdx].children.push_back(ret);
-    }
-    valid &= readToken(TokenType::RBRACE);
-
-    if(!valid) return -1;
-    return nodeIdx;
-
+    return openBlock(Construct::Function, nodeIdx, valid);
 }
 
 int Parser::parseArguments() {
     bool valid = true;
 
     int nodeIdx = createNode();
-    nodes[nodeIdx].name = "PARAMS";
+    nodes[nodeIdx].kind = NodeKind::Params;
 
     while(true) {
         if(curTokenIs(TokenType::RPAREN)) break;
@@ -111,10 +222,10 @@ int Parser::parseArguments() {
         valid &= readToken(TokenType::IDENT);
         if(!valid) return -1;
         int childIdx = createNode();
-        nodes[nodeIdx].children.push_back(childIdx);
-        nodes[childIdx].type = "DECLARATION";
-        nodes[childIdx].varType = tokens[idx-2].literal;
-        nodes[childIdx].name = tokens[idx-1].literal;        
+        nodes.AddChild(nodeIdx, childIdx);
+        nodes[childIdx].kind = NodeKind::Declaration;
+        nodes[childIdx].varType = cursor.Type(idx-2);
+        nodes[childIdx].name = cursor.SymbolAt(idx-1);
         valid &= curTokenIs(TokenType::COMMA);
         if (valid) {
             nextToken();
@@ -133,31 +244,31 @@ int Parser::parseArguments() {
 void Parser::nextToken() { idx++;}
 
 Token Parser::curToken() {
-    if(idx >= (int)tokens.size()) idx = tokens.size()-1;
-    return tokens[idx];
+    if(idx >= cursor.Size()) idx = cursor.Size()-1;
+    return Token(cursor.Type(idx), cursor.Literal(idx));
 }
 
 bool Parser::curTokenIs(TokenType t) {
-    if(idx >= (int)tokens.size()) idx = tokens.size()-1;
+    if(idx >= cursor.Size()) idx = cursor.Size()-1;
 
-    return tokens[idx].type == t;
+    return cursor.Type(idx) == t;
 }
 
 bool Parser::readToken(TokenType t) {
-    if(idx >= (int)tokens.size()) idx = tokens.size()-1;
-    if(tokens[idx].type == t) {
+    if(idx >= cursor.Size()) idx = cursor.Size()-1;
+    if(cursor.Type(idx) == t) {
         idx++;
         return true;
     }
     std::string msg = "Unexpected Token Error: Expected " + TokenTypeToString(t) 
-                      + ", got " + TokenTypeToString(tokens[idx].type) + " instead at index " + to_string(idx);
+                      + ", got " + TokenTypeToString(cursor.Type(idx)) + " instead at index " + to_string(indexBase + idx);
     errors.push_back(msg);
     return false;
 }
 
 bool Parser::readTokenType() {
-    if(idx >= (int)tokens.size()) idx = tokens.size()-1;
-    if(isType(tokens[idx].type)) {
+    if(idx >= cursor.Size()) idx = cursor.Size()-1;
+    if(isType(cursor.Type(idx))) {
         idx++;
         return true;
     }
@@ -165,16 +276,16 @@ bool Parser::readTokenType() {
 }
 
 bool Parser::isTokenType() {
-    if(idx >= (int)tokens.size()) idx = tokens.size()-1;
-    if(isType(tokens[idx].type)) {
+    if(idx >= cursor.Size()) idx = cursor.Size()-1;
+    if(isType(cursor.Type(idx))) {
         return true;
     }
     return false;
 }
 
 bool Parser::peekTokenIs(TokenType t){
-    if (idx + 1 >= (int)tokens.size()) return false;
-    return tokens[idx + 1].type == t;
+    if (idx + 1 >= cursor.Size()) return false;
+    return cursor.Type(idx + 1) == t;
 }
 bool Parser::expectPeek(TokenType t) {
     if (peekTokenIs(t)) {
@@ -187,7 +298,7 @@ bool Parser::expectPeek(TokenType t) {
 }
 void Parser::peekError(TokenType t) {
     std::string msg = "Unexpected Token Error: Expected " + TokenTypeToString(t) 
-                      + ", got " + TokenTypeToString(tokens[idx + 1].type) + " instead";
+                      + ", got " + TokenTypeToString(cursor.Type(idx + 1)) + " instead";
     errors.push_back(msg);
 }
 
@@ -198,7 +309,7 @@ bool Parser::isType(TokenType t) const {
 }
 
 bool Parser::isAssignmentStatement()  {
-    return curTokenIs(TokenType::IDENT) && idx + 1 < tokens.size() && tokens[idx+1].type == TokenType::ASSIGN;
+    return curTokenIs(TokenType::IDENT) && idx + 1 < cursor.Size() && cursor.Type(idx+1) == TokenType::ASSIGN;
 }
 
 bool Parser::isExpressionStatement() {
@@ -207,88 +318,109 @@ bool Parser::isExpressionStatement() {
            curTokenIs(TokenType::STRING_LITERAL) || curTokenIs(TokenType::CHAR_LITERAL) || curTokenIs(TokenType::BOOLEAN_LITERAL);
 }
 
+// A bare { ... } statement
 int Parser::parseBlock() {
-    int nodeIdx = createNode();
-    nodes[nodeIdx].name = "CODE BLOCK";
-
-    while (!curTokenIs(TokenType::RBRACE) && !curTokenIs(TokenType::EOF_TOKEN)) {
-        int stmt = parseStatement();
-        if (stmt != -1) nodes[nodeIdx].children.push_back(stmt);
-        else return -1;
+    if (!readToken(TokenType::LBRACE)) {
+        return -1;
     }
-
-    return nodeIdx;
+    return openBlock(Construct::Block, -1);
 }
 
 // Parsing methods
 int Parser::parseStatement() {
-    if (isTokenType() && peekTokenIs(TokenType::IDENT) && idx + 2 < tokens.size() && tokens[idx + 2].type == TokenType::LPAREN) {
-    return parseFunction();
-    } else if (isTokenType()) {
-        return parseVariableDeclaration();
-    } else if (isAssignmentStatement()) {
-        return parseAssignmentStatement();
-    }
-     else if (curTokenIs(TokenType::RETURN)) {
-        return parseReturnStatement();
-    }
-    else if (curTokenIs(TokenType::FOR)) {
-        return parseForLoop();
-    } else if (curTokenIs(TokenType::FORN)) {
-        return parseFornLoop();
-    }
-        else if (curTokenIs(TokenType::WHILE)) {
-        return parseWhileLoop();
-    }
-     else if (curTokenIs(TokenType::IF)) {
-        return parseIfStatement();
-    } 
-    else if (curTokenIs(TokenType::COUT)){
-        return parseCout();
+    size_t base = blockStack.size();
+    int stmt = beginStatement();
+
+    // Each iteration either starts the next statement of the innermost open
+    // block or closes that block at its '}'.
+    while (true) {
+        if (stmt == -1) {
+            // a failure anywhere fails the whole outer statement
+            blockStack.resize(base);
+            return -1;
+        }
+        if (stmt != kOpen) {
+            if (blockStack.size() == base) return stmt;
+            nodes.AddChild(blockStack.back().block, stmt);
+        }
+
+        if (curTokenIs(TokenType::RBRACE) || curTokenIs(TokenType::EOF_TOKEN)) {
+            stmt = closeBlock();
+        } else {
+            stmt = beginStatement();
+        }
     }
-    else if (curTokenIs(TokenType::LBRACE)) {
-        return parseBlock();
-    } else if (isExpressionStatement()) {
-        return parseExpressionStatement();
-    } 
-    else {
+}
+
+int Parser::beginStatement() {
+    StatementFn parse = kStatementRules[Index(curToken().type)];
+    if (!parse) {
         nextToken();
         return -1;
     }
+    return (this->*parse)();
 }
 
-int Parser::getPrecedence(TokenType type) {
-    auto it = precedences.find(type);
-    if (it != precedences.end()) {
-        return it->second;
+// Starts the CODE BLOCK of construct; its statements are parsed by the
+// parseStatement loop.
+int Parser::openBlock(Construct construct, int node, bool valid) {
+    int block = createNode();
+    nodes[block].kind = NodeKind::Block;
+    blockStack.push_back({construct, node, block, valid});
+    return kOpen;
+}
+
+// Called at the '}' (or EOF) that ends the innermost block. Returns the
+// finished construct, or kOpen when an if continues with its else block.
+int Parser::closeBlock() {
+    BlockFrame frame = blockStack.back();
+    blockStack.pop_back();
+
+    if (frame.construct != Construct::Block) {
+        nodes.AddChild(frame.node, frame.block);
     }
-    return Precedence::LOWEST;
+    if (!readToken(TokenType::RBRACE)) {
+        return -1;
+    }
+
+    if (frame.construct == Construct::If && curTokenIs(TokenType::ELSE)) {
+        nextToken();
+        if (!readToken(TokenType::LBRACE)) {
+            return -1;
+        }
+        return openBlock(Construct::Else, frame.node);
+    }
+    if (frame.construct == Construct::Block) return frame.block;
+    if (!frame.valid) return -1;
+    return frame.node;
 }
 
-bool Parser::isBinaryOperator(TokenType type) {
-    return type == TokenType::PLUS || type == TokenType::MINUS ||
-           type == TokenType::ASTERISK || type == TokenType::SLASH;
+int Parser::parseTypeLedStatement() {
+    if (peekTokenIs(TokenType::IDENT) && idx + 2 < cursor.Size() && cursor.Type(idx + 2) == TokenType::LPAREN) {
+        return parseFunction();
+    }
+    return parseVariableDeclaration();
 }
 
-bool Parser::isBooleanOperator(TokenType type) {
-    return type == TokenType::EQ || type == TokenType::NOT_EQ ||
-           type == TokenType::LT || type == TokenType::LTE ||
-           type == TokenType::GT || type == TokenType::GTE ||
-           type == TokenType::AND || type == TokenType::OR;
+int Parser::parseIdentLedStatement() {
+    if (isAssignmentStatement()) {
+        return parseAssignmentStatement();
+    }
+    return parseExpressionStatement();
 }
 
 // end of helper functions
 
 int Parser::parseVariableDeclaration() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "DECLARATION";
+    nodes[nodeIdx].kind = NodeKind::Declaration;
     // Set the type
-    nodes[nodeIdx].varType = curToken().literal;
+    nodes[nodeIdx].varType = curToken().type;
     nextToken();
 
     // Expect an identifier
     if (!curTokenIs(TokenType::IDENT)) return -1;
-    nodes[nodeIdx].name = curToken().literal;
+    nodes[nodeIdx].name = cursor.SymbolAt(idx);
     nextToken();
 
     // Optional initializer
@@ -296,7 +428,7 @@ int Parser::parseVariableDeclaration() {
         nextToken(); // Consume ASSIGN token
         int ret = parseExpression();
         if(ret == -1) return -1;
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     }
 
     // Expect a semicolon
@@ -309,14 +441,13 @@ int Parser::parseVariableDeclaration() {
 
 int Parser::parseAssignmentStatement() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].name = "ASSIGNMENT";
 
     // Ensure current token is Identifier
     if (!curTokenIs(TokenType::IDENT)) {
         return -1;
     }
-    nodes[nodeIdx].type = "IDENTIFIER";
-    nodes[nodeIdx].name = curToken().literal;  // the identifier name
+    nodes[nodeIdx].kind = NodeKind::Identifier;
+    nodes[nodeIdx].name = cursor.SymbolAt(idx);  // the identifier name
     nextToken();  // Move past the identifier
 
     // Expect '='
@@ -329,12 +460,12 @@ int Parser::parseAssignmentStatement() {
     if (exprIdx == -1) {
         return -1;
     }
-    nodes[nodeIdx].children.push_back(exprIdx);
+    nodes.AddChild(nodeIdx, exprIdx);
 
     // Expect a semicolon
     if (!readToken(TokenType::SEMICOLON)) {
-        std::cout << "Expected semicolon after assignment statement at index " << idx << std::endl;
-        errors.push_back("Expected semicolon after assignment statement at index " + to_string(idx));
+        std::cout << "Expected semicolon after assignment statement at index " << indexBase + idx << std::endl;
+        errors.push_back("Expected semicolon after assignment statement at index " + to_string(indexBase + idx));
         return -1;
     }
 
@@ -343,12 +474,12 @@ int Parser::parseAssignmentStatement() {
 
 int Parser::parseReturnStatement() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "RETURN";
+    nodes[nodeIdx].kind = NodeKind::Return;
 
     nextToken();
     int ret = parseExpression();
     if(ret == -1) return ret;
-    nodes[nodeIdx].children.push_back(ret);
+    nodes.AddChild(nodeIdx, ret);
 
     // Expect a semicolon
     if (!readToken(TokenType::SEMICOLON)) {
@@ -361,7 +492,7 @@ int Parser::parseReturnStatement() {
 
 int Parser::parseIfStatement() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "IF_STATEMENT";
+    nodes[nodeIdx].kind = NodeKind::If;
 
     if (!readToken(TokenType::IF)) {
         return -1;
@@ -373,7 +504,7 @@ int Parser::parseIfStatement() {
     int cond = parseExpression();
 
     if(cond == -1) return cond;
-    else nodes[nodeIdx].children.push_back(cond);
+    else nodes.AddChild(nodeIdx, cond);
 
 
     if (!readToken(TokenType::RPAREN)) {
@@ -384,32 +515,13 @@ int Parser::parseIfStatement() {
         return -1;
     }
 
-    int block = parseBlock();
-    if(block == -1) return cond;
-    else nodes[nodeIdx].children.push_back(block);
-
-    if (!readToken(TokenType::RBRACE)) {
-        return -1;
-    }
-
-    if (readToken(TokenType::ELSE)) {
-        if (!readToken(TokenType::LBRACE)) {
-            return -1;
-        }
-        block = parseBlock();
-        if(block == -1) return -1;
-        nodes[nodeIdx].children.push_back(block);
-        if (!readToken(TokenType::RBRACE)) {
-            return -1;
-        }
-    }
-
-    return nodeIdx;
+    // closeBlock picks up an optional else
+    return openBlock(Construct::If, nodeIdx);
 }
 
 int Parser::parseWhileLoop() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "WHILE";
+    nodes[nodeIdx].kind = NodeKind::While;
 
     if (!readToken(TokenType::WHILE)) {
         return -1;
@@ -421,7 +533,7 @@ int Parser::parseWhileLoop() {
     int cond = parseExpression();
 
     if(cond == -1) return cond;
-    else nodes[nodeIdx].children.push_back(cond);
+    else nodes.AddChild(nodeIdx, cond);
 
     if (!readToken(TokenType::RPAREN)) {
         return -1;
@@ -430,15 +542,8 @@ int Parser::parseWhileLoop() {
     if (!readToken(TokenType::LBRACE)) {
         return -1;
     }
-    
-    cond = parseBlock();
-    if(cond == -1) return cond;
-    else nodes[nodeIdx].children.push_back(cond);
 
-    if (!readToken(TokenType::RBRACE)) {
-        return -1;
-    }
-    return nodeIdx;
+    return openBlock(Construct::While, nodeIdx);
 }
 
 int Parser::parseExpressionStatement() {
@@ -460,7 +565,7 @@ int Parser::parseExpressionStatement() {
 int Parser::parseForLoop() {
     // Simplified for loop parsing
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "FOR";
+    nodes[nodeIdx].kind = NodeKind::For;
 
     if (!readToken(TokenType::FOR)) {
         return -1;
@@ -470,44 +575,44 @@ int Parser::parseForLoop() {
     }
 
     // Parse initializer
-    if (isType(curToken().type) && idx + 1 < tokens.size() && tokens[idx + 1].type == TokenType::IDENT) {
+    if (isType(curToken().type) && idx + 1 < cursor.Size() && cursor.Type(idx + 1) == TokenType::IDENT) {
         int ret = parseVariableDeclaration();
         if(ret == -1) return ret;
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     } else if (curTokenIs(TokenType::SEMICOLON)) {
         readToken(TokenType::SEMICOLON);
         int empty = createNode();
-        nodes[empty].type = "EMPTY";
-        nodes[nodeIdx].children.push_back(empty);
+        nodes[empty].kind = NodeKind::Empty;
+        nodes.AddChild(nodeIdx, empty);
     } else {
         int ret = parseExpressionStatement();
         if(ret == -1) return ret;
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     }
 
     // Parse condition
     if (!curTokenIs(TokenType::SEMICOLON)) {
         int ret = parseExpressionStatement();
         if(ret == -1) return ret;
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     }
     else {
         readToken(TokenType::SEMICOLON);
         int empty = createNode();
-        nodes[empty].type = "EMPTY";
-        nodes[nodeIdx].children.push_back(empty);
+        nodes[empty].kind = NodeKind::Empty;
+        nodes.AddChild(nodeIdx, empty);
     }
 
     // Parse update
     if (!curTokenIs(TokenType::RPAREN)) {  
         int ret = parseExpression();
         if(ret == -1) return ret;
-        nodes[nodeIdx].children.push_back(ret);
+        nodes.AddChild(nodeIdx, ret);
     }
     else {
         int empty = createNode();
-        nodes[empty].type = "EMPTY";
-        nodes[nodeIdx].children.push_back(empty);
+        nodes[empty].kind = NodeKind::Empty;
+        nodes.AddChild(nodeIdx, empty);
     }
 
     if (!readToken(TokenType::RPAREN)) {
@@ -517,20 +622,12 @@ int Parser::parseForLoop() {
     if (!readToken(TokenType::LBRACE)) {
         return -1;
     }
-    
-    int cond = parseBlock();
-    if(cond == -1) return cond;
-    else nodes[nodeIdx].children.push_back(cond);
-
-    if (!readToken(TokenType::RBRACE)) {
-        return -1;
-    }
 
-    return nodeIdx;
+    return openBlock(Construct::For, nodeIdx);
 }
 int Parser::parseFornLoop() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "FORN";
+    nodes[nodeIdx].kind = NodeKind::Forn;
 
     if (!readToken(TokenType::FORN)) {
         return -1;
@@ -543,14 +640,14 @@ int Parser::parseFornLoop() {
         return -1;
     }
 
-    std::string varName = tokens[idx-1].literal;
+    Symbol varName = cursor.SymbolAt(idx-1);
 
     int varNode = createNode();
-    nodes[varNode].type = "DECLARATION";
-    nodes[varNode].varType = "int";
+    nodes[varNode].kind = NodeKind::Declaration;
+    nodes[varNode].varType = TokenType::INT;
     nodes[varNode].name = varName;
 
-    nodes[nodeIdx].children.push_back(varNode);
+    nodes.AddChild(nodeIdx, varNode);
 
     if (!readToken(TokenType::COMMA)) {
         return -1;
@@ -561,7 +658,7 @@ int Parser::parseFornLoop() {
         return -1;
     }
 
-    nodes[nodeIdx].children.push_back(upperBound);
+    nodes.AddChild(nodeIdx, upperBound);
 
     if (!readToken(TokenType::RPAREN)) {
         return -1;
@@ -571,21 +668,12 @@ int Parser::parseFornLoop() {
         return -1;
     }
 
-    int blockNode = parseBlock();
-    if (blockNode == -1) return -1;
-
-    nodes[nodeIdx].children.push_back(blockNode);
-
-    if (!readToken(TokenType::RBRACE)) {
-        return -1;
-    }
-
-    return nodeIdx;
+    return openBlock(Construct::Forn, nodeIdx);
 }
 
 int Parser::parseCout() {
     int nodeIdx = createNode();
-    nodes[nodeIdx].type = "COUT";
+    nodes[nodeIdx].kind = NodeKind::Cout;
 
     if (!readToken(TokenType::COUT)) {
         return -1;
@@ -600,8 +688,8 @@ int Parser::parseCout() {
         return -1; 
     }
 
-    std::string argType = nodes[argIdx].type;
-    if (argType != "IDENTIFIER" && argType != "STRING_LITERAL") {
+    NodeKind argKind = nodes[argIdx].kind;
+    if (argKind != NodeKind::Identifier && argKind != NodeKind::StringLiteral) {
         std::cerr << "ERROR: cout can only print a variable or a string literal\n";
         return -1;
     }
@@ -614,157 +702,211 @@ int Parser::parseCout() {
         return -1;
     }
 
-    nodes[nodeIdx].children.push_back(argIdx);
+    nodes.AddChild(nodeIdx, argIdx);
 
     return nodeIdx;
 }
 
+// cin(x); reads the next value of x's type from the input into x
+int Parser::parseCin() {
+    int nodeIdx = createNode();
+    nodes[nodeIdx].kind = NodeKind::Cin;
 
-int Parser::parseExpression(int precedence) {
-    int nodeIdx = -1;
+    if (!readToken(TokenType::CIN)) {
+        return -1;
+    }
 
-    // Stop parsing if an unexpected closing parenthesis is encountered
-    if (curTokenIs(TokenType::RPAREN) || curTokenIs(TokenType::EOF_TOKEN) || curTokenIs(TokenType::COMMA)) {
+    if (!readToken(TokenType::LPAREN)) {
         return -1;
     }
 
-    // Parse left-hand side with current precedence
-    if (curTokenIs(TokenType::IDENT)) {
-        // FunctionCall or an Identifier
-        int identIdx = createNode();
-        nodes[identIdx].name = curToken().literal;
-        nodes[identIdx].type = "IDENTIFIER";
-        nextToken(); // Move past the identifier
+    if (!readToken(TokenType::IDENT)) {
+        return -1;
+    }
 
-        if (curTokenIs(TokenType::LPAREN)) {
-            // FunctionCall
-            nodeIdx = createNode();
-            nodes[nodeIdx].type = "FUNCTION CALL";
-            nodes[nodeIdx].children.push_back(identIdx);
+    int varNode = createNode();
+    nodes[varNode].kind = NodeKind::Identifier;
+    nodes[varNode].name = cursor.SymbolAt(idx-1);
 
-            if (!readToken(TokenType::LPAREN)) {
-                return -1;
-            }
+    if (!readToken(TokenType::RPAREN)) {
+        return -1;
+    }
 
-            // Parse arguments
-            int argsIdx = createNode();
-            nodes[argsIdx].name = "ARGUMENTS";
-            nodes[nodeIdx].children.push_back(argsIdx);
-
-            while (!curTokenIs(TokenType::RPAREN) && !curTokenIs(TokenType::EOF_TOKEN)) {
-                int argIdx = parseExpression();
-                if (argIdx == -1) return -1;
-                nodes[argsIdx].children.push_back(argIdx);
-
-                if (curTokenIs(TokenType::COMMA)) {
-                    readToken(TokenType::COMMA);
-                } else {
-                    break;
-                }
-            }
+    if (!readToken(TokenType::SEMICOLON)) {
+        return -1;
+    }
 
-            if (!readToken(TokenType::RPAREN)) {
-                return -1;
-            }
+    nodes.AddChild(nodeIdx, varNode);
+
+    return nodeIdx;
+}
 
-        } else {
-            // Just an identifier
-            nodeIdx = identIdx;
-        }
 
-        // Handle postfix operators 
-        if (curTokenIs(TokenType::PLUSPLUS)) {
-            int postfixIdx = createNode();
-            nodes[postfixIdx].type = "POSTFIX OPERATOR";
-            nodes[postfixIdx].name = "++";
-            nodes[postfixIdx].children.push_back(nodeIdx); // The operand is the identifier node
-            nextToken(); // consume ++
-            nodeIdx = postfixIdx;
+int Parser::parseExpression(int precedence) {
+    size_t base = expressionStack.size();
+    expressionStack.push_back({Pending::Root, -1, -1, precedence});
+
+    // operand is kOpen while the top frame still needs one, otherwise the
+    // finished node to its left
+    int operand = kOpen;
+    while (true) {
+        if (operand == -1) {
+            expressionStack.resize(base);
+            return -1;
+        }
+        if (operand == kOpen) {
+            PrefixFn prefix = kExpressionRules[Index(curToken().type)].prefix;
+            operand = prefix ? (this->*prefix)() : -1;
+            continue;
         }
 
-        if (curTokenIs(TokenType::MINUSMINUS)){
-            int postfixIdx = createNode();
-            nodes[postfixIdx].type = "POSTFIX OPERATOR";
-            nodes[postfixIdx].name = "--";
-            nodes[postfixIdx].children.push_back(nodeIdx); // The operand is the identifier node
-            nextToken(); // consume --
-            nodeIdx = postfixIdx;
+        // Fold in operators for as long as they bind at least as tightly as
+        // the waiting frame asked for
+        const ExpressionRule& rule = kExpressionRules[Index(curToken().type)];
+        if (rule.infix && rule.leftPower >= expressionStack.back().precedence) {
+            operand = (this->*rule.infix)(operand);
+            continue;
         }
 
+        ExpressionFrame frame = expressionStack.back();
+        expressionStack.pop_back();
+        if (frame.pending == Pending::Root) {
+            return operand;
+        }
+        operand = closeExpression(frame, operand);
+    }
+}
 
-    } else if (curTokenIs(TokenType::INT_LITERAL) || curTokenIs(TokenType::FLOAT_LITERAL) ||
-               curTokenIs(TokenType::STRING_LITERAL) || curTokenIs(TokenType::CHAR_LITERAL) ||
-               curTokenIs(TokenType::BOOLEAN_LITERAL)) {
-        // Literal
-        nodeIdx = createNode();
-        nodes[nodeIdx].name = "LITERAL";
-        nodes[nodeIdx].type = TokenTypeToString(curToken().type);
-        nodes[nodeIdx].name = curToken().literal;
+int Parser::closeExpression(const ExpressionFrame& frame, int operand) {
+    switch (frame.pending) {
+    case Pending::Binary:
+        nodes.AddChild(frame.node, frame.left);
+        nodes.AddChild(frame.node, operand);
+        return frame.node;
 
-        nextToken(); // Move past the literal
+    case Pending::Unary:
+        nodes.AddChild(frame.node, operand);
+        return frame.node;
 
-    } else if (curTokenIs(TokenType::LPAREN)) {
-        // Grouped Expression
-        readToken(TokenType::LPAREN);
-        nodeIdx = parseExpression();
+    case Pending::Group:
         if (!readToken(TokenType::RPAREN)) {
             return -1;
         }
+        return operand;
+
+    case Pending::Call:
+        nodes.AddChild(frame.left, operand);
+        if (curTokenIs(TokenType::COMMA)) {
+            readToken(TokenType::COMMA);
+            if (!curTokenIs(TokenType::RPAREN) && !curTokenIs(TokenType::EOF_TOKEN)) {
+                expressionStack.push_back(frame);
+                return kOpen;
+            }
+        }
+        if (!readToken(TokenType::RPAREN)) {
+            return -1;
+        }
+        return parsePostfix(frame.node);
 
-    } else if (curTokenIs(TokenType::MINUS) || curTokenIs(TokenType::BANG)) {
-        // Prefix unary operator
-        int unaryNodeIdx = createNode();
-        nodes[unaryNodeIdx].type = "UNARY OPERATOR";
-        nodes[unaryNodeIdx].name = curToken().literal;
+    default:
+        return operand;
+    }
+}
+
+int Parser::parseIdentifier() {
+    // FunctionCall or an Identifier
+    int identIdx = createNode();
+    nodes[identIdx].name = cursor.SymbolAt(idx);
+    nodes[identIdx].kind = NodeKind::Identifier;
+    nextToken(); // Move past the identifier
 
-        nextToken(); // Move past the unary operator
+    if (!curTokenIs(TokenType::LPAREN)) {
+        return parsePostfix(identIdx);
+    }
+
+    // FunctionCall
+    int nodeIdx = createNode();
+    nodes[nodeIdx].kind = NodeKind::FunctionCall;
+    nodes.AddChild(nodeIdx, identIdx);
 
-        int operandIdx = parseExpression(Precedence::PREFIX);
-        if (operandIdx == -1) {
+    readToken(TokenType::LPAREN);
+
+    // Parse arguments
+    int argsIdx = createNode();
+    nodes[argsIdx].kind = NodeKind::Arguments;
+    nodes.AddChild(nodeIdx, argsIdx);
+
+    if (curTokenIs(TokenType::RPAREN) || curTokenIs(TokenType::EOF_TOKEN)) {
+        if (!readToken(TokenType::RPAREN)) {
             return -1;
         }
-        nodes[unaryNodeIdx].children.push_back(operandIdx);
+        return parsePostfix(nodeIdx);
+    }
 
-        nodeIdx = unaryNodeIdx;
-    } else {
-        return -1;
+    // each argument is handed to closeExpression as it completes
+    expressionStack.push_back({Pending::Call, nodeIdx, argsIdx, LOWEST});
+    return kOpen;
+}
+
+// Handle postfix operators after an identifier or call
+int Parser::parsePostfix(int nodeIdx) {
+    if (curTokenIs(TokenType::PLUSPLUS)) {
+        int postfixIdx = createNode();
+        nodes[postfixIdx].kind = NodeKind::PostfixOperator;
+        nodes[postfixIdx].op = TokenType::PLUSPLUS;
+        nodes.AddChild(postfixIdx, nodeIdx); // The operand is the identifier node
+        nextToken(); // consume ++
+        nodeIdx = postfixIdx;
     }
 
-    // Now, handle binary operators (left-associative)
-    while (true) {
-        // stop when encountering a closing parenthesis or comma
-        if (curTokenIs(TokenType::RPAREN) || curTokenIs(TokenType::COMMA)) {
-            break;
-        }
+    if (curTokenIs(TokenType::MINUSMINUS)){
+        int postfixIdx = createNode();
+        nodes[postfixIdx].kind = NodeKind::PostfixOperator;
+        nodes[postfixIdx].op = TokenType::MINUSMINUS;
+        nodes.AddChild(postfixIdx, nodeIdx); // The operand is the identifier node
+        nextToken(); // consume --
+        nodeIdx = postfixIdx;
+    }
 
-        int currentPrecedence = getPrecedence(curToken().type);
+    return nodeIdx;
+}
 
-        if (currentPrecedence < precedence) {
-            break;
-        }
+int Parser::parseLiteral() {
+    int nodeIdx = createNode();
+    nodes[nodeIdx].kind = LiteralKind(cursor.Type(idx));
+    nodes[nodeIdx].name = cursor.SymbolAt(idx);
+
+    nextToken(); // Move past the literal
+    return nodeIdx;
+}
 
-        // Handle BinaryOperator or BooleanOperator
-        TokenType opType = curToken().type;
-        if (isBinaryOperator(opType) || isBooleanOperator(opType)) {
-            int binNodeIdx = createNode();
-            nodes[binNodeIdx].type = "BINARY OPERATOR";
-            nodes[binNodeIdx].name = curToken().literal;
+int Parser::parseGroupedExpression() {
+    readToken(TokenType::LPAREN);
+    expressionStack.push_back({Pending::Group, -1, -1, LOWEST});
+    return kOpen;
+}
 
-            nextToken(); // Move past the operator
+int Parser::parsePrefixExpression() {
+    int unaryNodeIdx = createNode();
+    nodes[unaryNodeIdx].kind = NodeKind::UnaryOperator;
+    nodes[unaryNodeIdx].op = cursor.Type(idx);
 
-            int rightIdx = parseExpression(currentPrecedence + 1);
-            if (rightIdx == -1) {
-                return -1;
-            }
+    nextToken(); // Move past the unary operator
 
-            nodes[binNodeIdx].children.push_back(nodeIdx);
-            nodes[binNodeIdx].children.push_back(rightIdx);
+    expressionStack.push_back({Pending::Unary, unaryNodeIdx, -1, PREFIX});
+    return kOpen;
+}
 
-            nodeIdx = binNodeIdx;
-        } else {
-            break;
-        }
-    }
+int Parser::parseInfixExpression(int left) {
+    const ExpressionRule& rule = kExpressionRules[Index(curToken().type)];
 
-    return nodeIdx;
+    int binNodeIdx = createNode();
+    nodes[binNodeIdx].kind = NodeKind::BinaryOperator;
+    nodes[binNodeIdx].op = cursor.Type(idx);
+
+    nextToken(); // Move past the operator
+
+    // the right operand comes back through closeExpression
+    expressionStack.push_back({Pending::Binary, binNodeIdx, left, rule.rightPower});
+    return kOpen;
 }
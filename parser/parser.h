@@ -7,25 +7,49 @@
 #include <string>
 #include <memory>
 #include "../token/token.h"
+#include "../token/token_buffer.h"
 #include "../lexer/lexer.h"
 #include "../ast/ast.h"
 
 class Parser {
 public:
-    Parser(std::vector<Token>);
+    // Takes the lexer's buffer by value; pass it with std::move (or straight
+    // from Lexer::Tokenize) so the tokens are never copied. The nodes and
+    // work stacks come from the same arena as the tokens, if they have one.
+    Parser(TokenBuffer);
+    // Worker for ParseProgramParallel: reads another parser's tokens through
+    // a copy of its cursor and owns nothing but its nodes and errors.
+    explicit Parser(const TokenCursor& shared);
+    Parser(const Parser&) = delete;
+    Parser& operator=(const Parser&) = delete;
     std::vector<std::string> errors;
     std::vector<std::string> Errors() const{
         return errors;
     }
     int createNode();
     int idx;
-    std::vector<Token> tokens;
-    std::vector<ASTNode> nodes;
+    // Index of tokens[0] in the whole input, added to the positions in
+    // error messages when the parser only sees part of it (UnitStream).
+    int indexBase = 0;
+    TokenBuffer tokens;
+    TokenCursor cursor; // how every token read goes
+    // Children are added with nodes.AddChild while parsing; parseProgram
+    // finishes the tree, so Children() works once it returns.
+    AST nodes;
+
+    // Identifier names live in the token buffer's interner.
+    const Interner& names() const { return tokens.Names(); }
+    // For passes that intern new symbols (e.g. folded constants)
+    Interner& names() { return tokens.Names(); }
+    std::string_view nodeName(int) const;
 
     void printNodes();
     void dfs(int, int);
 
     void parseProgram();
+    // Top-level statements from idx until token end (or EOF); their roots
+    // are appended to roots.
+    void parseTopLevel(int end, std::vector<int>& roots);
     int parseFunction();
     int parseArguments();
 
@@ -50,11 +74,25 @@ public:
     bool isType(TokenType t) const;
     bool isExpressionStatement();
     bool isAssignmentStatement();
-    int getPrecedence(TokenType type);
-    bool isBinaryOperator(TokenType type);
-    bool isBooleanOperator(TokenType type);
 //     // Parsing methods
+    // Returned by a parse function that opened a block or subexpression and
+    // left a frame on the work stack for the driver loop to finish.
+    static constexpr int kOpen = -2;
+
+    // Parses one whole statement, nested blocks included. Nesting lives on
+    // blockStack instead of the native stack, so depth is only bounded by
+    // memory.
     int parseStatement();
+    // Statements are dispatched on their first token through a table (see
+    // parser.cpp); type- and identifier-led ones look one token further.
+    // Compound statements parse their header, open their block and return
+    // kOpen.
+    int beginStatement();
+    enum class Construct { Function, For, Forn, While, If, Else, Block };
+    int openBlock(Construct construct, int node, bool valid = true);
+    int closeBlock();
+    int parseTypeLedStatement();
+    int parseIdentLedStatement();
     int parseVariableDeclaration();
     int parseAssignmentStatement();
     int parseExpressionStatement();
@@ -65,23 +103,49 @@ public:
     int parseReturnStatement();
     int parseBlock();
     int parseCout();
+    int parseCin();
 //     std::vector<std::unique_ptr<Expression> > parseExpressionList(TokenType end);
+    // Pratt loop: parses operators binding at least as tightly as precedence.
+    // Operands still being parsed wait on expressionStack, not in native
+    // stack frames.
     int parseExpression(int precedence = 0);
-    
 
-//     // Prefix parsing functions
-//     std::unique_ptr<Expression> parseIdentifier();
-//     std::unique_ptr<Expression> parseLiteral();
-//     std::unique_ptr<Expression> parseIntegerLiteral();
-//     std::unique_ptr<Expression> parseBooleanLiteral();
-//     std::unique_ptr<Expression> parseGroupedExpression();
-//     std::unique_ptr<Expression> parsePrefixExpression();
-//     std::unique_ptr<Expression> parseFunctionCall(std::unique_ptr<Expression> function);
+    // Prefix parsing functions (the token that starts an expression); they
+    // return kOpen after pushing a frame that waits for an operand
+    int parseIdentifier();       // identifier, function call, postfix ++/--
+    int parseLiteral();
+    int parseGroupedExpression();
+    int parsePrefixExpression();
+    int parsePostfix(int operand);
+
+    // Infix parsing functions (an operator after a complete left operand)
+    int parseInfixExpression(int left);
+
+    // What an expression frame does with the operand it waits for
+    enum class Pending { Root, Binary, Unary, Group, Call };
 
-//     // Infix parsing functions
-//     std::unique_ptr<Expression> parseInfixExpression(std::unique_ptr<Expression> left);
+    // Explicit work stacks for statements, expressions and the tree printer.
+    // Members, so their storage is reused from one call to the next.
+    struct BlockFrame {
+        Construct construct;
+        int node;       // the FUNCTION / FOR / ... node
+        int block;      // the CODE BLOCK being filled
+        bool valid;     // function headers report errors only once closed
+    };
+    struct ExpressionFrame {
+        Pending pending;
+        int node;
+        int left;       // left operand of a binary operator, or a call's ARGUMENTS
+        int precedence; // weakest operator the operand may still absorb
+    };
+    ArenaVector<BlockFrame> blockStack;
+    ArenaVector<ExpressionFrame> expressionStack;
+    std::vector<std::pair<int, int>> printStack;  // node, depth
 
-    // Precedence levels
+    // Hands a finished operand to the frame waiting for it.
+    int closeExpression(const ExpressionFrame& frame, int operand);
+
+    // Precedence levels, used as binding powers by the expression tables
     enum Precedence {
         LOWEST,
         OR,           // ||
@@ -93,9 +157,6 @@ public:
         PREFIX,       // -X or !X
         CALL          // function calls
     };
-
-    // Maps for operator precedences
-    std::unordered_map<TokenType, Precedence> precedences;
 };
 
 #endif // PARSER_H
@@ -0,0 +1,56 @@
+// unit_stream.cpp
+
+#include "unit_stream.h"
+#include "parallel_parser.h"
+
+#include <algorithm>
+
+UnitStream::UnitStream(int fd, size_t chunkSize) : lexer(fd, chunkSize) {}
+
+bool UnitStream::Next(TokenBuffer& unit, Arena* arena) {
+    // Reads until a function start past the beginning of the unit. Tokens
+    // carried over from the last call are already staged.
+    while (!done) {
+        Token tok = lexer.NextToken();
+        if (tok.type == TokenType::EOF_TOKEN) {
+            done = true;
+            break;
+        }
+        // the literal is only valid until the next NextToken, so copy it
+        staged.push_back({tok.type, static_cast<uint32_t>(text.size()),
+                          static_cast<uint32_t>(tok.literal.size())});
+        text.append(tok.literal);
+
+        if (tok.type == TokenType::LBRACE) {
+            depth++;
+        } else if (tok.type == TokenType::RBRACE) {
+            depth = std::max(0, depth - 1);
+        }
+        size_t n = staged.size();
+        if (depth == 0 && n > 3 &&
+            IsFunctionStart(staged[n - 3].type, staged[n - 2].type, staged[n - 1].type)) {
+            break;
+        }
+    }
+    if (staged.empty()) return false;
+
+    // The three tokens that opened the next function start the next unit.
+    size_t cut = done ? staged.size() : staged.size() - 3;
+    size_t textCut = cut < staged.size() ? staged[cut].offset : text.size();
+
+    unitText.assign(text, 0, textCut);
+    unit = TokenBuffer(unitText, arena);
+    unit.Reserve(cut + 1);
+    for (size_t i = 0; i < cut; i++) {
+        unit.Push(staged[i].type, std::string_view(unitText.data() + staged[i].offset, staged[i].length));
+    }
+    unit.Push(TokenType::EOF_TOKEN, "");
+
+    base = consumed;
+    consumed += static_cast<int>(cut);
+
+    staged.erase(staged.begin(), staged.begin() + cut);
+    for (Staged& s : staged) s.offset -= static_cast<uint32_t>(textCut);
+    text.erase(0, textCut);
+    return true;
+}
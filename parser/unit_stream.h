@@ -0,0 +1,54 @@
+// unit_stream.h
+
+#ifndef UNIT_STREAM_H
+#define UNIT_STREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../lexer/stream_lexer.h"
+#include "../token/token_buffer.h"
+
+// Pulls tokens from a StreamLexer and hands them out one top-level unit at
+// a time: a function definition together with any top-level statements
+// that follow it, up to the next function start (the same cut points
+// FindFunctionStarts gives the parallel parser). Each unit ends in an EOF
+// token, so a fresh Parser can parse it on its own.
+//
+// Only the unit being returned and the few tokens of lookahead that found
+// its end are held, so memory is bounded by the largest function rather
+// than the input.
+class UnitStream {
+public:
+    // Does not take ownership of fd.
+    explicit UnitStream(int fd, size_t chunkSize = StreamLexer::kDefaultChunkSize);
+
+    // Replaces unit with the next one, allocated from arena if given. Its
+    // literals point into this stream and stay valid until the next call.
+    // Returns false once the input is used up.
+    bool Next(TokenBuffer& unit, Arena* arena = nullptr);
+
+    // Index of the last unit's first token in the whole input.
+    int Base() const { return base; }
+    bool Failed() const { return lexer.Failed(); }
+
+private:
+    struct Staged {
+        TokenType type;
+        uint32_t offset;  // into text
+        uint32_t length;
+    };
+
+    StreamLexer lexer;
+    // Tokens read but not yet handed out, with their literals back to back.
+    std::vector<Staged> staged;
+    std::string text;
+    std::string unitText;  // backs the unit last returned
+    int depth = 0;         // brace depth after the last staged token
+    int base = 0;
+    int consumed = 0;      // tokens handed out so far
+    bool done = false;
+};
+
+#endif // UNIT_STREAM_H
@@ -0,0 +1,81 @@
+// output_sink.cpp
+
+#include "output_sink.h"
+
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+FdTarget::~FdTarget() {
+    if (owned && fd >= 0) close(fd);
+}
+
+// write() may take less than asked of a pipe or after a signal, so it is
+// repeated until everything is out; a regular file takes it all at once.
+bool FdTarget::Write(const char* data, size_t size) {
+    if (fd < 0) return false;
+    while (size > 0) {
+        ssize_t n = write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data += n;
+        size -= n;
+    }
+    return true;
+}
+
+bool FdTarget::Close() {
+    if (fd < 0) return false;
+    bool ok = true;
+    if (owned) {
+        ok = close(fd) == 0;
+        fd = -1;
+    }
+    return ok;
+}
+
+FileTarget::FileTarget(const std::string& path)
+    : FdTarget(open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644), true) {}
+
+bool StringTarget::Write(const char* data, size_t size) {
+    out.append(data, size);
+    return true;
+}
+
+PipeTarget::PipeTarget(const std::string& command) : pipe(popen(command.c_str(), "w")) {}
+
+PipeTarget::~PipeTarget() {
+    if (pipe) pclose(pipe);
+}
+
+// Straight to the descriptor; the FILE's own buffer is never used.
+bool PipeTarget::Write(const char* data, size_t size) {
+    if (!pipe) return false;
+    return FdTarget(fileno(pipe)).Write(data, size);
+}
+
+bool PipeTarget::Close() {
+    if (!pipe) return false;
+    int status = pclose(pipe);
+    pipe = nullptr;
+    return status != -1 && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+bool OutputSink::Flush() {
+    if (buffer.empty()) return !failed;
+    if (!target || !target->Write(buffer.data(), buffer.size())) failed = true;
+    buffer.clear();
+    return !failed;
+}
+
+bool OutputSink::Close() {
+    Flush();
+    if (target && !target->Close()) failed = true;
+    bool ok = !failed && target;
+    target.reset();
+    failed = false;
+    return ok;
+}
@@ -0,0 +1,94 @@
+// output_sink.h
+
+#ifndef OUTPUT_SINK_H
+#define OUTPUT_SINK_H
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+
+// Where translated C++ ends up. Write gets large pieces of output, usually
+// all of it in one call.
+class OutputTarget {
+public:
+    virtual ~OutputTarget() = default;
+    // Returns false if the bytes could not all be written.
+    virtual bool Write(const char* data, size_t size) = 0;
+    // Called once after the last Write; returns false if the output is
+    // incomplete (e.g. the command behind a pipe failed).
+    virtual bool Close() { return true; }
+};
+
+// An open descriptor such as stdout or the write end of a pipe. Closed on
+// Close() only if owned.
+class FdTarget : public OutputTarget {
+public:
+    explicit FdTarget(int fd, bool owned = false) : fd(fd), owned(owned) {}
+    ~FdTarget() override;
+    bool Write(const char* data, size_t size) override;
+    bool Close() override;
+
+protected:
+    int fd;
+    bool owned;
+};
+
+// Creates or truncates path right away, like opening an ofstream.
+class FileTarget : public FdTarget {
+public:
+    explicit FileTarget(const std::string& path);
+};
+
+// Appends to a string the caller owns.
+class StringTarget : public OutputTarget {
+public:
+    explicit StringTarget(std::string& out) : out(out) {}
+    bool Write(const char* data, size_t size) override;
+
+private:
+    std::string& out;
+};
+
+// Feeds the standard input of a shell command, e.g. "g++ -x c++ - -o prog".
+// Close() waits for the command and fails unless it exits with 0.
+class PipeTarget : public OutputTarget {
+public:
+    explicit PipeTarget(const std::string& command);
+    ~PipeTarget() override;
+    bool Write(const char* data, size_t size) override;
+    bool Close() override;
+
+private:
+    FILE* pipe;
+};
+
+// Output collected in one contiguous buffer and handed to the target in a
+// single Write on Flush(). Reserve() with an estimate of the output size
+// keeps the buffer from regrowing; Flush() empties it but keeps the
+// capacity, so flushing every so often bounds memory when the output
+// would be too large to hold.
+class OutputSink {
+public:
+    OutputSink() = default;
+    explicit OutputSink(std::unique_ptr<OutputTarget> target) : target(std::move(target)) {}
+
+    OutputSink& operator<<(std::string_view text) {
+        buffer.append(text.data(), text.size());
+        return *this;
+    }
+    void Reserve(size_t bytes) { buffer.reserve(bytes); }
+    size_t Buffered() const { return buffer.size(); }
+
+    bool Flush();
+    // Flushes, then closes the target; the sink is empty afterwards.
+    // Returns false if any write or the close failed.
+    bool Close();
+
+private:
+    std::unique_ptr<OutputTarget> target;
+    std::string buffer;
+    bool failed = false;
+};
+
+#endif // OUTPUT_SINK_H
@@ -0,0 +1,91 @@
+// precompiled_header.cpp
+
+#include "precompiled_header.h"
+
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "processor.h"
+#include "../ast/ast_file.h"
+
+namespace {
+
+// Runs a shell command, collecting what it writes to stdout and stderr;
+// true if it exits with 0
+bool Run(const std::string& command, std::string& output) {
+    output.clear();
+    std::FILE* pipe = popen((command + " 2>&1").c_str(), "r");
+    if (!pipe) return false;
+    char buffer[4096];
+    size_t n;
+    while ((n = std::fread(buffer, 1, sizeof(buffer), pipe)) > 0) output.append(buffer, n);
+    return pclose(pipe) == 0;
+}
+
+std::string Quote(const std::string& path) {
+    std::string quoted = "'";
+    for (char c : path) {
+        if (c == '\'') quoted += "'\\''";
+        else quoted += c;
+    }
+    return quoted + "'";
+}
+
+bool WriteFile(const std::string& path, std::string_view text) {
+    std::string temp = path + ".tmp." + std::to_string(getpid());
+    std::FILE* out = std::fopen(temp.c_str(), "wb");
+    if (!out) return false;
+    bool ok = std::fwrite(text.data(), 1, text.size(), out) == text.size();
+    ok = std::fclose(out) == 0 && ok;
+    if (ok) ok = std::rename(temp.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(temp.c_str());
+    return ok;
+}
+
+}  // namespace
+
+PreambleCache::PreambleCache(std::string directory) : directory(std::move(directory)) {
+    if (mkdir(this->directory.c_str(), 0777) != 0 && errno != EEXIST) {
+        std::perror(("preamble cache: " + this->directory).c_str());
+    }
+    // programs include the header from wherever they are compiled
+    char absolute[PATH_MAX];
+    if (realpath(this->directory.c_str(), absolute)) this->directory = absolute;
+}
+
+std::string PreambleCache::Header(const std::string& compiler, std::string* error) const {
+    std::string output;
+    if (!Run(compiler + " --version", output)) {
+        if (error) *error = "cannot run " + compiler + ": " + output;
+        return "";
+    }
+    std::string_view preamble = Processor::Preamble();
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(
+                      HashSource(compiler + '\n' + output + '\n' + std::string(preamble))));
+    std::string subdirectory = directory + "/" + name;
+    std::string header = subdirectory + "/fpp_preamble.h";
+    std::string gch = header + ".gch";
+    if (access(gch.c_str(), R_OK) == 0) return header;
+
+    if (mkdir(subdirectory.c_str(), 0777) != 0 && errno != EEXIST) {
+        if (error) *error = "cannot create " + subdirectory;
+        return "";
+    }
+    if (!WriteFile(header, preamble)) {
+        if (error) *error = "cannot write " + header;
+        return "";
+    }
+    // built aside and renamed, so a concurrent compile never sees half a .gch
+    std::string temp = gch + ".tmp." + std::to_string(getpid());
+    if (!Run(compiler + " -x c++-header " + Quote(header) + " -o " + Quote(temp), output) ||
+        std::rename(temp.c_str(), gch.c_str()) != 0) {
+        std::remove(temp.c_str());
+        if (error) *error = "cannot precompile " + header + ": " + output;
+        return "";
+    }
+    return header;
+}
@@ -0,0 +1,39 @@
+// precompiled_header.h
+
+#ifndef PRECOMPILED_HEADER_H
+#define PRECOMPILED_HEADER_H
+
+#include <string>
+
+// Directory of precompiled preambles. Every translated program starts with
+// the same Processor::Preamble(), so instead of having the compiler parse
+// its headers again for each program, the preamble is written once as a
+// header, compiled once into a .gch beside it, and the programs #include
+// the header (Processor::setPreambleHeader). The compiler picks up the .gch
+// in place of the text.
+//
+// A .gch only works with the compiler and flags that built it, so each
+// compiler command gets its own subdirectory, named by a hash of the
+// command, the compiler's --version output and the preamble:
+//
+//   directory/<hash>/fpp_preamble.h
+//   directory/<hash>/fpp_preamble.h.gch
+//
+// A program compiled with other flags still builds, since the compiler
+// then ignores the .gch and reads the header.
+class PreambleCache {
+public:
+    // The directory is created if it doesn't exist.
+    explicit PreambleCache(std::string directory);
+
+    // The absolute path of the preamble header for compiler, a command line
+    // with the flags the programs will be compiled with ("g++ -std=c++17
+    // -O2"), building the .gch first if this is the first time. Returns ""
+    // and sets error if the compiler can't be run or fails.
+    std::string Header(const std::string& compiler, std::string* error = nullptr) const;
+
+private:
+    std::string directory;
+};
+
+#endif // PRECOMPILED_HEADER_H
@@ -1,296 +1,432 @@
 #include "processor.h"
+#include <algorithm>
+
+// The includes, then buffered I/O for the generated program in place of
+// iostream, then the typedefs and globals every program can use. Output
+// collects in one static buffer that is written when full and at the end
+// of main, so a program printing a million lines makes one write; input is
+// read from stdin a block at a time and parsed by hand. cout(x) becomes
+// fio::println(x), cin(x) fio::read(x), and both pick the format from x's
+// type the way << and >> would.
+static const char kPreamble[] = R"(#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+)";
+
+std::string_view Processor::Preamble() {
+	return std::string_view(kPreamble, sizeof(kPreamble) - 1);
+}
 
 // Constructor
-Processor::Processor(std::vector<ASTNode> a, std::string b) 
+Processor::Processor(AST a, const Interner& symbols, std::string b)
+	: tree(std::move(a)), names(symbols.Table()), work(tree.nodes.get_allocator())
 {
 
-	nodes = a;
+	nodes = tree.View();
 	filename = b;
 
 }
 
-bool needsLine(std::string type) {
-	if(type == "FOR" || type == "WHILE" || type == "FUNCTION") return false;
-	return true;
+Processor::Processor(std::string b)
+	: filename(std::move(b))
+{
+}
+
+Processor::Processor(ASTView view, NameTable table, std::string b)
+	: nodes(view), names(table), filename(std::move(b))
+{
+}
+
+std::string_view Processor::nameOf(int cur) const {
+	if(nodes[cur].name != Interner::kNone) return names.Name(nodes[cur].name);
+	return TokenText(nodes[cur].op);
 }
 
-void Processor::dfs(int cur) {
+bool needsLine(NodeKind kind) {
+	switch(kind) {
+		case NodeKind::For:
+		case NodeKind::While:
+		case NodeKind::If:
+		case NodeKind::Block:
+		case NodeKind::Function:
+			return false;
+		default:
+			return true;
+	}
+}
+
+// Pops items off the work stack until it is empty. expand() schedules a
+// node's output in reading order and the new items are then reversed in
+// place, so they pop first to last.
+void Processor::dfs(int root) {
+	work.clear();
+	child(root);
+
+	while(!work.empty()) {
+		EmitItem item = work.back();
+		work.pop_back();
+		if(item.node == -1) {
+			out << item.text;
+			continue;
+		}
+		size_t mark = work.size();
+		expand(item.node);
+		std::reverse(work.begin() + mark, work.end());
+	}
+}
 
-	if(nodes[cur].type == "PROGRAM") {
-	    for(int z : nodes[cur].children) {
-	        dfs(z);
-	        if(needsLine(nodes[z].type)) outfile << ';';
-	       	outfile << '\n';
-	    }
-	    return;
+// Each statement of block on its own line
+void Processor::statements(int block) {
+	for(int z : nodes.Children(block)) {
+		child(z);
+		text(needsLine(nodes[z].kind) ? ";\n" : "\n");
 	}
+}
 
-	if(nodes[cur].type == "FUNCTION") {
+void Processor::expand(int cur) {
+	visit(nodes[cur].kind, cur);
+}
 
-		outfile << nodes[cur].varType << " ";
-		outfile << nodes[cur].name;
+void Processor::visitProgram(int cur) {
+	statements(cur);
+}
 
-		if(nodes[cur].children.size() != 2) {
-			std::cout << "ERROR: bad function node" << std::endl;
-			return;
-		}
+void Processor::visitFunction(int cur) {
+	out << TokenText(nodes[cur].varType) << " ";
+	out << nameOf(cur);
 
-		int child1 = nodes[cur].children[0];
-		int child2 = nodes[cur].children[1];
-
-		outfile << "(";
-		int i = 0;
-	    for(int z : nodes[child1].children) {
-	        dfs(z);
-	        i++;
-	        if(i != nodes[child1].children.size()) outfile << ',';
-	    }
-		outfile << ")";
-
-		outfile << "{\n";
-	    for(int z : nodes[child2].children) {
-	        dfs(z);
-	        if(needsLine(nodes[z].type)) outfile << ';';
-	       	outfile << '\n';
-	    }
-		outfile << "}\n";
-	    return;
+	if(nodes.Children(cur).size() != 2) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
 	}
 
-	if(nodes[cur].type == "FUNCTION CALL") {
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
 
+	text("(");
+	size_t i = 0;
+	for(int z : nodes.Children(child1)) {
+		child(z);
+		i++;
+		if(i != nodes.Children(child1).size()) text(",");
+	}
+	text(")");
 
-		if(nodes[cur].children.size() != 2) {
-			std::cout << "ERROR: bad function node" << std::endl;
-			return;
-		}
+	text("{\n");
+	statements(child2);
+	text("}\n");
+}
 
-		int child1 = nodes[cur].children[0];
-		int child2 = nodes[cur].children[1];
+void Processor::visitFunctionCall(int cur) {
+	if(nodes.Children(cur).size() != 2) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
+	}
+
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
 
-		outfile << nodes[child1].name << "(";
+	text(nameOf(child1));
+	text("(");
 
-		int i = 0;
-	    for(int z : nodes[child2].children) {
-	        dfs(z);
-	        i++;
-	        if(i != nodes[child2].children.size()) outfile << ',';
-	    }
-		outfile << ")";
-	    return;
+	size_t i = 0;
+	for(int z : nodes.Children(child2)) {
+		child(z);
+		i++;
+		if(i != nodes.Children(child2).size()) text(",");
 	}
+	text(")");
+}
 
-	if(nodes[cur].type == "FOR") {
+void Processor::visitFor(int cur) {
+	out << "for(";
+	if(nodes.Children(cur).size() != 4) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
+	}
 
-		outfile << "for(";
-		if(nodes[cur].children.size() != 4) {
-			std::cout << "ERROR: bad function node" << std::endl;
-			return;
-		}
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
+	int child3 = nodes.Children(cur)[2];
+	int child4 = nodes.Children(cur)[3];
+
+	child(child1);
+	text(";");
+	child(child2);
+	text(";");
+	child(child3);
+	text("){\n");
+	statements(child4);
+	text("}");
+}
 
-		int child1 = nodes[cur].children[0];
-		int child2 = nodes[cur].children[1];
-		int child3 = nodes[cur].children[2];
-		int child4 = nodes[cur].children[3];
-
-
-	    dfs(child1);
-		outfile << ";";
-	    dfs(child2);
-		outfile << ";";
-	    dfs(child3);
-	    outfile << "){\n";
-	    for(int z : nodes[child4].children) {
-	        dfs(z);
-	        if(needsLine(nodes[z].type)) outfile << ';';
-	       	outfile << '\n';
-	    }
-	    outfile << "}"; 
-	    return;
+void Processor::visitForn(int cur) {
+	out << "for(";
+	if(nodes.Children(cur).size() != 3) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
 	}
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
+	int child3 = nodes.Children(cur)[2];
+
+	//forn(i, n) { //iterate i from 0 to n-1, equal to for(int i = 0; i < n;
+	//i++) 
+	text("int "); text(nameOf(child1)); text(" = 0; ");
+	text(nameOf(child1)); text(" < ");
+	child(child2);
+	text("; ");
+	text(nameOf(child1)); text("++){\n");
+	statements(child3);
+	text("}");
+}
 
-    if(nodes[cur].type == "FORN"){
-        outfile << "for(";
-        if(nodes[cur].children.size() != 3) {
-            std::cout << "ERROR: bad function node" << std::endl;
-            return;
-        }
-        int child1 = nodes[cur].children[0];
-        int child2 = nodes[cur].children[1];
-        int child3 = nodes[cur].children[2];
-
-        //forn(i, n) { //iterate i from 0 to n-1, equal to for(int i = 0; i < n;
-        //i++) 
-        outfile << "int " << nodes[child1].name << " = 0; ";
-        outfile << nodes[child1].name << " < ";
-        dfs(child2);
-        outfile << "; ";
-        outfile << nodes[child1].name << "++){\n";
-        for(int z : nodes[child3].children) {
-            dfs(z);
-            if(needsLine(nodes[z].type)) outfile << ';';
-            outfile << '\n';
-        }
-        outfile << "}";
-        return;
-    }
-
-    if(nodes[cur].type == "WHILE") {
-        outfile << "while(";
-        if(nodes[cur].children.size() != 2) {
-            std::cout << "ERROR: bad function node" << std::endl;
-            return;
-        }
-        int child1 = nodes[cur].children[0];
-        int child2 = nodes[cur].children[1];
-        dfs(child1);
-        outfile << "){\n";
-
-        for(int z: nodes[child2].children) {
-            dfs(z);
-            if(needsLine(nodes[z].type)) outfile << ';';
-            outfile << '\n';
-        }
-        outfile << "}";
-        return;
-
-    }
-
-	if(nodes[cur].type == "DECLARATION") {
-		outfile << nodes[cur].varType << ' ' << nodes[cur].name;
-
-		if(nodes[cur].children.size()) {
-
-			outfile << " = ";
-			dfs(nodes[cur].children[0]);
-		}
-	    return;
+void Processor::visitWhile(int cur) {
+	out << "while(";
+	if(nodes.Children(cur).size() != 2) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
 	}
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
+	child(child1);
+	text("){\n");
+	statements(child2);
+	text("}");
+}
 
+// A bare { ... } statement; function and loop bodies are written by
+// their owners through statements()
+void Processor::visitBlock(int cur) {
+	text("{\n");
+	statements(cur);
+	text("}");
+}
 
-	if(nodes[cur].type == "IDENTIFIER") {
-		outfile << nodes[cur].name;
-		if(nodes[cur].children.size()) {
+// condition, then block, and the else block if there is one
+void Processor::visitIf(int cur) {
+	out << "if(";
+	if(nodes.Children(cur).size() != 2 && nodes.Children(cur).size() != 3) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
+	}
+	child(nodes.Children(cur)[0]);
+	text("){\n");
+	statements(nodes.Children(cur)[1]);
+	text("}");
+	if(nodes.Children(cur).size() == 3) {
+		text(" else {\n");
+		statements(nodes.Children(cur)[2]);
+		text("}");
+	}
+}
 
-			outfile << " = ";
-			dfs(nodes[cur].children[0]);
-		}
-	    return;
+void Processor::visitDeclaration(int cur) {
+	text(TokenText(nodes[cur].varType)); text(" "); text(nameOf(cur));
+
+	if(nodes.Children(cur).size()) {
+		text(" = ");
+		child(nodes.Children(cur)[0]);
 	}
+}
 
-    if(nodes[cur].type == "POSTFIX OPERATOR") {
-        if(nodes[cur].children.size() != 1) {
-            std::cout << "ERROR: bad function node" << std::endl;
-            return;
-        }
-        // For postfix operators like i++, the operand (child) should come first
-        dfs(nodes[cur].children[0]);
-        outfile << nodes[cur].name; // Print the '++' after the operand
-        return;
-    }
-
-
-	if(nodes[cur].type == "RETURN") {
-		outfile << "return ";
-		if(nodes[cur].children.size()) {
-			dfs(nodes[cur].children[0]);
-		}
-	    return;
+void Processor::visitIdentifier(int cur) {
+	text(nameOf(cur));
+	if(nodes.Children(cur).size()) {
+		text(" = ");
+		child(nodes.Children(cur)[0]);
 	}
+}
 
-	if(nodes[cur].type == "UNARY OPERATOR") {
-		outfile << nodes[cur].name;
-		if(nodes[cur].children.size()) {
-			dfs(nodes[cur].children[0]);
-		}
-	    return;
+void Processor::visitPostfixOperator(int cur) {
+	if(nodes.Children(cur).size() != 1) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
 	}
+	// For postfix operators like i++, the operand (child) should come first
+	child(nodes.Children(cur)[0]);
+	text(nameOf(cur)); // Print the '++' after the operand
+}
 
-	if(nodes[cur].type == "INT_LITERAL") {
-		outfile << nodes[cur].name;
-	    return;
+void Processor::visitReturn(int cur) {
+	text("return ");
+	if(nodes.Children(cur).size()) {
+		child(nodes.Children(cur)[0]);
 	}
+}
 
+// The operand is parenthesized, since two operators in a row could read
+// as another one: -(-a) is not --a.
+void Processor::visitUnaryOperator(int cur) {
+	text(nameOf(cur));
+	if(nodes.Children(cur).size()) {
+		text("(");
+		child(nodes.Children(cur)[0]);
+		text(")");
+	}
+}
 
+void Processor::visitIntLiteral(int cur) {
+	text(nameOf(cur));
+}
 
-	if(nodes[cur].type == "BINARY OPERATOR") {
-		if(nodes[cur].children.size() != 2) {
-			std::cout << "ERROR: bad function node" << std::endl;
-			return;
-		}
+void Processor::visitFloatLiteral(int cur) {
+	text(nameOf(cur));
+}
 
-		int child1 = nodes[cur].children[0];
-		int child2 = nodes[cur].children[1];
+// string and char literals are kept raw, quotes and escapes included,
+// which is already valid C++
+void Processor::visitStringLiteral(int cur) {
+	text(nameOf(cur));
+}
 
-		outfile << "(";
-		dfs(child1);
-		outfile << " " << nodes[cur].name << " ";
-		dfs(child2);
-		outfile << ")";
-	    return;
+void Processor::visitCharLiteral(int cur) {
+	text(nameOf(cur));
+}
+
+void Processor::visitBinaryOperator(int cur) {
+	if(nodes.Children(cur).size() != 2) {
+		std::cerr << "ERROR: bad function node" << std::endl;
+		return;
 	}
 
+	int child1 = nodes.Children(cur)[0];
+	int child2 = nodes.Children(cur)[1];
 
-	if(nodes[cur].type == "IDENTIFIER") {
-		outfile << nodes[cur].name;
-	    return;
-	}
+	text("(");
+	child(child1);
+	text(" "); text(nameOf(cur)); text(" ");
+	child(child2);
+	text(")");
+}
 
-    if(nodes[cur].type == "COUT") {
-        if(nodes[cur].children.size() != 1) {
-            std::cout << "ERROR: COUT node should have exactly one child.\n";
-            return;
-        }
+void Processor::visitCout(int cur) {
+	if(nodes.Children(cur).size() != 1) {
+		std::cerr << "ERROR: COUT node should have exactly one child.\n";
+		return;
+	}
 
-        outfile << "std::cout << ";
-        int child = nodes[cur].children[0];
+	out << "fio::println(";
+	int child = nodes.Children(cur)[0];
+
+	if (nodes[child].kind == NodeKind::Identifier) {
+		text(nameOf(child));
+	} else if (nodes[child].kind == NodeKind::StringLiteral) {
+		// If parser puts the quotes in nodes[child].name:
+		text(nameOf(child));
+	} else {
+		std::cerr << "ERROR: COUT node child is neither IDENTIFIER nor STRING_LITERAL.\n";
+		return;
+	}
 
-        if (nodes[child].type == "IDENTIFIER") {
-            outfile << nodes[child].name;
-        } else if (nodes[child].type == "STRING_LITERAL") {
-            // If parser puts the quotes in nodes[child].name:
-            outfile << nodes[child].name;
-        } else {
-            std::cout << "ERROR: COUT node child is neither IDENTIFIER nor STRING_LITERAL.\n";
-            return;
-        }
+	text(")");
+}
 
-        outfile << " << '\\n'";
-        return;
-    }
+void Processor::visitCin(int cur) {
+	if(nodes.Children(cur).size() != 1) {
+		std::cerr << "ERROR: CIN node should have exactly one child.\n";
+		return;
+	}
+	out << "fio::read(";
+	text(nameOf(nodes.Children(cur)[0]));
+	text(")");
+}
 
+void Processor::setOutput(std::unique_ptr<OutputTarget> t) {
+	target = std::move(t);
+}
 
+void Processor::setPreambleHeader(std::string path) {
+	preambleHeader = std::move(path);
+}
 
+// The output runs about three bytes per node, plus the fixed preamble and
+// main(), so four per node is enough to write it without regrowing.
+bool Processor::process() {
+	begin();
+	out.Reserve(1024 + 4 * nodes.size());
+	dfs(0);
+	return end();
+}
 
-    // for(int i = 0; i < depth; i++) {
-    //     cout << "|";
-    //     if(i < depth-1) cout << "  ";
-    // }
+void Processor::begin() {
 
-    // if(depth) cout << "--";
-    
-    // if(nodes[cur].type.size()) cout << nodes[cur].type << ' ';
-    // else cout << "- ";
-    // if(nodes[cur].varType.size()) cout << nodes[cur].varType << ' ';
-    // else cout << "- ";
+	if(!target) target = std::make_unique<FileTarget>(filename);
+	out = OutputSink(std::move(target));
 
-    // cout <<  nodes[cur].name << '\n';
-    // for(int z : nodes[cur].children) {
-    //     dfs(z, depth+1);
-    // }
+	if(preambleHeader.empty()) {
+		out << Preamble();
+	} else {
+		out << "#include \"" << preambleHeader << "\"\n";
+	}
 }
 
-void Processor::process() {
-
-    outfile = std::ofstream(filename);
+void Processor::emit(AST unit, const Interner& symbols) {
+	tree = std::move(unit);
+	nodes = tree.View();
+	names = symbols.Table();
+	if(!nodes.empty()) dfs(0);
+	if(out.Buffered() >= kFlushBytes) out.Flush();
+	tree = AST();
+	nodes = ASTView();
+}
 
-    outfile << "#include <string>\n#include <vector>\nusing namespace std;\n#include <iostream>\n";
-	outfile << "typedef long long ll;\ntypedef vector<int> vi;\nbool multiTest = 0;\n";
-	outfile << "ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;\n";
-	dfs(0);
+bool Processor::end() {
 
-	outfile << "int main() {\nint t = 1;\nif (multiTest) cin >> t;\nfor (int ii = 0; ii < t; ii++) {solve(ii);} \n return 0;\n}";
-    outfile.flush();
-    outfile.close();
+	out << "int main() {\nint t = 1;\nif (multiTest) fio::read(t);\nfor (int ii = 0; ii < t; ii++) {solve(ii);} \nfio::flush();\n return 0;\n}";
+	return out.Close();
 
 }
\ No newline at end of file
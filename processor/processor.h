@@ -7,17 +7,90 @@
 #include <string>
 #include <memory>
 #include "../ast/ast.h"
+#include "../ast/visitor.h"
+#include "output_sink.h"
 #include <iostream>
-#include <fstream>
 
-class Processor {
+class Processor : public ASTVisitor<Processor> {
 public:
-    Processor(std::vector<ASTNode>, std::string);
-    std::vector<ASTNode> nodes;
+    // names resolves the symbols in nodes; it is only read when writing
+    // the output and has to outlive the processor. The work stack shares
+    // the tree's arena, if it has one.
+    Processor(AST, const Interner&, std::string);
+    // For writing a program piece by piece: begin(), then emit() for each
+    // parsed unit in order, then end(). process() is all three at once.
+    // The work stack outlives the units, so it stays on the heap.
+    explicit Processor(std::string);
+    // Emits a tree it doesn't own, e.g. one mapped from the parse cache;
+    // nodes and names have to outlive the processor.
+    Processor(ASTView, NameTable, std::string);
+    AST tree;       // storage for the tree being written, unless borrowed
+    ASTView nodes;
+    NameTable names;
     std::string filename;
-    std::ofstream outfile;
-    void process();
+    // Output is buffered here and written out by end() in one go, or
+    // between units once kFlushBytes have piled up.
+    OutputSink out;
+    static constexpr size_t kFlushBytes = 1 << 20;
+    // Writes to target instead of creating filename; call before begin().
+    void setOutput(std::unique_ptr<OutputTarget> target);
+    // The text every output starts with: includes, the I/O runtime,
+    // typedefs and globals.
+    static std::string_view Preamble();
+    // Starts the output with an #include of path, a header holding
+    // Preamble() (see PreambleCache), instead of the preamble itself; call
+    // before begin().
+    void setPreambleHeader(std::string path);
+    // process() and end() return false if the output could not be written.
+    bool process();
+    void begin();
+    // Writes the statements under the PROGRAM node of a unit's nodes and
+    // frees them; symbols only has to live for the call.
+    void emit(AST, const Interner& symbols);
+    bool end();
     void dfs(int);
+    std::string_view nameOf(int) const;
+
+    // Emission runs off an explicit work stack instead of recursion, so
+    // nesting depth is bounded by memory rather than the native stack. An
+    // item is a node still to expand, or text to write (node == -1); the
+    // stack is a member so its storage is reused.
+    struct EmitItem {
+        int node;
+        std::string_view text;
+    };
+    ArenaVector<EmitItem> work;
+    void expand(int);
+    void child(int node) { work.push_back({node, {}}); }
+    void text(std::string_view t) { work.push_back({-1, t}); }
+    void statements(int block);
+
+    // Expansion of each node kind, dispatched by expand() through
+    // ASTVisitor. Kinds without a handler write nothing.
+    void visitProgram(int);
+    void visitFunction(int);
+    void visitFunctionCall(int);
+    void visitFor(int);
+    void visitForn(int);
+    void visitWhile(int);
+    void visitIf(int);
+    void visitBlock(int);
+    void visitDeclaration(int);
+    void visitIdentifier(int);
+    void visitPostfixOperator(int);
+    void visitReturn(int);
+    void visitUnaryOperator(int);
+    void visitIntLiteral(int);
+    void visitFloatLiteral(int);
+    void visitStringLiteral(int);
+    void visitCharLiteral(int);
+    void visitBinaryOperator(int);
+    void visitCout(int);
+    void visitCin(int);
+
+private:
+    std::unique_ptr<OutputTarget> target;
+    std::string preambleHeader;
 };
 
 #endif // PROCESSOR_H
@@ -0,0 +1,45 @@
+// stream_translator.cpp
+
+#include "stream_translator.h"
+#include "processor.h"
+#include "../parser/parser.h"
+#include "../parser/unit_stream.h"
+
+StreamResult TranslateStream(int fd, const std::string& output, size_t chunkSize,
+                             Arena* arena, PassManager* passes) {
+    return TranslateStream(fd, std::make_unique<FileTarget>(output), chunkSize, arena, passes);
+}
+
+StreamResult TranslateStream(int fd, std::unique_ptr<OutputTarget> target,
+                             size_t chunkSize, Arena* arena, PassManager* passes,
+                             const std::string& preambleHeader) {
+    Arena local;
+    if (!arena) arena = &local;
+    StreamResult result;
+    std::vector<std::string>& errors = result.errors;
+    UnitStream units(fd, chunkSize);
+    Processor processor("");
+    processor.setOutput(std::move(target));
+    processor.setPreambleHeader(preambleHeader);
+    processor.begin();
+
+    TokenBuffer unit;
+    while (units.Next(unit, arena)) {
+        {
+            Parser parser(std::move(unit));
+            parser.indexBase = units.Base();
+            parser.parseProgram();
+            errors.insert(errors.end(), parser.errors.begin(), parser.errors.end());
+            if (passes) passes->Run(parser.nodes, parser.names());
+            processor.emit(std::move(parser.nodes), parser.names());
+        }
+        // the unit's tokens and nodes went with the parser
+        arena->Reset();
+    }
+
+    bool written = processor.end();
+    if (units.Failed()) errors.push_back("Error reading input");
+    if (!written) errors.push_back("Error writing output");
+    result.ok = written && !units.Failed();
+    return result;
+}
@@ -0,0 +1,52 @@
+// stream_translator.h
+
+#ifndef STREAM_TRANSLATOR_H
+#define STREAM_TRANSLATOR_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../lexer/stream_lexer.h"
+#include "../memory/arena.h"
+#include "output_sink.h"
+#include "../ast/pass.h"
+
+// Translates the program read from fd into output without ever holding all
+// of it: tokens are pulled through a UnitStream, each top-level unit is
+// parsed by a fresh Parser, written by the Processor and then freed. Peak
+// memory follows the largest function instead of the input size.
+//
+// For a program that parses cleanly, and without passes, the output is the
+// same as lexing, parsing and processing the whole file. After an error
+// each unit still starts fresh at the next function, so the errors that
+// follow the first one can differ. The parser errors come back in input
+// order, with token indices counted from the start of the input. Does not
+// take ownership of fd.
+//
+// Each unit's tokens and nodes come from arena (a private one if null),
+// which is reset once the unit is written, so steady state allocates
+// nothing from the heap.
+//
+// passes, if given, run over each unit's tree before it is written; see
+// AddStandardPasses for which passes are safe one unit at a time.
+//
+// Output goes to the file output, or to target; either way it is written
+// out whenever Processor::kFlushBytes have piled up, so it never has to fit
+// in memory either. With a preambleHeader it starts with an #include of
+// that instead of the preamble (Processor::setPreambleHeader).
+struct StreamResult {
+    std::vector<std::string> errors;
+    // false if the input couldn't be read or the output not written, which
+    // errors then ends with
+    bool ok = true;
+};
+
+StreamResult TranslateStream(int fd, const std::string& output,
+                             size_t chunkSize = StreamLexer::kDefaultChunkSize,
+                             Arena* arena = nullptr, PassManager* passes = nullptr);
+StreamResult TranslateStream(int fd, std::unique_ptr<OutputTarget> target,
+                             size_t chunkSize = StreamLexer::kDefaultChunkSize,
+                             Arena* arena = nullptr, PassManager* passes = nullptr,
+                             const std::string& preambleHeader = "");
+
+#endif // STREAM_TRANSLATOR_H
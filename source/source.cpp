@@ -0,0 +1,101 @@
+// source.cpp
+
+#include "source.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utility>
+
+const char SourceBuffer::kEmpty[SourceBuffer::kPadding] = {};
+
+SourceBuffer::SourceBuffer(std::string text) : owned(std::move(text)) {
+    size = owned.size();
+    owned.resize(size + kPadding, '\0');
+    data = owned.data();
+}
+
+SourceBuffer::~SourceBuffer() {
+    Release();
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept {
+    if (this == &other) return *this;
+    Release();
+    mapping = other.mapping;
+    mappingSize = other.mappingSize;
+    owned = std::move(other.owned);
+    size = other.size;
+    // the owned string may have moved its bytes (SSO), so re-point at it
+    data = mapping ? other.data : owned.data();
+
+    other.mapping = nullptr;
+    other.mappingSize = 0;
+    other.data = kEmpty;
+    other.size = 0;
+    return *this;
+}
+
+void SourceBuffer::Release() {
+    if (mapping) {
+        munmap(mapping, mappingSize);
+    }
+    mapping = nullptr;
+    mappingSize = 0;
+    owned.clear();
+    data = kEmpty;
+    size = 0;
+}
+
+bool SourceBuffer::Open(const std::string& path) {
+    Release();
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+        // Reserve the file's pages plus one zero page, then map the file over
+        // the front of the reservation. The tail of the last file page is
+        // zero-filled by the kernel and the extra page provides the rest of
+        // the padding, so the file is never copied.
+        size_t page = sysconf(_SC_PAGESIZE);
+        size_t fileSpan = (st.st_size + page - 1) / page * page;
+        size_t total = fileSpan + page;
+        void* base = mmap(nullptr, total, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+            void* p = mmap(base, st.st_size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fd, 0);
+            if (p != MAP_FAILED) {
+                madvise(p, st.st_size, MADV_SEQUENTIAL);
+                mapping = base;
+                mappingSize = total;
+                data = static_cast<const char*>(p);
+                size = st.st_size;
+                close(fd);
+                return true;
+            }
+            munmap(base, total);
+        }
+    }
+
+    // Not mappable: fall back to reading the whole thing.
+    char chunk[1 << 16];
+    ssize_t n;
+    while ((n = read(fd, chunk, sizeof(chunk))) > 0) {
+        owned.append(chunk, n);
+    }
+    close(fd);
+    if (n < 0) {
+        owned.clear();
+        return false;
+    }
+    size = owned.size();
+    owned.resize(size + kPadding, '\0');
+    data = owned.data();
+    return true;
+}
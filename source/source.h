@@ -0,0 +1,51 @@
+// source.h
+
+#ifndef SOURCE_H
+#define SOURCE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Read-only program text. Regular files are memory-mapped so the lexer can
+// hand out tokens that point straight into the mapping; anything that cannot
+// be mapped (pipes, empty files) is read into an owned string instead.
+//
+// Every Token, TokenBuffer and Parser built over View() borrows from this
+// object, so it has to outlive them.
+//
+// View() is always followed by at least kPadding readable NUL bytes, so
+// scanners can use the NUL as an end sentinel and read a little past the
+// end without bounds checks.
+class SourceBuffer {
+public:
+    static constexpr size_t kPadding = 64;
+
+    SourceBuffer() = default;
+    explicit SourceBuffer(std::string text);
+    ~SourceBuffer();
+
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+    SourceBuffer(SourceBuffer&& other) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& other) noexcept;
+
+    // Returns false if the file could not be opened or read.
+    bool Open(const std::string& path);
+
+    std::string_view View() const { return std::string_view(data, size); }
+    bool IsMapped() const { return mapping != nullptr; }
+
+private:
+    void Release();
+
+    static const char kEmpty[kPadding];  // what an empty buffer points at
+
+    const char* data = kEmpty;
+    size_t size = 0;
+    void* mapping = nullptr;  // base of the mmap'd region (file + zero pages)
+    size_t mappingSize = 0;
+    std::string owned;        // fallback storage when the file isn't mapped
+};
+
+#endif // SOURCE_H
@@ -0,0 +1,96 @@
+// fpp_gen.cpp
+//
+// Writes a synthetic force++ program for scale testing. Build with
+// `make fpp_gen` and run, e.g.
+//
+//   ./fpp_gen --size 512M --seed 7 -o big.fpp
+//   ./fpp_gen --functions 1000 --depth 5 --ident-length 24
+//
+// The same flags always produce the same file.
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "generator.h"
+
+void usage() {
+    std::cerr <<
+        "Usage: ./fpp_gen [options]\n"
+        "  --seed N            random seed (default 1)\n"
+        "  --size N[K|M|G]     approximate output size (default 64K)\n"
+        "  --functions N       exact number of functions before solve; overrides --size\n"
+        "  --statements N      max statements per block (default 6)\n"
+        "  --depth N           max nesting of forn/for/while/if (default 3)\n"
+        "  --expr-depth N      max operator nesting in an expression (default 3)\n"
+        "  --ident-length N    minimum identifier length (default 6)\n"
+        "  --params N          max parameters per function (default 3)\n"
+        "  --calls N           percent of expression leaves that are calls (default 10)\n"
+        "  -o FILE             output file (default stdout)\n";
+}
+
+// Accepts a K, M or G suffix (powers of 1024).
+bool parseSize(const char* text, size_t& out) {
+    char* end;
+    unsigned long long n = std::strtoull(text, &end, 10);
+    if (end == text) return false;
+    switch (*end) {
+    case 'k': case 'K': n <<= 10; end++; break;
+    case 'm': case 'M': n <<= 20; end++; break;
+    case 'g': case 'G': n <<= 30; end++; break;
+    default: break;
+    }
+    if (*end != '\0') return false;
+    out = n;
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    GeneratorOptions options;
+    const char* output = nullptr;
+
+    for (int i = 1; i < argc; i++) {
+        std::string flag = argv[i];
+        if (i + 1 >= argc) {
+            usage();
+            return 1;
+        }
+        const char* value = argv[++i];
+        size_t n;
+        if (!parseSize(value, n) && flag != "-o") {
+            std::cerr << "Bad value for " << flag << ": " << value << "\n";
+            return 1;
+        }
+
+        if (flag == "--seed") options.seed = n;
+        else if (flag == "--size") options.targetBytes = n;
+        else if (flag == "--functions") options.functions = n;
+        else if (flag == "--statements") options.maxStatements = static_cast<int>(n);
+        else if (flag == "--depth") options.maxDepth = static_cast<int>(n);
+        else if (flag == "--expr-depth") options.maxExprDepth = static_cast<int>(n);
+        else if (flag == "--ident-length") options.identLength = static_cast<int>(n);
+        else if (flag == "--params") options.maxParams = static_cast<int>(n);
+        else if (flag == "--calls") options.callPercent = static_cast<int>(n);
+        else if (flag == "-o") output = value;
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    std::FILE* file = output ? std::fopen(output, "wb") : stdout;
+    if (!file) {
+        std::cerr << "Error opening " << output << std::endl;
+        return 1;
+    }
+    size_t written = ProgramGenerator::Write(options, file);
+    bool ok = std::fflush(file) == 0 && !std::ferror(file);
+    if (output) ok &= std::fclose(file) == 0;
+    if (!ok) {
+        std::cerr << "Error writing output" << std::endl;
+        return 1;
+    }
+    if (output) std::cerr << "Wrote " << written << " bytes to " << output << "\n";
+    return 0;
+}
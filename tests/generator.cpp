@@ -0,0 +1,293 @@
+// generator.cpp
+
+#include "generator.h"
+
+namespace {
+
+constexpr size_t kFlushBytes = 1 << 20;
+constexpr int kMaxLoopBound = 4;
+
+const char* const kArithmetic[] = {"+", "-", "*"};
+const char* const kComparison[] = {"<", ">", "<=", ">=", "==", "!="};
+const char* const kLogical[] = {"&&", "||"};
+
+void Indent(std::string& out, int indent) {
+    out.append(4 * indent, ' ');
+}
+
+}  // namespace
+
+ProgramGenerator::ProgramGenerator(const GeneratorOptions& options)
+    : options(options), state(options.seed)
+{
+}
+
+// splitmix64, so a seed means the same program on every platform (the
+// standard distributions are implementation-defined)
+uint64_t ProgramGenerator::Next() {
+    uint64_t z = (state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+int ProgramGenerator::Below(int n) {
+    return n <= 1 ? 0 : static_cast<int>(Next() % static_cast<uint64_t>(n));
+}
+
+bool ProgramGenerator::Chance(int percent) {
+    return Below(100) < percent;
+}
+
+// prefix, index, then letters up to identLength. The index is followed only
+// by letters, so distinct indices never produce the same name.
+std::string ProgramGenerator::MakeName(char prefix, size_t index) const {
+    std::string name(1, prefix);
+    name += std::to_string(index);
+    for (int i = 0; static_cast<int>(name.size()) < options.identLength; i++) {
+        name += static_cast<char>('a' + i % 26);
+    }
+    return name;
+}
+
+std::string ProgramGenerator::NewLocal(char prefix) {
+    return MakeName(prefix, localCount++);
+}
+
+void ProgramGenerator::NextFunction(std::string& out) {
+    std::string name = MakeName('f', functionCount);
+    int params = Below(options.maxParams + 1);
+    Function(out, name, params);
+
+    Callee callee = {name, params};
+    if (callees.size() < kCallWindow) callees.push_back(callee);
+    else callees[functionCount % kCallWindow] = callee;
+    functionCount++;
+}
+
+void ProgramGenerator::Finish(std::string& out) {
+    Function(out, "solve", 1);
+}
+
+void ProgramGenerator::Function(std::string& out, const std::string& name, int params) {
+    scope.clear();
+    localCount = 0;
+
+    out += "int ";
+    out += name;
+    out += '(';
+    for (int i = 0; i < params; i++) {
+        if (i) out += ", ";
+        scope.push_back({MakeName('p', i), true});
+        out += "int ";
+        out += scope.back().name;
+    }
+    out += ") {\n";
+
+    int statements = 1 + Below(options.maxStatements);
+    for (int i = 0; i < statements; i++) {
+        Statement(out, 1, options.maxDepth);
+    }
+
+    Indent(out, 1);
+    out += "return ";
+    Expression(out, options.maxExprDepth);
+    out += ";\n}\n\n";
+}
+
+void ProgramGenerator::Block(std::string& out, int indent, int depth) {
+    size_t mark = scope.size();
+    int statements = 1 + Below(options.maxStatements);
+    for (int i = 0; i < statements; i++) {
+        Statement(out, indent, depth);
+    }
+    scope.resize(mark);
+}
+
+void ProgramGenerator::Statement(std::string& out, int indent, int depth) {
+    bool hasAssignable = false;
+    for (const Variable& v : scope) hasAssignable |= v.assignable;
+
+    int kind = Below(depth > 0 ? 10 : 6);
+    if (kind == 1 && !hasAssignable) kind = 0;
+    if (kind == 2 && (callees.empty() || options.callPercent == 0)) kind = 0;
+    if (kind == 3 && scope.empty()) kind = 0;
+
+    Indent(out, indent);
+    switch (kind) {
+    case 0:
+    case 4:
+    case 5: {
+        // declaration; the name is only visible after its initializer
+        std::string name = NewLocal('v');
+        out += "int ";
+        out += name;
+        out += " = ";
+        Expression(out, options.maxExprDepth);
+        out += ";\n";
+        scope.push_back({name, true});
+        break;
+    }
+    case 1:
+        out += AnyVariable(true);
+        out += " = ";
+        Expression(out, options.maxExprDepth);
+        out += ";\n";
+        break;
+    case 2:
+        Call(out, options.maxExprDepth);
+        out += ";\n";
+        break;
+    case 3:
+        out += "cout(";
+        out += AnyVariable(false);
+        out += ");\n";
+        break;
+    case 6: {
+        std::string index = NewLocal('i');
+        out += "forn(" + index + ", " + std::to_string(1 + Below(kMaxLoopBound)) + ") {\n";
+        scope.push_back({index, false});
+        Block(out, indent + 1, depth - 1);
+        scope.pop_back();
+        Indent(out, indent);
+        out += "}\n";
+        break;
+    }
+    case 7: {
+        std::string index = NewLocal('i');
+        out += "for (int " + index + " = 0; " + index + " < " +
+               std::to_string(1 + Below(kMaxLoopBound)) + "; " + index + "++) {\n";
+        scope.push_back({index, false});
+        Block(out, indent + 1, depth - 1);
+        scope.pop_back();
+        Indent(out, indent);
+        out += "}\n";
+        break;
+    }
+    case 8: {
+        // counts down, and nothing else assigns the counter
+        std::string counter = NewLocal('c');
+        out += "int " + counter + " = " + std::to_string(1 + Below(kMaxLoopBound)) + ";\n";
+        scope.push_back({counter, false});
+        Indent(out, indent);
+        out += "while (" + counter + " > 0) {\n";
+        Block(out, indent + 1, depth - 1);
+        Indent(out, indent + 1);
+        out += counter + " = " + counter + " - 1;\n";
+        Indent(out, indent);
+        out += "}\n";
+        break;
+    }
+    default:
+        out += "if (";
+        Condition(out);
+        out += ") {\n";
+        Block(out, indent + 1, depth - 1);
+        if (Chance(50)) {
+            Indent(out, indent);
+            out += "} else {\n";
+            Block(out, indent + 1, depth - 1);
+        }
+        Indent(out, indent);
+        out += "}\n";
+        break;
+    }
+}
+
+void ProgramGenerator::Expression(std::string& out, int depth) {
+    if (depth <= 0 || Chance(30)) {
+        Leaf(out, depth);
+        return;
+    }
+
+    bool paren = Chance(30);
+    if (paren) out += '(';
+    int kind = Below(10);
+    if (kind == 9) {
+        out += Chance(50) ? "-" : "!";
+        out += '(';
+        Expression(out, depth - 1);
+        out += ')';
+    } else if (kind == 5) {
+        // only literal divisors, so the translated program never divides by zero
+        Expression(out, depth - 1);
+        out += " / " + std::to_string(1 + Below(9));
+    } else {
+        const char* op = kind < 5 ? kArithmetic[Below(3)]
+                       : kind < 8 ? kComparison[Below(6)]
+                       : kLogical[Below(2)];
+        Expression(out, depth - 1);
+        out += ' ';
+        out += op;
+        out += ' ';
+        Expression(out, depth - 1);
+    }
+    if (paren) out += ')';
+}
+
+void ProgramGenerator::Condition(std::string& out) {
+    Expression(out, options.maxExprDepth - 1);
+    out += ' ';
+    out += kComparison[Below(6)];
+    out += ' ';
+    Expression(out, options.maxExprDepth - 1);
+}
+
+// Calls are only allowed down to depth 0, so their arguments (at depth - 1)
+// are plain leaves and nesting stays bounded.
+void ProgramGenerator::Leaf(std::string& out, int depth) {
+    if (depth >= 0 && !callees.empty() && Chance(options.callPercent)) {
+        Call(out, depth);
+    } else if (!scope.empty() && Chance(60)) {
+        out += AnyVariable(false);
+    } else {
+        out += std::to_string(Below(100));
+    }
+}
+
+void ProgramGenerator::Call(std::string& out, int depth) {
+    const Callee& callee = callees[Below(static_cast<int>(callees.size()))];
+    out += callee.name;
+    out += '(';
+    for (int i = 0; i < callee.params; i++) {
+        if (i) out += ", ";
+        Expression(out, depth - 1);
+    }
+    out += ')';
+}
+
+const std::string& ProgramGenerator::AnyVariable(bool assignable) {
+    for (;;) {
+        const Variable& v = scope[Below(static_cast<int>(scope.size()))];
+        if (v.assignable || !assignable) return v.name;
+    }
+}
+
+std::string ProgramGenerator::Generate(const GeneratorOptions& options) {
+    ProgramGenerator generator(options);
+    std::string out;
+    while (options.functions ? generator.functionCount < options.functions
+                             : out.size() < options.targetBytes) {
+        generator.NextFunction(out);
+    }
+    generator.Finish(out);
+    return out;
+}
+
+size_t ProgramGenerator::Write(const GeneratorOptions& options, std::FILE* file) {
+    ProgramGenerator generator(options);
+    std::string out;
+    out.reserve(2 * kFlushBytes);
+    size_t written = 0;
+    while (options.functions ? generator.functionCount < options.functions
+                             : written + out.size() < options.targetBytes) {
+        generator.NextFunction(out);
+        if (out.size() >= kFlushBytes) {
+            written += std::fwrite(out.data(), 1, out.size(), file);
+            out.clear();
+        }
+    }
+    generator.Finish(out);
+    written += std::fwrite(out.data(), 1, out.size(), file);
+    return written;
+}
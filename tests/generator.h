@@ -0,0 +1,88 @@
+// generator.h
+
+#ifndef GENERATOR_H
+#define GENERATOR_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Shape of a generated program. Every size knob is an upper bound; the
+// actual counts are drawn from the seeded generator.
+struct GeneratorOptions {
+    uint64_t seed = 1;
+    size_t functions = 0;          // function definitions before solve; 0 = until targetBytes
+    size_t targetBytes = 64 << 10; // only used when functions == 0
+    int maxStatements = 6;         // statements per block
+    int maxDepth = 3;              // nesting of forn / for / while / if
+    int maxExprDepth = 3;          // operator nesting inside one expression
+    int identLength = 6;           // identifiers are padded to at least this length
+    int maxParams = 3;
+    int callPercent = 10;          // chance that an expression leaf is a call; 0 = no calls at all
+};
+
+// Emits random but valid force++ programs: a run of int functions, each
+// only calling functions defined before it, followed by the solve(int) the
+// processor's main expects. The same options always give the same bytes.
+//
+// Output is produced one function at a time, so Write() can stream
+// gigabytes while holding a single function in memory. Loop bounds are small
+// literals and while loops count down, so with callPercent = 0 the
+// translated program also terminates quickly when run.
+class ProgramGenerator {
+public:
+    explicit ProgramGenerator(const GeneratorOptions& options);
+
+    // Appends the next function definition to out.
+    void NextFunction(std::string& out);
+    // Appends solve, which ends the program.
+    void Finish(std::string& out);
+
+    // Whole program in memory, for tests and small inputs.
+    static std::string Generate(const GeneratorOptions& options);
+    // Streams the program to file; returns the number of bytes written.
+    static size_t Write(const GeneratorOptions& options, std::FILE* file);
+
+private:
+    // Recently defined functions that later ones may call.
+    struct Callee {
+        std::string name;
+        int params;
+    };
+    static constexpr size_t kCallWindow = 64;
+
+    uint64_t Next();
+    int Below(int n);  // uniform in [0, n)
+    bool Chance(int percent);
+
+    std::string MakeName(char prefix, size_t index) const;
+    std::string NewLocal(char prefix);
+
+    void Function(std::string& out, const std::string& name, int params);
+    void Block(std::string& out, int indent, int depth);
+    void Statement(std::string& out, int indent, int depth);
+    void Expression(std::string& out, int depth);
+    void Condition(std::string& out);
+    void Leaf(std::string& out, int depth);
+    void Call(std::string& out, int depth);
+    // Picks a variable in scope; loop indices and while counters are
+    // readable but never assigned, so every loop still terminates.
+    const std::string& AnyVariable(bool assignable);
+
+    GeneratorOptions options;
+    uint64_t state;
+    size_t functionCount = 0;
+    std::vector<Callee> callees;  // ring of the last kCallWindow functions
+
+    struct Variable {
+        std::string name;
+        bool assignable;
+    };
+
+    // Per-function state: variables in scope and a counter for fresh names.
+    std::vector<Variable> scope;
+    size_t localCount = 0;
+};
+
+#endif // GENERATOR_H
@@ -0,0 +1,123 @@
+// lexer_bench.cpp
+//
+// Throughput comparison between the lexer engines. Build with
+// `make lexer_bench` (optimized) and run ./lexer_bench [megabytes].
+
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../token/token.h"
+#include "../lexer/lexer.h"
+#include "../lexer/dfa_lexer.h"
+#include "../lexer/scan.h"
+
+std::string readFile(const std::string& filename) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error opening " << filename << std::endl;
+        exit(1);
+    }
+    std::string content((std::istreambuf_iterator<char>(file)),
+                         std::istreambuf_iterator<char>());
+    return content;
+}
+
+// Concatenates the sample programs until the input reaches the target size.
+std::string buildInput(size_t bytes) {
+    std::vector<std::string> samples;
+    for (int i = 1; i <= 5; i++) {
+        samples.push_back(readFile("tests/parser_tests/parser_test" + std::to_string(i) + ".fpp"));
+        samples.push_back(readFile("tests/processor_tests/processor_test" + std::to_string(i) + ".fpp"));
+    }
+    std::string input;
+    input.reserve(bytes + 4096);
+    for (size_t i = 0; input.size() < bytes; i++) {
+        input += samples[i % samples.size()];
+        input += '\n';
+    }
+    return input;
+}
+
+// Machine-generated style: deep indentation and long identifiers.
+std::string buildGeneratedInput(size_t bytes) {
+    std::string input;
+    input.reserve(bytes + 4096);
+    for (size_t i = 0; input.size() < bytes; i++) {
+        input.append(4 * (1 + i % 12), ' ');
+        input += "generated_accumulator_value_" + std::to_string(i % 97);
+        input += " = generated_accumulator_value_" + std::to_string((i + 1) % 97);
+        input += " + 1234567890 * intermediate_result_" + std::to_string(i % 13) + ";\n";
+    }
+    return input;
+}
+
+// Large embedded string tables.
+std::string buildStringTableInput(size_t bytes) {
+    std::string input;
+    input.reserve(bytes + 4096);
+    for (size_t i = 0; input.size() < bytes; i++) {
+        input += "    cout(\"";
+        input.append(150 + i % 100, 'a' + i % 26);
+        input += "\\t\\\"quoted\\\" ";
+        input.append(100, 'z');
+        input += "\");\n";
+    }
+    return input;
+}
+
+template <typename L>
+double run(const std::string& input, size_t& count, uint64_t& checksum) {
+    auto start = std::chrono::steady_clock::now();
+    L lexer(input);
+    count = 0;
+    checksum = 0;
+    for (;;) {
+        Token tok = lexer.NextToken();
+        count++;
+        checksum = checksum * 31 + (uint64_t)tok.type + tok.literal.size();
+        if (tok.type == TokenType::EOF_TOKEN) break;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+template <typename L>
+void report(const char* name, const std::string& input, size_t& count, uint64_t& checksum) {
+    double best = 1e9;
+    for (int i = 0; i < 5; i++) {
+        double t = run<L>(input, count, checksum);
+        if (t < best) best = t;
+    }
+    double mb = input.size() / (1024.0 * 1024.0);
+    std::cout << name << ": " << mb / best << " MB/s, "
+              << count / best / 1e6 << " Mtokens/s (" << count << " tokens)\n";
+}
+
+int main(int argc, char* argv[]) {
+    size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    std::cout << "Scan kernels: " << scan::active->name << "\n";
+
+    std::vector<std::pair<const char*, std::string>> inputs = {
+        {"sample programs", buildInput(megabytes << 20)},
+        {"generated (indented, long identifiers)", buildGeneratedInput(megabytes << 20)},
+        {"string tables", buildStringTableInput(megabytes << 20)},
+    };
+    for (const auto& in : inputs) {
+        const std::string& input = in.second;
+        std::cout << "Lexing " << input.size() << " bytes of " << in.first << "\n";
+
+        size_t handCount, dfaCount;
+        uint64_t handSum, dfaSum;
+        report<Lexer>("  Lexer (hand-written)", input, handCount, handSum);
+        report<DfaLexer>("  DfaLexer (tables)   ", input, dfaCount, dfaSum);
+
+        // both engines must agree on every token
+        assert(handCount == dfaCount && handSum == dfaSum);
+    }
+    return 0;
+}
@@ -3,9 +3,17 @@
 #include <vector>
 #include <fstream>
 #include <cassert>
+#include <cctype>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "../token/token.h"
 #include "../lexer/lexer.h"
+#include "../lexer/dfa_lexer.h"
+#include "../lexer/scan.h"
+#include "../lexer/stream_lexer.h"
+#include "../lexer/parallel_lexer.h"
+#include "../source/source.h"
 
 // Function to compare expected and actual tokens
 void compareTokens(const std::vector<Token>& expected, const std::vector<Token>& actual) {
@@ -33,6 +41,15 @@ void test_program2();
 void test_program3();
 void test_program4();
 void test_program5();
+void test_program6();
+void test_program7();
+void test_program8();
+void test_program9();
+void test_program10();
+void test_program11();
+void test_program12();
+void test_program13();
+void test_program14();
 
 int main() {
     std::cout << "Running Lexer Tests" << std::endl;
@@ -41,6 +58,15 @@ int main() {
     test_program3();
     test_program4();
     test_program5();
+    test_program6();
+    test_program7();
+    test_program8();
+    test_program9();
+    test_program10();
+    test_program11();
+    test_program12();
+    test_program13();
+    test_program14();
     std::cout << "All tests passed!" << std::endl;
     return 0;
 }
@@ -312,3 +338,381 @@ void test_program5() {
 
     std::cout << "test_program5 passed" << std::endl;
 }
+
+// Test Program 6: lexing straight out of a memory-mapped SourceBuffer
+void test_program6() {
+    SourceBuffer source;
+    if (!source.Open("tests/lexer_tests/lexer_test1.fpp")) {
+        std::cerr << "Error opening lexer_test1.fpp" << std::endl;
+        assert(false);
+    }
+    assert(source.IsMapped());
+    std::string_view text = source.View();
+
+    Lexer lexer(text);
+
+    std::vector<Token> tokens;
+    Token tok = lexer.NextToken();
+    while (tok.type != TokenType::EOF_TOKEN) {
+        // literals are views into the mapping, not copies
+        assert(tok.literal.data() >= text.data());
+        assert(tok.literal.data() + tok.literal.size() <= text.data() + text.size());
+        tokens.push_back(tok);
+        tok = lexer.NextToken();
+    }
+    tokens.push_back(tok);
+
+    assert(tokens.size() == 18);
+    assert(tokens[2].type == TokenType::ASSIGN && tokens[2].literal == "=");
+    assert(tokens[11].type == TokenType::IDENT && tokens[11].literal == "result");
+
+    // moving the buffer keeps the mapping, and with it every token, valid
+    SourceBuffer moved(std::move(source));
+    assert(moved.View().data() == text.data());
+    assert(tokens[11].literal == "result");
+
+    std::cout << "test_program6 passed" << std::endl;
+}
+
+// Test Program 7: the table-driven DfaLexer must match Lexer token for token
+template <typename L>
+std::vector<Token> lexAll(const std::string& program) {
+    L lexer(program);
+    std::vector<Token> tokens;
+    Token tok = lexer.NextToken();
+    while (tok.type != TokenType::EOF_TOKEN) {
+        tokens.push_back(tok);
+        tok = lexer.NextToken();
+    }
+    tokens.push_back(tok);
+    return tokens;
+}
+
+void test_program7() {
+    std::vector<std::string> programs = {
+        "a==b=c!=!d<=<e>=>f&&&g|||h++++i---j",
+        "x1 _y 9z 3.14 7. .5 #$ @ int forn for while cout",
+        "  \t\n\v\f\r ",
+        "",
+    };
+    for (int i = 1; i <= 5; i++) {
+        std::ifstream file("tests/lexer_tests/lexer_test" + std::to_string(i) + ".fpp");
+        assert(file.is_open());
+        programs.emplace_back((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    }
+
+    for (const std::string& program : programs) {
+        compareTokens(lexAll<Lexer>(program), lexAll<DfaLexer>(program));
+    }
+
+    std::cout << "test_program7 passed" << std::endl;
+}
+
+// Test Program 8: keyword lookup, including near misses that share a hash slot
+void test_program8() {
+    std::vector<std::pair<std::string, TokenType>> keywords = {
+        {"int", TokenType::INT},       {"float", TokenType::FLOAT},
+        {"char", TokenType::CHAR},     {"bool", TokenType::BOOL},
+        {"varchar", TokenType::VARCHAR}, {"vi", TokenType::VI},
+        {"void", TokenType::VOID},     {"forn", TokenType::FORN},
+        {"for", TokenType::FOR},       {"while", TokenType::WHILE},
+        {"cout", TokenType::COUT},     {"if", TokenType::IF},
+        {"else", TokenType::ELSE},     {"return", TokenType::RETURN},
+        {"true", TokenType::TRUE},     {"false", TokenType::FALSE},
+        {"cin", TokenType::CIN},
+    };
+    for (const auto& kw : keywords) {
+        assert(LookupIdent(kw.first) == kw.second);
+    }
+
+    std::vector<std::string> identifiers = {
+        "i", "n", "fo", "fornn", "form", "Int", "iNt", "whilee", "vii",
+        "returns", "varchars", "cout_", "_if", "ef", "tt", "x0", "cinn", "ci",
+    };
+    for (const auto& id : identifiers) {
+        assert(LookupIdent(id) == TokenType::IDENT);
+    }
+
+    std::cout << "test_program8 passed" << std::endl;
+}
+
+// Test Program 9: every SIMD scanner agrees with the scalar one at every
+// offset and length, including runs that end exactly on a vector boundary
+void test_program9() {
+    std::vector<std::string> buffers = {
+        std::string(100, ' ') + "x",
+        std::string(64, '\t') + std::string(3, '\n') + "\r\v\f;",
+        "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789@",
+        std::string(31, 'a') + "[" + std::string(32, 'Z') + "`" + std::string(16, '_') + "{",
+        std::string(47, '7') + "." + std::string(17, '0') + "/9:",
+        std::string("\x80\xff\x00 a1") + std::string(40, '\x1f'),
+        std::string(33, 's') + "\\" + std::string(20, 't') + "'" + std::string(17, 'u') + "\"\n",
+    };
+
+    const scan::Kernels* scalar = scan::Supported()[0];
+    for (const scan::Kernels* k : scan::Supported()) {
+        for (const std::string& buf : buffers) {
+            const char* end = buf.data() + buf.size();
+            for (size_t start = 0; start <= buf.size(); start++) {
+                for (const char* e = buf.data() + start; e <= end; e++) {
+                    const char* p = buf.data() + start;
+                    assert(k->whitespaceRun(p, e) == scalar->whitespaceRun(p, e));
+                    assert(k->identifierRun(p, e) == scalar->identifierRun(p, e));
+                    assert(k->digitRun(p, e) == scalar->digitRun(p, e));
+                    assert(k->quotedRun(p, e, '"') == scalar->quotedRun(p, e, '"'));
+                    assert(k->quotedRun(p, e, '\'') == scalar->quotedRun(p, e, '\''));
+                }
+            }
+        }
+    }
+
+    // The one-byte classes the lexer gates on match the C locale, and bytes
+    // >= 0x80 belong to none of them
+    for (int c = 0; c < 256; c++) {
+        bool ascii = c < 0x80;
+        assert(scan::IsSpace(c) == (ascii && std::isspace(c) != 0));
+        assert(scan::IsDigit(c) == (ascii && std::isdigit(c) != 0));
+        assert(scan::IsIdentStart(c) == (ascii && (std::isalpha(c) || c == '_')));
+        assert(scan::IsIdent(c) == (ascii && (std::isalnum(c) || c == '_')));
+    }
+
+    std::cout << "test_program9 passed (" << scan::active->name << ")" << std::endl;
+}
+
+// Test Program 10: StreamLexer with chunks small enough that tokens straddle
+// chunk boundaries still matches Lexer
+std::vector<std::pair<TokenType, std::string>> streamAll(int fd, size_t chunkSize) {
+    StreamLexer lexer(fd, chunkSize);
+    std::vector<std::pair<TokenType, std::string>> tokens;
+    for (;;) {
+        // literals only live until the next call, so copy them out
+        Token tok = lexer.NextToken();
+        tokens.emplace_back(tok.type, std::string(tok.literal));
+        if (tok.type == TokenType::EOF_TOKEN) break;
+    }
+    assert(!lexer.Failed());
+    return tokens;
+}
+
+void test_program10() {
+    std::vector<std::string> programs = {
+        "a==b=c!=!d<=<e>=>f&&&g|||h++++i---j",
+        "x1 _y 9z 3.14 7. .5 #$ @ int forn for while cout",
+        "averyveryverylongidentifierthatspansmanychunks = 1234567890.0987654321;",
+        "  \t\n ",
+        "",
+    };
+    for (int i = 1; i <= 5; i++) {
+        std::ifstream file("tests/lexer_tests/lexer_test" + std::to_string(i) + ".fpp");
+        assert(file.is_open());
+        programs.emplace_back((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+    }
+
+    for (const std::string& program : programs) {
+        std::vector<Token> expected = lexAll<Lexer>(program);
+        for (size_t chunkSize : {1, 2, 3, 7, 64, 1 << 16}) {
+            int fds[2];
+            assert(pipe(fds) == 0);
+            assert(write(fds[1], program.data(), program.size()) == (ssize_t)program.size());
+            close(fds[1]);
+
+            std::vector<std::pair<TokenType, std::string>> actual = streamAll(fds[0], chunkSize);
+            close(fds[0]);
+
+            assert(actual.size() == expected.size());
+            for (size_t j = 0; j < expected.size(); j++) {
+                assert(actual[j].first == expected[j].type);
+                assert(actual[j].second == expected[j].literal);
+            }
+        }
+    }
+
+    // and straight from a file descriptor
+    int fd = open("tests/lexer_tests/lexer_test3.fpp", O_RDONLY);
+    assert(fd >= 0);
+    std::vector<std::pair<TokenType, std::string>> tokens = streamAll(fd, 5);
+    close(fd);
+    assert(tokens.size() == 25);
+    assert(tokens[10].first == TokenType::FORN && tokens[10].second == "forn");
+
+    std::cout << "test_program10 passed" << std::endl;
+}
+
+// Test Program 11: Tokenize packs the same stream into a TokenBuffer, and a
+// cursor over it reads the tokens back in place
+void test_program11() {
+    std::ifstream file("tests/lexer_tests/lexer_test5.fpp");
+    assert(file.is_open());
+    std::string program((std::istreambuf_iterator<char>(file)),
+                        std::istreambuf_iterator<char>());
+
+    std::vector<Token> expected = lexAll<Lexer>(program);
+    Lexer lexer(program);
+    TokenBuffer tokens = lexer.Tokenize();
+    TokenCursor cursor(tokens);
+
+    assert(tokens.Size() == expected.size());
+    assert(cursor.Size() == (int)expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        assert(tokens.Type(i) == expected[i].type);
+        assert(tokens.Literal(i) == expected[i].literal);
+        assert(cursor.Type(i) == expected[i].type);
+        assert(cursor.Literal(i) == expected[i].literal);
+        // literals are still views into the program text
+        if (!expected[i].literal.empty()) {
+            assert(cursor.Literal(i).data() == expected[i].literal.data());
+        }
+    }
+    assert(tokens.Type(tokens.Size() - 1) == TokenType::EOF_TOKEN);
+
+    std::cout << "test_program11 passed" << std::endl;
+}
+
+// Test Program 12: parallel lexing over many small chunks stitches back into
+// exactly the serial token stream
+void assertSameBuffer(const TokenBuffer& expected, const TokenBuffer& actual) {
+    assert(expected.Size() == actual.Size());
+    for (size_t i = 0; i < expected.Size(); i++) {
+        assert(expected.Type(i) == actual.Type(i));
+        assert(expected.Literal(i) == actual.Literal(i));
+        assert(expected.Literal(i).data() == actual.Literal(i).data());
+        // chunks are merged in order, so symbols keep first-use numbering
+        assert(expected.SymbolAt(i) == actual.SymbolAt(i));
+    }
+    assert(expected.Names().Size() == actual.Names().Size());
+}
+
+void test_program12() {
+    std::string program;
+    for (int round = 0; round < 40; round++) {
+        for (int i = 1; i <= 5; i++) {
+            std::ifstream file("tests/lexer_tests/lexer_test" + std::to_string(i) + ".fpp");
+            assert(file.is_open());
+            program.append((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+            program += "\n\n   a==b&&&c 3.5. x_1\n";
+        }
+    }
+
+    Lexer lexer(program);
+    TokenBuffer expected = lexer.Tokenize();
+
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        for (size_t minChunk : {1ul, 7ul, 100ul, 1ul << 20}) {
+            assertSameBuffer(expected, TokenizeParallel(program, threads, minChunk));
+        }
+    }
+
+    // chunk boundaries always land just after a newline
+    std::vector<size_t> boundaries = FindChunkBoundaries(program, 16);
+    assert(boundaries.size() > 1 && boundaries[0] == 0);
+    for (size_t i = 1; i < boundaries.size(); i++) {
+        assert(boundaries[i] > boundaries[i - 1]);
+        assert(program[boundaries[i] - 1] == '\n');
+    }
+
+    // a NUL ends the input for the serial lexer, so it must for chunks too
+    std::string withNul = program;
+    withNul[withNul.size() / 2] = '\0';
+    Lexer nulLexer(withNul);
+    assertSameBuffer(nulLexer.Tokenize(), TokenizeParallel(withNul, 4, 1));
+
+    std::cout << "test_program12 passed" << std::endl;
+}
+
+// Test Program 13: string and char literals, raw slices and lazy decoding
+void test_program13() {
+    std::string longString = "\"" + std::string(100, 'x') + "\\\"" + std::string(40, 'y') + "\"";
+    std::string program = "cout(\"hello, \\\"world\\\"\\t!\"); char c = '\\n'; char q = '\\'';\n"
+                          "\"unterminated\n'x\\\n\"\" '' " + longString;
+
+    std::vector<Token> expected = {
+        Token(TokenType::COUT, "cout"),
+        Token(TokenType::LPAREN, "("),
+        Token(TokenType::STRING_LITERAL, "\"hello, \\\"world\\\"\\t!\""),
+        Token(TokenType::RPAREN, ")"),
+        Token(TokenType::SEMICOLON, ";"),
+        Token(TokenType::CHAR, "char"),
+        Token(TokenType::IDENT, "c"),
+        Token(TokenType::ASSIGN, "="),
+        Token(TokenType::CHAR_LITERAL, "'\\n'"),
+        Token(TokenType::SEMICOLON, ";"),
+        Token(TokenType::CHAR, "char"),
+        Token(TokenType::IDENT, "q"),
+        Token(TokenType::ASSIGN, "="),
+        Token(TokenType::CHAR_LITERAL, "'\\''"),
+        Token(TokenType::SEMICOLON, ";"),
+        // a literal can't cross a newline, even after a backslash
+        Token(TokenType::ILLEGAL, "\"unterminated"),
+        Token(TokenType::ILLEGAL, "'x\\"),
+        Token(TokenType::STRING_LITERAL, "\"\""),
+        Token(TokenType::CHAR_LITERAL, "''"),
+        Token(TokenType::STRING_LITERAL, longString),
+        Token(TokenType::EOF_TOKEN, ""),
+    };
+    compareTokens(expected, lexAll<Lexer>(program));
+    compareTokens(expected, lexAll<DfaLexer>(program));
+
+    int fds[2];
+    assert(pipe(fds) == 0);
+    assert(write(fds[1], program.data(), program.size()) == (ssize_t)program.size());
+    close(fds[1]);
+    std::vector<std::pair<TokenType, std::string>> streamed = streamAll(fds[0], 8);
+    close(fds[0]);
+    assert(streamed.size() == expected.size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        assert(streamed[i].first == expected[i].type && streamed[i].second == expected[i].literal);
+    }
+
+    // unterminated at the very end of the input
+    compareTokens({Token(TokenType::ILLEGAL, "\"abc\\"), Token(TokenType::EOF_TOKEN, "")},
+                  lexAll<Lexer>("\"abc\\"));
+
+    assert(DecodeLiteral("\"hello, \\\"world\\\"\\t!\"") == "hello, \"world\"\t!");
+    assert(DecodeLiteral("'\\n'") == "\n");
+    assert(DecodeLiteral("'\\''") == "'");
+    assert(DecodeLiteral("\"\\x41\\102\\0\"") == std::string("AB\0", 3));
+    assert(DecodeLiteral("\"plain\"") == "plain");
+
+    std::cout << "test_program13 passed" << std::endl;
+}
+
+// Test Program 14: identifiers are interned to dense symbols
+void test_program14() {
+    Interner names;
+    assert(names.Find("x") == Interner::kNone);
+    assert(names.Intern("x") == 0);
+    assert(names.Intern("longer_name") == 1);
+    assert(names.Intern("x") == 0);
+    assert(names.Find("longer_name") == 1);
+    assert(names.Name(1) == "longer_name");
+
+    // enough names to grow the table several times
+    for (int i = 0; i < 10000; i++) {
+        assert(names.Intern("v" + std::to_string(i)) == (Symbol)(i + 2));
+    }
+    for (int i = 0; i < 10000; i += 97) {
+        assert(names.Find("v" + std::to_string(i)) == (Symbol)(i + 2));
+        assert(names.Name(i + 2) == "v" + std::to_string(i));
+    }
+    assert(names.Size() == 10002);
+
+    std::string program = "int x = x + y; forn(i, n) { x = i * y; } int n;";
+    Lexer lexer(program);
+    TokenBuffer tokens = lexer.Tokenize();
+    std::vector<std::string> seen;
+    for (size_t i = 0; i < tokens.Size(); i++) {
+        if (tokens.Type(i) != TokenType::IDENT) {
+            assert(tokens.SymbolAt(i) == Interner::kNone);
+            continue;
+        }
+        assert(tokens.Names().Name(tokens.SymbolAt(i)) == tokens.Literal(i));
+        if (tokens.SymbolAt(i) == seen.size()) seen.emplace_back(tokens.Literal(i));
+    }
+    // x y i n, numbered in order of first use, each stored once
+    assert(tokens.Names().Size() == 4 && seen.size() == 4);
+
+    std::cout << "test_program14 passed" << std::endl;
+}
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <iostream>
@@ -5,8 +6,14 @@
 #include <vector>
 
 #include "../parser/parser.h"
+#include "../parser/parallel_parser.h"
+#include "../parser/unit_stream.h"
+#include "../memory/arena.h"
+#include "../ast/visitor.h"
+#include "../ast/pass.h"
 #include "../lexer/lexer.h"
 #include "../token/token.h"
+#include "generator.h"
 
 // Test function declarations
 void test_program1();
@@ -14,6 +21,14 @@ void test_program2();
 void test_program3();
 void test_program4();
 void test_program5();
+void test_program6();
+void test_program7();
+void test_program8();
+void test_program9();
+void test_program10();
+void test_program11();
+void test_program12();
+void test_program13();
 
 // Function to read a file and return its contents as a string
 std::string readFile(const std::string& filename) {
@@ -33,17 +48,8 @@ void runParserTest(const std::string& input) {
     // Create Lexer with input
     Lexer lexer(input);
 
-    // Collect Tokens
-    std::vector<Token> tokens;
-    Token tok = lexer.NextToken();
-    while (tok.type != TokenType::EOF_TOKEN) {
-        tokens.push_back(tok);
-        tok = lexer.NextToken();
-    }
-    tokens.push_back(tok); // Include EOF token
-
-    // Create Parser with tokens
-    Parser parser(tokens);
+    // Create Parser straight from the lexer's token buffer
+    Parser parser(lexer.Tokenize());
 
     // Parse the program
     parser.parseProgram();
@@ -97,6 +103,402 @@ void test_program5() {
     std::cout << "--------------" << std::endl;
 }
 
+// Generated programs of several shapes parse cleanly, one PROGRAM child per
+// function, and a seed always gives the same program.
+void test_program6() {
+    std::vector<GeneratorOptions> shapes(4);
+    shapes[0].functions = 20;
+    shapes[1].functions = 5;
+    shapes[1].maxDepth = 6;
+    shapes[1].maxStatements = 3;
+    shapes[2].functions = 10;
+    shapes[2].maxExprDepth = 8;
+    shapes[2].identLength = 40;
+    shapes[3].targetBytes = 256 << 10;
+    shapes[3].seed = 42;
+
+    for (const GeneratorOptions& options : shapes) {
+        std::string input = ProgramGenerator::Generate(options);
+        Lexer lexer(input);
+        Parser parser(lexer.Tokenize());
+        parser.parseProgram();
+        for (const auto& err : parser.errors) {
+            std::cerr << err << std::endl;
+        }
+        assert(parser.errors.empty());
+        if (options.functions) {
+            assert(parser.nodes.Children(0).size() == options.functions + 1);
+        } else {
+            assert(input.size() >= options.targetBytes);
+        }
+        assert(ProgramGenerator::Generate(options) == input);
+    }
+
+    GeneratorOptions other = shapes[0];
+    other.seed++;
+    assert(ProgramGenerator::Generate(other) != ProgramGenerator::Generate(shapes[0]));
+
+    std::cout << "test_program6 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// Expression subtree with every binary operator parenthesized
+std::string renderExpression(const Parser& parser, int cur) {
+    const ASTNode& node = parser.nodes[cur];
+    if (node.kind == NodeKind::BinaryOperator) {
+        return "(" + renderExpression(parser, parser.nodes.Children(cur)[0]) + " " + std::string(TokenText(node.op)) + " " +
+               renderExpression(parser, parser.nodes.Children(cur)[1]) + ")";
+    }
+    if (node.kind == NodeKind::UnaryOperator) {
+        return std::string(TokenText(node.op)) + renderExpression(parser, parser.nodes.Children(cur)[0]);
+    }
+    return std::string(parser.nodeName(cur));
+}
+
+// Binary operators group by precedence and associate to the left.
+void test_program7() {
+    std::vector<std::pair<std::string, std::string>> cases = {
+        {"a + b * c", "(a + (b * c))"},
+        {"a - b - c", "((a - b) - c)"},
+        {"a / b * c + d", "(((a / b) * c) + d)"},
+        {"a + b < c * d", "((a + b) < (c * d))"},
+        {"a < b == c > d", "((a < b) == (c > d))"},
+        {"a == b && c != d || e", "(((a == b) && (c != d)) || e)"},
+        {"a || b && c", "(a || (b && c))"},
+        {"-a * b + !c", "((-a * b) + !c)"},
+        {"(a + b) * c", "((a + b) * c)"},
+        {"a <= b + 1 >= c - 2", "((a <= (b + 1)) >= (c - 2))"},
+    };
+    for (const auto& c : cases) {
+        std::string input = "int x = " + c.first + ";";
+        Lexer lexer(input);
+        Parser parser(lexer.Tokenize());
+        parser.parseProgram();
+        assert(parser.errors.empty());
+        int decl = parser.nodes.Children(0)[0];
+        std::string got = renderExpression(parser, parser.nodes.Children(decl)[0]);
+        if (got != c.second) {
+            std::cerr << c.first << ": expected " << c.second << ", got " << got << std::endl;
+        }
+        assert(got == c.second);
+    }
+    std::cout << "test_program7 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// Nesting far deeper than the native stack could take in a recursive
+// parser: 10^5 nested blocks and 10^5 nested unary/grouped expressions.
+void test_program8() {
+    const int depth = 100000;
+    std::string input = "int solve(int a) {\n";
+    for (int i = 0; i < depth; i++) input += "forn(i, 2) {\n";
+    input += "a = ";
+    for (int i = 0; i < depth; i++) input += "-(a + ";
+    input += "1";
+    for (int i = 0; i < depth; i++) input += ")";
+    input += ";\n";
+    for (int i = 0; i < depth; i++) input += "}\n";
+    input += "return a;\n}\n";
+
+    Lexer lexer(input);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+
+    // walk down the forn chain, then the expression
+    int cur = parser.nodes.Children(0)[0];
+    cur = parser.nodes.Children(cur)[1];  // function body
+    for (int i = 0; i < depth; i++) {
+        cur = parser.nodes.Children(cur)[0];
+        assert(parser.nodes[cur].kind == NodeKind::Forn);
+        cur = parser.nodes.Children(cur)[2];
+    }
+    cur = parser.nodes.Children(cur)[0];
+    assert(parser.nodes[cur].kind == NodeKind::Identifier);
+    cur = parser.nodes.Children(cur)[0];
+    for (int i = 0; i < depth; i++) {
+        assert(parser.nodes[cur].kind == NodeKind::UnaryOperator);
+        cur = parser.nodes.Children(cur)[0];
+        assert(parser.nodes[cur].kind == NodeKind::BinaryOperator);
+        cur = parser.nodes.Children(cur)[1];
+    }
+    assert(parser.nodes[cur].kind == NodeKind::IntLiteral);
+
+    // the printer walks the same depth; its output is quadratic in depth,
+    // so it gets a shallower tree and a sink that only counts lines
+    std::string unary = "int x = " + std::string(5000, '!') + "y;";
+    Lexer small(unary);
+    Parser shallow(small.Tokenize());
+    shallow.parseProgram();
+    struct LineCounter : std::streambuf {
+        size_t lines = 0;
+        int overflow(int c) override { lines += c == '\n'; return c; }
+    } counter;
+    std::streambuf* saved = std::cout.rdbuf(&counter);
+    shallow.printNodes();
+    std::cout.rdbuf(saved);
+    assert(counter.lines == shallow.nodes.size());
+
+    std::cout << "test_program8 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+void assertSameTree(const Parser& expected, const Parser& actual) {
+    assert(expected.errors == actual.errors);
+    assert(expected.nodes.size() == actual.nodes.size());
+    for (size_t i = 0; i < expected.nodes.size(); i++) {
+        const ASTNode& a = expected.nodes[i];
+        const ASTNode& b = actual.nodes[i];
+        assert(a.kind == b.kind && a.varType == b.varType && a.op == b.op);
+        assert(a.name == b.name);
+        ChildRange x = expected.nodes.Children(i);
+        ChildRange y = actual.nodes.Children(i);
+        assert(std::equal(x.begin(), x.end(), y.begin(), y.end()));
+    }
+}
+
+// Parallel parsing gives the serial tree and errors for any thread count and
+// chunk size, including programs with top-level statements, syntax errors
+// and unbalanced braces.
+void test_program9() {
+    GeneratorOptions options;
+    options.functions = 60;
+    options.seed = 9;
+    std::string program = ProgramGenerator::Generate(options);
+
+    std::vector<std::string> inputs = {
+        program,
+        "int g = 5;\n} ; " + program + "int h = 6;\n",
+    };
+    // an error inside one function, and a missing '}' that throws off the
+    // brace pre-pass
+    std::string broken = program;
+    broken.replace(broken.find(';', broken.size() / 3), 1, " ,");
+    inputs.push_back(broken);
+    std::string unbalanced = program;
+    unbalanced.erase(unbalanced.find("}\n\nint", unbalanced.size() / 2), 1);
+    inputs.push_back(unbalanced);
+
+    for (const std::string& input : inputs) {
+        Lexer lexer(input);
+        Parser serial(lexer.Tokenize());
+        serial.parseProgram();
+        if (&input == &inputs[0]) {
+            assert(FindFunctionStarts(serial.cursor).size() == options.functions + 1);
+        }
+
+        for (unsigned threads : {1u, 2u, 3u, 8u}) {
+            for (size_t minChunk : {size_t(1), size_t(50), size_t(1000)}) {
+                Lexer again(input);
+                Parser parallel(again.Tokenize());
+                ParseProgramParallel(parallel, threads, minChunk);
+                assertSameTree(serial, parallel);
+            }
+        }
+    }
+    std::cout << "test_program9 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// UnitStream hands out the lexer's tokens cut at every function start, for
+// any chunk size.
+void test_program10() {
+    GeneratorOptions options;
+    options.functions = 40;
+    options.seed = 10;
+    std::string program = "int g = 5;\n} ; " + ProgramGenerator::Generate(options) + "int h = 6;\n";
+
+    Lexer lexer(program);
+    TokenBuffer whole = lexer.Tokenize();
+    std::vector<int> starts = FindFunctionStarts(TokenCursor(whole));
+
+    std::FILE* file = std::tmpfile();
+    std::fwrite(program.data(), 1, program.size(), file);
+
+    for (size_t chunk : {size_t(1), size_t(7), size_t(4096)}) {
+        std::rewind(file);
+        UnitStream units(fileno(file), chunk);
+        TokenBuffer unit;
+        std::vector<int> bases;
+        size_t next = 0;
+        while (units.Next(unit)) {
+            bases.push_back(units.Base());
+            assert(unit.Type(unit.Size() - 1) == TokenType::EOF_TOKEN);
+            for (size_t i = 0; i + 1 < unit.Size(); i++, next++) {
+                assert(unit.Type(i) == whole.Type(next));
+                assert(unit.Literal(i) == whole.Literal(next));
+            }
+        }
+        assert(!units.Failed());
+        assert(next + 1 == whole.Size());
+        // the leading statements ride with the first unit
+        assert(bases.size() == starts.size() + 1);
+        for (size_t i = 0; i < starts.size(); i++) {
+            assert(bases[i + 1] == starts[i]);
+        }
+    }
+    std::fclose(file);
+    std::cout << "test_program10 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// Children added to interleaved parents come out packed and in order, and
+// appending a finished tree shifts its indices.
+void test_program11() {
+    AST tree;
+    int root = tree.Add();
+    int a = tree.Add();
+    tree.AddChild(root, a);
+    int b = tree.Add();
+    tree.AddChild(a, b);
+    int c = tree.Add();
+    tree.AddChild(root, c);
+    tree.AddChild(a, c);
+    tree.AddChild(root, b);
+    tree.Finish();
+
+    std::vector<int> rootChildren(tree.Children(root).begin(), tree.Children(root).end());
+    std::vector<int> aChildren(tree.Children(a).begin(), tree.Children(a).end());
+    assert((rootChildren == std::vector<int>{a, c, b}));
+    assert((aChildren == std::vector<int>{b, c}));
+    assert(tree.Children(b).empty() && tree.edges.size() == 5);
+
+    AST merged;
+    merged.Add();
+    int offset = merged.Append(tree);
+    assert(offset == 1 && merged.size() == 5);
+    assert(merged.Children(offset + a)[1] == offset + c);
+    merged.AddChild(0, offset);
+    merged.Finish();
+    assert(merged.Children(0).size() == 1 && merged.Children(offset).size() == 3);
+
+    std::cout << "test_program11 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// Parsing out of an arena gives the heap tree; Reset hands the same memory
+// to the next program without mapping more.
+void test_program12() {
+    GeneratorOptions options;
+    options.functions = 50;
+    options.seed = 12;
+    std::string program = ProgramGenerator::Generate(options);
+
+    Lexer heapLexer(program);
+    Parser heap(heapLexer.Tokenize());
+    heap.parseProgram();
+
+    for (bool hugePages : {false, true}) {
+        Arena arena(64 << 10, hugePages);
+        size_t reserved = 0;
+        for (int round = 0; round < 3; round++) {
+            {
+                Lexer lexer(program);
+                Parser parser(lexer.Tokenize(&arena));
+                parser.parseProgram();
+                assertSameTree(heap, parser);
+                assert(parser.nodes.nodes.get_allocator().arena == &arena);
+            }
+            assert(arena.Used() > 0);
+            if (round == 0) reserved = arena.Reserved();
+            assert(arena.Reserved() == reserved);
+            arena.Reset();
+            assert(arena.Used() == 0);
+        }
+    }
+
+    // one request bigger than a block gets a block of its own
+    Arena arena(4096);
+    void* small = arena.Allocate(16, 8);
+    void* big = arena.Allocate(1 << 20, 64);
+    assert(reinterpret_cast<uintptr_t>(big) % 64 == 0);
+    arena.Reset();
+    assert(arena.Allocate(16, 8) == small);
+
+    std::cout << "test_program12 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
+// Counts visits per handler; literals and lists go through their group
+// handlers, everything else without a handler through visitNode.
+class KindCounter : public ASTVisitor<KindCounter> {
+public:
+    int functions = 0, literals = 0, lists = 0, others = 0;
+    void visitFunction(int) { functions++; }
+    void visitLiteral(int) { literals++; }
+    void visitList(int) { lists++; }
+    void visitNode(int) { others++; }
+};
+
+// Turns every BinaryOperator into a FunctionCall and reports the order
+// passes ran in.
+class RenamePass : public Pass, public ASTVisitor<RenamePass, bool> {
+public:
+    RenamePass(std::vector<int>& order, int id) : order(order), id(id) {}
+    std::string_view Name() const override { return "rename"; }
+    bool Run(AST& tree, Interner&) override {
+        order.push_back(id);
+        target = &tree;
+        bool changed = false;
+        for (size_t i = 0; i < tree.size(); i++) changed |= visit(tree[i].kind, i);
+        return changed;
+    }
+    bool visitBinaryOperator(int node) {
+        (*target)[node].kind = NodeKind::FunctionCall;
+        return true;
+    }
+
+private:
+    std::vector<int>& order;
+    int id;
+    AST* target = nullptr;
+};
+
+void test_program13() {
+    GeneratorOptions options;
+    options.functions = 20;
+    options.seed = 13;
+    std::string program = ProgramGenerator::Generate(options);
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+
+    KindCounter counter;
+    int functions = 0, literals = 0, lists = 0, binaries = 0, calls = 0;
+    for (size_t i = 0; i < parser.nodes.size(); i++) {
+        NodeKind kind = parser.nodes[i].kind;
+        counter.visit(kind, i);
+        functions += kind == NodeKind::Function;
+        literals += kind == NodeKind::IntLiteral || kind == NodeKind::FloatLiteral ||
+                    kind == NodeKind::StringLiteral || kind == NodeKind::CharLiteral ||
+                    kind == NodeKind::BooleanLiteral;
+        lists += IsListKind(kind);
+        binaries += kind == NodeKind::BinaryOperator;
+        calls += kind == NodeKind::FunctionCall;
+    }
+    assert(functions == 21 && counter.functions == functions);
+    assert(literals > 0 && counter.literals == literals);
+    assert(counter.lists == lists);
+    assert(counter.others == static_cast<int>(parser.nodes.size()) - functions - literals - lists);
+
+    std::vector<int> order;
+    PassManager passes;
+    passes.Add(std::make_unique<RenamePass>(order, 1));
+    passes.Add(std::make_unique<RenamePass>(order, 2));
+    Interner symbols;
+    assert(binaries > 0 && passes.Run(parser.nodes, symbols));
+    assert((order == std::vector<int>{1, 2}));
+    int renamed = 0;
+    for (size_t i = 0; i < parser.nodes.size(); i++) {
+        renamed += parser.nodes[i].kind == NodeKind::FunctionCall;
+    }
+    assert(renamed == binaries + calls);
+    assert(!passes.Run(parser.nodes, symbols));
+
+    std::cout << "test_program13 passed" << std::endl;
+    std::cout << "--------------" << std::endl;
+}
+
 // Main function to run all tests
 int main() {
     std::cout << "Running Parser Tests" << std::endl;
@@ -107,6 +509,14 @@ int main() {
     test_program3();
     test_program4();
     test_program5();
+    test_program6();
+    test_program7();
+    test_program8();
+    test_program9();
+    test_program10();
+    test_program11();
+    test_program12();
+    test_program13();
 
     std::cout << "All parser tests passed!" << std::endl;
     return 0;
@@ -10,11 +10,22 @@
 #include <array>
 #include <chrono>
 #include <thread>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "../parser/parser.h"
 #include "../lexer/lexer.h"
 #include "../token/token.h"
 #include "../processor/processor.h"
+#include "../processor/stream_translator.h"
+#include "../processor/precompiled_header.h"
+#include "../ast/ast_file.h"
+#include "../optimizer/passes.h"
+#include "../optimizer/constant_fold.h"
+#include "../optimizer/dead_code.h"
+#include "../optimizer/loops.h"
+#include "generator.h"
 
 // Test function declarations
 std::string run_processor_test(const std::string& input_file);
@@ -23,6 +34,17 @@ void test_program2();
 void test_program3();
 void test_program4();
 void test_program5();
+void test_program6();
+void test_program7();
+void test_program8();
+void test_program9();
+void test_program10();
+void test_program11();
+void test_program12();
+void test_program13();
+void test_program14();
+void test_program15();
+void test_program16();
 
 // Utility function to run a shell command and capture its output.
 static std::string exec(const char* cmd) {
@@ -51,21 +73,25 @@ std::string readFile(const std::string& filename) {
 }
 
 
+// input_file, if given, is the program's stdin
+static std::string compileAndRun(const std::string& cpp_file, const std::string& input_file = "") {
+    std::string exe_name = cpp_file.substr(0, cpp_file.find_last_of('.')) + "_exe";
+    int compile_result = system(("g++ -w -std=c++17 " + cpp_file + " -o " + exe_name).c_str());
+    if (compile_result != 0) {
+        throw std::runtime_error("Compilation failed for: " + cpp_file);
+    }
+    std::string run = "./" + exe_name;
+    if (!input_file.empty()) run += " < " + input_file;
+    return exec(run.c_str());
+}
+
 std::string run_processor_test(const std::string& input_file) {
     std::cout << "\nRunning test: " << input_file << std::endl;
     
     std::string program = readFile(input_file);
     
     Lexer lexer(program);
-    std::vector<Token> tokens;
-    Token tok = lexer.NextToken();
-    while (tok.type != TokenType::EOF_TOKEN) {
-        tokens.push_back(tok);
-        tok = lexer.NextToken();
-    }
-    tokens.push_back(tok);
-
-    Parser parser(tokens);
+    Parser parser(lexer.Tokenize());
     parser.parseProgram();
 
     std::vector<std::string> errors = parser.Errors();
@@ -78,7 +104,7 @@ std::string run_processor_test(const std::string& input_file) {
     assert(errors.empty());
 
     std::string output_filename = input_file.substr(0, input_file.find_last_of('.')) + ".cpp";
-    Processor processor(parser.nodes, output_filename);
+    Processor processor(parser.nodes, parser.names(), output_filename);
     processor.process();
 
         // Wait for the file to be written to disk
@@ -125,11 +151,717 @@ void test_program4() {
     std::cout << "Processor Test 4 completed successfully.\n";
 }
 
+// processor_test5.fpp is the syntax error example: `int y = 8` is missing
+// its ';', so the parser reports where and what it expected and nothing is
+// translated
 void test_program5() {
-    run_processor_test("tests/processor_tests/processor_test5.fpp");
+    std::cout << "\nRunning test: tests/processor_tests/processor_test5.fpp" << std::endl;
+
+    std::string program = readFile("tests/processor_tests/processor_test5.fpp");
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+
+    std::vector<std::string> errors = parser.Errors();
+    for (const std::string &error : errors) {
+        std::cerr << "Parse error: " << error << '\n';
+    }
+    assert(!errors.empty());
+    assert(errors[0].find("Expected SEMICOLON") != std::string::npos);
     std::cout << "Processor Test 5 completed successfully.\n";
 }
 
+void test_program6() {
+    std::string result = run_processor_test("tests/processor_tests/processor_test6.fpp");
+    assert(result == "hello, \"world\"\t!\n");
+    std::cout << "Processor Test 6 completed successfully.\n";
+}
+
+// A generated program is valid C++ too, given forn and cout, so g++
+// compiling it directly says what the translation has to print.
+static size_t countOf(const std::string& text, const std::string& word) {
+    size_t count = 0;
+    for (size_t at = text.find(word); at != std::string::npos; at = text.find(word, at + 1)) count++;
+    return count;
+}
+
+void test_program7() {
+    // no calls, so the translated program finishes in a few loop iterations
+    GeneratorOptions options;
+    options.functions = 10;
+    options.callPercent = 0;
+    std::string input_file = "tests/processor_tests/generated_test.fpp";
+    std::string direct_file = "tests/processor_tests/generated_direct.cpp";
+    for (uint64_t seed : {7, 10, 17}) {
+        options.seed = seed;
+        std::string source = ProgramGenerator::Generate(options);
+        std::ofstream(input_file) << source;
+        std::string result = run_processor_test(input_file);
+
+        std::ofstream(direct_file) << "#include <cstdio>\n"
+                                      "#define forn(i, n) for (int i = 0; i < (n); i++)\n"
+                                      "void cout(int x) { printf(\"%d\\n\", x); }\n"
+                                   << source << "int main() { solve(0); }\n";
+        assert(result == compileAndRun(direct_file));
+        std::string translated = readFile("tests/processor_tests/generated_test.cpp");
+        assert(countOf(translated, "if(") == countOf(source, "if ("));
+    }
+
+    // if / else and bare blocks reach the output, and stacked unary
+    // operators keep their meaning
+    std::string program =
+        "int solve(int a) {\n"
+        "    int r = 0;\n"
+        "    forn(i, 5) {\n"
+        "        if (i < 2) {\n"
+        "            r = r + 1;\n"
+        "        } else {\n"
+        "            if (i == 3) {\n"
+        "                r = r + 10;\n"
+        "            }\n"
+        "            r = r + 100;\n"
+        "        }\n"
+        "    }\n"
+        "    {\n"
+        "        int r = 7;\n"
+        "        cout(r);\n"
+        "    }\n"
+        "    int neg = -(-a);\n"
+        "    int both = !(!(a + 2));\n"
+        "    cout(r);\n"
+        "    cout(neg);\n"
+        "    cout(both);\n"
+        "    return 0;\n"
+        "}\n";
+    std::string output_file = "tests/processor_tests/statements.cpp";
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.Errors().empty());
+    Processor(parser.nodes, parser.names(), output_file).process();
+    std::string generated = readFile(output_file);
+    assert(generated.find("if((i < 2)){\n") != std::string::npos);
+    assert(generated.find("} else {\n") != std::string::npos);
+    assert(generated.find("-(-(a))") != std::string::npos);
+    assert(compileAndRun(output_file) == "7\n312\n0\n1\n");
+    std::cout << "Processor Test 7 completed successfully.\n";
+}
+
+// Emits 10^5 nested loops; only checks the output, a C++ compiler would
+// not take this nesting.
+void test_program8() {
+    const int depth = 100000;
+    std::string program = "int solve(int a) {\n";
+    for (int i = 0; i < depth; i++) program += "forn(i, 2) {\n";
+    program += "a = a + 1;\n";
+    for (int i = 0; i < depth; i++) program += "}\n";
+    program += "return a;\n}\n";
+
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+
+    std::string output_filename = "tests/processor_tests/deep_test.cpp";
+    Processor processor(parser.nodes, parser.names(), output_filename);
+    processor.process();
+
+    std::string output = readFile(output_filename);
+    size_t loops = 0;
+    for (size_t pos = 0; (pos = output.find("for(int i = 0; i < 2; i++){", pos)) != std::string::npos; pos++) {
+        loops++;
+    }
+    assert(loops == depth);
+    assert(output.find("a = (a + 1);") != std::string::npos);
+    std::cout << "Processor Test 8 completed successfully.\n";
+}
+
+// The streaming translator writes the same file as translating the whole
+// program at once; a broken program reports the same first error.
+void test_program9() {
+    GeneratorOptions options;
+    options.functions = 30;
+    options.seed = 9;
+    std::string generated = ProgramGenerator::Generate(options);
+    std::string broken = generated;
+    broken.replace(broken.find(';', broken.size() / 2), 1, " ,");
+
+    std::vector<std::string> programs = {generated, "", "int g = 5;\n"};
+    for (const char* file : {"processor_test1", "processor_test2", "processor_test3",
+                             "processor_test4", "processor_test6"}) {
+        programs.push_back(readFile(std::string("tests/processor_tests/") + file + ".fpp"));
+    }
+
+    std::string input_file = "tests/processor_tests/stream_test.fpp";
+    std::string whole_file = "tests/processor_tests/stream_whole.cpp";
+    std::string stream_file = "tests/processor_tests/stream_test.cpp";
+    for (const std::string& program : programs) {
+        Lexer lexer(program);
+        Parser parser(lexer.Tokenize());
+        parser.parseProgram();
+        Processor processor(parser.nodes, parser.names(), whole_file);
+        processor.process();
+
+        std::ofstream(input_file) << program;
+        for (size_t chunk : {size_t(5), size_t(1 << 16)}) {
+            int fd = open(input_file.c_str(), O_RDONLY);
+            assert(fd >= 0);
+            std::vector<std::string> errors = TranslateStream(fd, stream_file, chunk).errors;
+            close(fd);
+            assert(errors.empty() && parser.errors.empty());
+            assert(readFile(stream_file) == readFile(whole_file));
+        }
+    }
+
+    std::ofstream(input_file) << broken;
+    Lexer lexer(broken);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    int fd = open(input_file.c_str(), O_RDONLY);
+    assert(fd >= 0);
+    StreamResult result = TranslateStream(fd, stream_file);
+    close(fd);
+    assert(!result.errors.empty() && result.errors.front() == parser.errors.front());
+    assert(result.ok);  // parse errors aren't I/O failures
+    std::cout << "Processor Test 9 completed successfully.\n";
+}
+
+void test_program10() {
+    GeneratorOptions options;
+    options.functions = 30;
+    options.seed = 10;
+    std::string generated = ProgramGenerator::Generate(options);
+
+    std::string cache_dir = "tests/processor_tests/ast_cache";
+    std::string direct_file = "tests/processor_tests/cache_direct.cpp";
+    std::string cached_file = "tests/processor_tests/cache_mapped.cpp";
+    std::string ast_file = cache_dir + "/corrupt.fppast";
+    exec(("rm -rf " + cache_dir).c_str());
+
+    Lexer lexer(generated);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+    Processor(parser.nodes, parser.names(), direct_file).process();
+
+    ParseCache cache(cache_dir);
+    MappedAST mapped;
+    assert(!cache.Load(generated, mapped));
+    assert(cache.Store(generated, parser.nodes.View(), parser.names().Table()));
+    assert(cache.Load(generated, mapped));
+    assert(mapped.Tree().size() == parser.nodes.size());
+    Processor(mapped.Tree(), mapped.Names(), cached_file).process();
+    assert(readFile(cached_file) == readFile(direct_file));
+
+    // an edited source misses, even at the same length
+    std::string edited = generated;
+    edited[edited.size() / 2] = edited[edited.size() / 2] == ' ' ? '\t' : ' ';
+    MappedAST stale;
+    assert(!cache.Load(edited, stale));
+
+    // truncated or damaged files are rejected rather than trusted
+    assert(WriteASTFile(ast_file, generated, parser.nodes.View(), parser.names().Table()));
+    std::string bytes = readFile(ast_file);
+    MappedAST check;
+    assert(check.Open(ast_file, generated));
+    std::ofstream(ast_file, std::ios::binary) << bytes.substr(0, bytes.size() - 1);
+    assert(!check.Open(ast_file, generated));
+    // magic, version, source hash, node count, and the first node's child count
+    for (size_t at : {size_t(0), size_t(8), size_t(16), size_t(40), sizeof(ASTFileHeader) + 15}) {
+        std::string damaged = bytes;
+        damaged[at] = static_cast<char>(0x7f);
+        std::ofstream(ast_file, std::ios::binary) << damaged;
+        assert(!check.Open(ast_file, generated));
+    }
+    exec(("rm -rf " + cache_dir).c_str());
+    std::cout << "Processor Test 10 completed successfully.\n";
+}
+
+// Every output target gets the same bytes as the file, and failures to
+// write are reported rather than dropped.
+void test_program11() {
+    GeneratorOptions options;
+    options.functions = 30;
+    options.seed = 11;
+    std::string generated = ProgramGenerator::Generate(options);
+    Lexer lexer(generated);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+
+    std::string file_output = "tests/processor_tests/sink_file.cpp";
+    std::string pipe_output = "tests/processor_tests/sink_pipe.cpp";
+    assert(Processor(parser.nodes, parser.names(), file_output).process());
+    std::string expected = readFile(file_output);
+
+    std::string in_memory;
+    Processor to_string(parser.nodes, parser.names(), "");
+    to_string.setOutput(std::make_unique<StringTarget>(in_memory));
+    assert(to_string.process() && in_memory == expected);
+
+    Processor to_pipe(parser.nodes, parser.names(), "");
+    to_pipe.setOutput(std::make_unique<PipeTarget>("cat > " + pipe_output));
+    assert(to_pipe.process() && readFile(pipe_output) == expected);
+
+    std::string input_file = "tests/processor_tests/stream_test.fpp";
+    std::ofstream(input_file) << generated;
+    std::string streamed;
+    int fd = open(input_file.c_str(), O_RDONLY);
+    assert(fd >= 0);
+    assert(TranslateStream(fd, std::make_unique<StringTarget>(streamed), 64).errors.empty());
+    close(fd);
+    assert(streamed == expected);
+
+    assert(!Processor(parser.nodes, parser.names(), "tests/no_such_dir/out.cpp").process());
+    Processor failing(parser.nodes, parser.names(), "");
+    failing.setOutput(std::make_unique<PipeTarget>("cat > /dev/null; exit 3"));
+    assert(!failing.process());
+    fd = open(input_file.c_str(), O_RDONLY);
+    assert(fd >= 0);
+    StreamResult result = TranslateStream(fd, std::make_unique<PipeTarget>("cat > /dev/null; exit 3"));
+    close(fd);
+    assert(!result.ok && result.errors.back() == "Error writing output");
+    std::cout << "Processor Test 11 completed successfully.\n";
+}
+
+// Folded output computes what the unfolded output does, with constants
+// propagated only where no assignment or shadowing can change them.
+void test_program12() {
+    std::string program =
+        "int g = 6;\n"
+        "int twice(int g) {\n"
+        "    return g * 2;\n"
+        "}\n"
+        "int solve(int a) {\n"
+        "    int n = 10 * 3 - 4 / 2;\n"
+        "    int big = 2147483647;\n"
+        "    int over = big + 1;\n"
+        "    int m = n + g;\n"
+        "    int r = 0;\n"
+        "    forn(i, n / 2) {\n"
+        "        r = r + i * (g - 1);\n"
+        "    }\n"
+        "    int k = -n;\n"
+        "    int neg = 0 - k;\n"
+        "    int flag = !(n < g) && (n != 28);\n"
+        "    r = r + twice(m) + k + neg + flag;\n"
+        "    cout(r);\n"
+        "    return r;\n"
+        "}\n";
+
+    // No calls: the order C++ evaluates call arguments and operands in is
+    // unspecified, so with calls the two builds could differ either way.
+    GeneratorOptions options;
+    options.functions = 10;
+    options.callPercent = 0;
+    options.seed = 12;
+    std::string generated = ProgramGenerator::Generate(options);
+
+    std::string plain_file = "tests/processor_tests/fold_plain.cpp";
+    std::string folded_file = "tests/processor_tests/fold_folded.cpp";
+    for (const std::string& source : {program, generated}) {
+        Lexer lexer(source);
+        Parser parser(lexer.Tokenize());
+        parser.parseProgram();
+        assert(parser.errors.empty());
+        Processor(parser.nodes, parser.names(), plain_file).process();
+
+        PassManager passes;
+        AddStandardPasses(passes);
+        passes.Run(parser.nodes, parser.names());
+        Processor(parser.nodes, parser.names(), folded_file).process();
+        assert(compileAndRun(folded_file) == compileAndRun(plain_file));
+        assert(readFile(folded_file).size() <= readFile(plain_file).size());
+    }
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(ConstantFoldPass().Run(parser.nodes, parser.names()));
+    Processor(parser.nodes, parser.names(), folded_file).process();
+    std::string folded = readFile(folded_file);
+    assert(compileAndRun(folded_file) == "523\n");
+    assert(folded.find("int n = 28;") != std::string::npos);
+    assert(folded.find("i < 14;") != std::string::npos);
+    assert(folded.find("(i * 5)") != std::string::npos);
+    assert(folded.find("int k = -28;") != std::string::npos);
+    assert(folded.find("int flag = 0;") != std::string::npos);
+    assert(folded.find("twice(34)") != std::string::npos);
+    assert(folded.find("return (g * 2);") != std::string::npos);       // the parameter
+    assert(folded.find("(2147483647 + 1)") != std::string::npos);      // would overflow
+
+    // assigned only in a branch, so not a constant anywhere
+    std::string branches =
+        "int solve(int a) {\n"
+        "    int limit = 5;\n"
+        "    if (a < 1) {\n"
+        "        limit = 9;\n"
+        "    }\n"
+        "    int base = 3;\n"
+        "    if (a > 100) {\n"
+        "        base = 1;\n"
+        "    } else {\n"
+        "        cout(base);\n"
+        "    }\n"
+        "    int r = 0;\n"
+        "    forn(i, limit) {\n"
+        "        r = r + base;\n"
+        "    }\n"
+        "    cout(r);\n"
+        "    return r;\n"
+        "}\n";
+    Lexer branchLexer(branches);
+    Parser branchParser(branchLexer.Tokenize());
+    branchParser.parseProgram();
+    assert(branchParser.errors.empty());
+    ConstantFoldPass().Run(branchParser.nodes, branchParser.names());
+    Processor(branchParser.nodes, branchParser.names(), folded_file).process();
+    folded = readFile(folded_file);
+    assert(folded.find("i < limit;") != std::string::npos);
+    assert(folded.find("(r + base)") != std::string::npos);
+    assert(compileAndRun(folded_file) == "3\n27\n");
+
+    // one unit at a time, top-level variables stay as they are
+    std::string input_file = "tests/processor_tests/stream_test.fpp";
+    std::ofstream(input_file) << program;
+    PassManager unitPasses;
+    AddStandardPasses(unitPasses, false);
+    int fd = open(input_file.c_str(), O_RDONLY);
+    assert(fd >= 0);
+    assert(TranslateStream(fd, folded_file, 64, nullptr, &unitPasses).errors.empty());
+    close(fd);
+    folded = readFile(folded_file);
+    assert(folded.find("(i * (g - 1))") != std::string::npos);
+    assert(folded.find("i < 14;") != std::string::npos);
+    assert(compileAndRun(folded_file) == "523\n");
+    std::cout << "Processor Test 12 completed successfully.\n";
+}
+
+// Only what solve can reach, and only declarations that are read, are
+// written; the program still prints the same.
+void test_program13() {
+    std::string program =
+        "int unused(int a) {\n"
+        "    return a;\n"
+        "}\n"
+        "int seed(int a) {\n"
+        "    return a + 1;\n"
+        "}\n"
+        "int base = seed(4);\n"
+        "int idle = 3;\n"
+        "int total = 0;\n"
+        "int helper(int a) {\n"
+        "    int chain = a * 2;\n"
+        "    int tail = chain + 1;\n"
+        "    int called = seed(a);\n"
+        "    return a + base;\n"
+        "    cout(a);\n"
+        "    a = a + 1;\n"
+        "}\n"
+        "int solve(int a) {\n"
+        "    int r = helper(a);\n"
+        "    int w = 5;\n"
+        "    w = a + 1;\n"
+        "    int steps = 0;\n"
+        "    forn(i, 2) {\n"
+        "        steps = steps + i;\n"
+        "        steps++;\n"
+        "    }\n"
+        "    int effect = 0;\n"
+        "    effect = seed(a);\n"
+        "    int shadow = 1;\n"
+        "    {\n"
+        "        int shadow = 2;\n"
+        "        cout(shadow);\n"
+        "    }\n"
+        "    forn(i, 3) {\n"
+        "        int spare = i;\n"
+        "        r = r + i;\n"
+        "    }\n"
+        "    total = total + r;\n"
+        "    cout(r);\n"
+        "    return r;\n"
+        "}\n";
+
+    std::string plain_file = "tests/processor_tests/dce_plain.cpp";
+    std::string swept_file = "tests/processor_tests/dce_swept.cpp";
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+    Processor(parser.nodes, parser.names(), plain_file).process();
+
+    PassManager passes;
+    passes.Add(std::make_unique<DeadCodePass>());
+    assert(passes.Run(parser.nodes, parser.names()));
+    Processor(parser.nodes, parser.names(), swept_file).process();
+    std::string swept = readFile(swept_file);
+    assert(compileAndRun(swept_file) == "2\n8\n");
+    assert(compileAndRun(plain_file) == "2\n8\n");
+
+    assert(swept.find("unused") == std::string::npos);
+    assert(swept.find("int seed(") != std::string::npos);     // reached from base
+    assert(swept.find("int base = seed(4);") != std::string::npos);
+    assert(swept.find("idle") == std::string::npos);
+    assert(swept.find("chain") == std::string::npos && swept.find("tail") == std::string::npos);
+    assert(swept.find("int called = seed(a);") != std::string::npos);  // a call may have effects
+    assert(swept.find("fio::println(a)") == std::string::npos);
+    assert(swept.find("spare") == std::string::npos);
+    // written but never read: gone with the assignments
+    assert(swept.find("int w") == std::string::npos && swept.find("\nw = ") == std::string::npos);
+    assert(swept.find("steps") == std::string::npos);
+    assert(swept.find("total") == std::string::npos);
+    assert(swept.find("effect = seed(a);") != std::string::npos);
+    assert(swept.find("int shadow = 1;") != std::string::npos);   // same name as a read one
+    assert(!passes.Run(parser.nodes, parser.names()));
+
+    // as a unit of a larger program only local code goes
+    Lexer unitLexer(program);
+    Parser unit(unitLexer.Tokenize());
+    unit.parseProgram();
+    DeadCodePass(false).Run(unit.nodes, unit.names());
+    Processor(unit.nodes, unit.names(), swept_file).process();
+    swept = readFile(swept_file);
+    assert(swept.find("int unused(") != std::string::npos && swept.find("int idle") != std::string::npos);
+    assert(swept.find("chain") == std::string::npos && swept.find("fio::println(a)") == std::string::npos);
+    std::cout << "Processor Test 13 completed successfully.\n";
+}
+
+// Loops compute the same thing after hoisting, bound caching, fusion and
+// unrolling, and loops that depend on each other stay apart.
+void test_program14() {
+    std::string program =
+        "int scale(int a, int b) {\n"
+        "    return a * b + 1;\n"
+        "}\n"
+        "int solve(int a) {\n"
+        "    int g = a + 3;\n"
+        "    int h = a * 2;\n"
+        "    int n = a + 5;\n"
+        "    int r = 0;\n"
+        "    int s = 0;\n"
+        "    forn(i, scale(g, h) / 7) {\n"
+        "        r = r + i * (g * h);\n"
+        "    }\n"
+        "    forn(i, n) {\n"
+        "        r = r + i;\n"
+        "    }\n"
+        "    forn(j, n) {\n"
+        "        s = s + j * 2;\n"
+        "    }\n"
+        "    forn(i, n) {\n"
+        "        r = r + 1;\n"
+        "    }\n"
+        "    forn(i, n) {\n"
+        "        s = s + r;\n"
+        "    }\n"
+        "    int k = 0;\n"
+        "    while (k < g * h - 40) {\n"
+        "        k = k + 1;\n"
+        "    }\n"
+        "    forn(i, 3) {\n"
+        "        r = r + i * g;\n"
+        "        s = s - i;\n"
+        "    }\n"
+        "    r = r + s + k;\n"
+        "    cout(r);\n"
+        "    return r;\n"
+        "}\n";
+
+    std::string plain_file = "tests/processor_tests/loops_plain.cpp";
+    std::string optimized_file = "tests/processor_tests/loops_optimized.cpp";
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+    Processor(parser.nodes, parser.names(), plain_file).process();
+
+    assert(LoopPass().Run(parser.nodes, parser.names()));
+    Processor(parser.nodes, parser.names(), optimized_file).process();
+    std::string optimized = readFile(optimized_file);
+    assert(compileAndRun(plain_file) == "116\n");
+    assert(compileAndRun(optimized_file) == "116\n");
+
+    assert(optimized.find("int loop_bound0 = (scale(g,h) / 7);") != std::string::npos);
+    assert(optimized.find("i < loop_bound0;") != std::string::npos);
+    assert(optimized.find("int loop_inv1 = (g * h);") != std::string::npos);
+    assert(optimized.find("(i * loop_inv1)") != std::string::npos);
+    assert(optimized.find("r = (r + i);\ns = (s + (i * 2));") != std::string::npos);  // fused
+    assert(optimized.find("int j") == std::string::npos);
+    assert(optimized.find("r = (r + 1);\n};\nfor(") != std::string::npos);         // not fused
+    assert(optimized.find("while((k < loop_inv2))") != std::string::npos);
+    assert(optimized.find("i < 3") == std::string::npos);                          // unrolled
+    assert(optimized.find("r = (r + (2 * g));\ns = (s - 2);") != std::string::npos);
+
+    // under an if: a branch that never runs must not trap once hoisted
+    std::string branches =
+        "int solve(int a) {\n"
+        "    int g = a + 4;\n"
+        "    int h = a + 2;\n"
+        "    int r = 0;\n"
+        "    forn(i, 6) {\n"
+        "        if (i * 2 > g - h) {\n"
+        "            r = r + g * h;\n"
+        "        } else {\n"
+        "            r = r - 1;\n"
+        "        }\n"
+        "        if (h > 100) {\n"
+        "            r = r + 10 / (h - 2);\n"
+        "        }\n"
+        "    }\n"
+        "    forn(i, 3) {\n"
+        "        if (i == 1) {\n"
+        "            r = r + 100;\n"
+        "        }\n"
+        "    }\n"
+        "    cout(r);\n"
+        "    return r;\n"
+        "}\n";
+    Lexer branchLexer(branches);
+    Parser branchParser(branchLexer.Tokenize());
+    branchParser.parseProgram();
+    assert(branchParser.errors.empty());
+    Processor(branchParser.nodes, branchParser.names(), plain_file).process();
+    assert(LoopPass().Run(branchParser.nodes, branchParser.names()));
+    Processor(branchParser.nodes, branchParser.names(), optimized_file).process();
+    optimized = readFile(optimized_file);
+    assert(compileAndRun(plain_file) == "130\n");
+    assert(compileAndRun(optimized_file) == "130\n");
+    assert(optimized.find("= (g - h);") != std::string::npos);
+    assert(optimized.find("= (g * h);") != std::string::npos);
+    assert(optimized.find("(10 / loop_inv") != std::string::npos);   // only h - 2 moves
+    assert(optimized.find("if((1 == 1)){") != std::string::npos);    // unrolled
+
+    // and with the other passes around it, on generated programs too
+    GeneratorOptions options;
+    options.functions = 12;
+    options.callPercent = 0;
+    options.seed = 8;
+    for (const std::string& source : {program, ProgramGenerator::Generate(options)}) {
+        Lexer sourceLexer(source);
+        Parser sourceParser(sourceLexer.Tokenize());
+        sourceParser.parseProgram();
+        Processor(sourceParser.nodes, sourceParser.names(), plain_file).process();
+        PassManager passes;
+        AddStandardPasses(passes);
+        passes.Run(sourceParser.nodes, sourceParser.names());
+        Processor(sourceParser.nodes, sourceParser.names(), optimized_file).process();
+        assert(compileAndRun(optimized_file) == compileAndRun(plain_file));
+    }
+    std::cout << "Processor Test 14 completed successfully.\n";
+}
+
+// cin and cout go through the buffered runtime in the preamble: values of
+// each type read and print as >> and << would, across input split at any
+// point, and output bigger than the buffer comes out whole.
+void test_program15() {
+    std::string program =
+        "int solve(int a) {\n"
+        "    int n = 0;\n"
+        "    cin(n);\n"
+        "    int total = 0;\n"
+        "    forn(i, n) {\n"
+        "        int v = 0;\n"
+        "        cin(v);\n"
+        "        total = total + v;\n"
+        "    }\n"
+        "    float f = 0.0;\n"
+        "    cin(f);\n"
+        "    char c = 'a';\n"
+        "    cin(c);\n"
+        "    bool b = 1;\n"
+        "    cout(total);\n"
+        "    cout(f);\n"
+        "    cout(c);\n"
+        "    cout(b);\n"
+        "    cout(\"done\");\n"
+        "    int neg = 0 - total;\n"
+        "    cout(neg);\n"
+        "    int big = 0;\n"
+        "    cin(big);\n"
+        "    int x = 0;\n"
+        "    forn(i, big) {\n"
+        "        x = i;\n"
+        "        cout(x);\n"
+        "    }\n"
+        "    return 0;\n"
+        "}\n";
+
+    std::string output_file = "tests/processor_tests/fast_io.cpp";
+    std::string input_file = "tests/processor_tests/fast_io.in";
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    assert(parser.errors.empty());
+    Processor(parser.nodes, parser.names(), output_file).process();
+    std::string generated = readFile(output_file);
+    assert(generated.find("iostream") == std::string::npos);
+    assert(generated.find("fio::read(n);") != std::string::npos);
+    assert(generated.find("fio::println(total);") != std::string::npos);
+    assert(generated.find("if (multiTest) fio::read(t);") != std::string::npos);
+
+    std::ofstream(input_file) << "3 1\n-2\t40 2.5   z\n0";
+    assert(compileAndRun(output_file, input_file) == "39\n2.5\nz\n1\ndone\n-39\n");
+
+    // more numbers than one input block holds, so reads cross refills
+    std::string input = "20000";
+    for (int i = 0; i < 20000; i++) input += (i % 7 ? " " : "\n") + std::string("-12345");
+    std::ofstream(input_file) << input << " 1e3 x 0";
+    assert(compileAndRun(output_file, input_file) == "-246900000\n1000\nx\n1\ndone\n246900000\n");
+
+    // 3000000 lines are about 23MB, past the 16MB output buffer
+    std::ofstream(input_file) << "0 0 q 3000000";
+    std::string result = compileAndRun(output_file, input_file);
+    std::string head = "0\n0\nq\n1\ndone\n0\n0\n1\n2\n";
+    assert(result.size() == 15 + 22888890);
+    assert(result.compare(0, head.size(), head) == 0);
+    assert(result.compare(result.size() - 8, 8, "2999999\n") == 0);
+    std::cout << "Processor Test 15 completed successfully.\n";
+}
+
+// The preamble is precompiled once per compiler command, and a program that
+// includes the header compiles against the .gch to the same output.
+void test_program16() {
+    std::string directory = "tests/processor_tests/pch_cache";
+    system(("rm -rf " + directory).c_str());
+    PreambleCache cache(directory);
+    std::string error;
+    std::string header = cache.Header("g++ -std=c++17", &error);
+    assert(!header.empty() && error.empty());
+    assert(header[0] == '/');
+    struct stat built;
+    assert(stat((header + ".gch").c_str(), &built) == 0);
+
+    // a second request reuses the .gch; other flags get their own
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    assert(cache.Header("g++ -std=c++17") == header);
+    struct stat reused;
+    assert(stat((header + ".gch").c_str(), &reused) == 0);
+    assert(reused.st_mtim.tv_sec == built.st_mtim.tv_sec && reused.st_mtim.tv_nsec == built.st_mtim.tv_nsec);
+    assert(cache.Header("g++ -std=c++17 -O1") != header);
+    assert(cache.Header("no_such_compiler_fpp", &error).empty());
+    assert(!error.empty());
+
+    std::string output_file = "tests/processor_tests/pch_program.cpp";
+    std::string program = readFile("tests/processor_tests/processor_test1.fpp");
+    Lexer lexer(program);
+    Parser parser(lexer.Tokenize());
+    parser.parseProgram();
+    Processor processor(parser.nodes, parser.names(), output_file);
+    processor.setPreambleHeader(header);
+    assert(processor.process());
+    std::string generated = readFile(output_file);
+    assert(generated.compare(0, 10, "#include \"") == 0);
+    assert(generated.find("fio::") != std::string::npos);
+    assert(generated.find("namespace fio") == std::string::npos);
+
+    // -H lists included headers; "!" marks a precompiled one that was used
+    std::string used = exec(("g++ -std=c++17 -H -fsyntax-only " + output_file + " 2>&1").c_str());
+    assert(used.find("! " + header + ".gch") != std::string::npos);
+    assert(compileAndRun(output_file) == "10\n");
+
+    system(("rm -rf " + directory).c_str());
+    std::cout << "Processor Test 16 completed successfully.\n";
+}
+
 int main() {
     std::cout << "Running Processor tests..." << std::endl;
 
@@ -138,6 +870,17 @@ int main() {
     test_program3();
     test_program4();
     test_program5();
+    test_program6();
+    test_program7();
+    test_program8();
+    test_program9();
+    test_program10();
+    test_program11();
+    test_program12();
+    test_program13();
+    test_program14();
+    test_program15();
+    test_program16();
 
     std::cout << "All Processor tests pased!" << std::endl;
     return 0;
@@ -0,0 +1,1553 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(int p0abcd,int p1abcd){
+fio::println(p0abcd);
+for(int i0abcd = 0; i0abcd < 3; i0abcd++){
+int v1abcd = 92;
+int v2abcd = (((i0abcd - 39) + (82 / 5)) > p0abcd);
+p1abcd = (v1abcd == (((v1abcd * 23) - v2abcd) - p0abcd));
+int v3abcd = (((p1abcd < (v2abcd / 8)) * (p1abcd + 97)) * v2abcd);
+};
+int v4abcd = (((p1abcd + p1abcd) + 86) + p0abcd);
+return -((30 - p0abcd));
+}
+
+int f1abcd(int p0abcd){
+p0abcd = p0abcd;
+fio::println(p0abcd);
+return (-(f0abcd(p0abcd,48)) - 77);
+}
+
+int f2abcd(int p0abcd,int p1abcd){
+fio::println(p1abcd);
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+int v2abcd = (((((42 - f0abcd(p1abcd,21)) + 46) && i0abcd) < p1abcd) && (i0abcd - !(f1abcd(4))));
+int v3abcd = p0abcd;
+v3abcd = (53 - 10);
+};
+for(int i4abcd = 0;(i4abcd < 4);i4abcd++){
+for(int i5abcd = 0;(i5abcd < 2);i5abcd++){
+int v6abcd = ((94 / 6) - i5abcd);
+int v7abcd = (i5abcd * (63 < (f1abcd(69) + p0abcd)));
+int v8abcd = 73;
+}
+fio::println(i4abcd);
+fio::println(i4abcd);
+int c9abcd = 2;
+while((c9abcd > 0)){
+f0abcd(-((p0abcd - 16)),(p0abcd && (f1abcd(74) >= 5)));
+int v10abc = ((c9abcd + 31) + (75 / 5));
+v10abc = (12 && ((28 * i4abcd) - (v10abc * (p0abcd * 59))));
+int v11abc = ((f1abcd(p1abcd) + (72 * 79)) * v10abc);
+v11abc = (54 == (52 - ((c9abcd * 94) * (p1abcd - i0abcd))));
+c9abcd = (c9abcd - 1);
+}
+for(int i12abc = 0; i12abc < 1; i12abc++){
+p0abcd = (((((i4abcd / 7) * 14) / 1) * c9abcd) == p1abcd);
+p0abcd = ((91 < i12abc) < (97 + i4abcd));
+};
+}
+f0abcd(p0abcd,(p0abcd + ((f0abcd(p0abcd,p0abcd) * 49) / 4)));
+if(((i0abcd >= p1abcd) || (p1abcd >= 21))){
+f1abcd(i0abcd);
+int v13abc = -(((i0abcd * 55) > 35));
+int c14abc = 1;
+while((c14abc > 0)){
+fio::println(i0abcd);
+f1abcd(((c14abc - i0abcd) + p1abcd));
+int v15abc = (i0abcd && (((p0abcd * p1abcd) / 1) > v13abc));
+c14abc = (c14abc - 1);
+}
+int v16abc = ((((p1abcd * p1abcd) + 75) > 60) > 67);
+f0abcd(!((p0abcd <= 59)),c14abc);
+f0abcd((((98 - p0abcd) * v16abc) * i0abcd),v16abc);
+}
+int v17abc = ((17 > (78 * p0abcd)) != ((p0abcd + f1abcd(91)) - -(74)));
+};
+if((82 == -(p1abcd))){
+for(int i18abc = 0; i18abc < 2; i18abc++){
+for(int i19abc = 0; i19abc < 2; i19abc++){
+int v20abc = (p1abcd + ((i18abc == i19abc) == (f1abcd(p1abcd) - 47)));
+fio::println(v20abc);
+int v21abc = (((i18abc * i18abc) * 52) == 5);
+int v22abc = ((f0abcd(p1abcd,f0abcd(62,86)) > p0abcd) < (94 / 6));
+};
+int v23abc = (((63 * 22) * 20) == p0abcd);
+fio::println(i18abc);
+};
+int v24abc = p1abcd;
+f0abcd(((v24abc + p1abcd) > 72),((p1abcd * p0abcd) + 37));
+int v25abc = (f1abcd((v24abc == 50)) && f0abcd((p0abcd + 61),(88 - f0abcd(43,v24abc))));
+int c26abc = 1;
+while((c26abc > 0)){
+int v27abc = ((p1abcd - (c26abc / 2)) + (c26abc * (99 * 67)));
+int v28abc = ((((v24abc + p1abcd) * -(v27abc)) - v24abc) == (v25abc >= p0abcd));
+c26abc = (c26abc - 1);
+}
+if(((c26abc / 6) <= ((f1abcd(p1abcd) + v24abc) / 9))){
+for(int i29abc = 0;(i29abc < 1);i29abc++){
+int v30abc = ((12 + (p1abcd * i29abc)) <= (f0abcd(16,21) + (p0abcd != v25abc)));
+}
+if((((43 - 2) == 55) == 57)){
+p0abcd = 96;
+p1abcd = (((v25abc * p1abcd) || v24abc) * (((68 - f0abcd(64,29)) - c26abc) - c26abc));
+int v31abc = 89;
+fio::println(p1abcd);
+int v32abc = (((f0abcd(p1abcd,p1abcd) + (0 / 6)) + (39 * v31abc)) <= v31abc);
+} else {
+int v33abc = v25abc;
+int v34abc = (((v24abc < 1) > (c26abc * (v25abc - 35))) || (f1abcd(73) + v25abc));
+int v35abc = f0abcd(v24abc,(v25abc + (v25abc > v34abc)));
+v25abc = (v24abc - c26abc);
+int v36abc = (v35abc != (52 / 8));
+f0abcd(f0abcd((v35abc / 5),v36abc),(c26abc == (36 - v24abc)));
+}
+}
+}
+for(int i37abc = 0; i37abc < 2; i37abc++){
+if((f1abcd((p0abcd == p1abcd)) >= p1abcd)){
+for(int i38abc = 0; i38abc < 1; i38abc++){
+int v39abc = f0abcd(((f0abcd(p0abcd,i38abc) <= i38abc) && (25 * f1abcd(59))),(f1abcd(i38abc) && (p0abcd + p0abcd)));
+};
+int c40abc = 2;
+while((c40abc > 0)){
+int v41abc = ((83 - f0abcd(71,i37abc)) && ((c40abc - 96) >= (f0abcd(92,70) + (p1abcd / 3))));
+c40abc = (c40abc - 1);
+}
+if(((p0abcd == i37abc) || (c40abc / 2))){
+int v42abc = (p1abcd - 30);
+int v43abc = c40abc;
+f1abcd(((44 - v42abc) < -(i37abc)));
+int v44abc = (55 - (c40abc / 2));
+int v45abc = ((((v42abc < c40abc) + ((v42abc * c40abc) * (v42abc / 7))) - 92) <= v43abc);
+} else {
+int v46abc = ((15 / 2) + (((i37abc - c40abc) - c40abc) > c40abc));
+}
+int v47abc = -(p0abcd);
+for(int i48abc = 0;(i48abc < 3);i48abc++){
+p1abcd = (-((v47abc - 41)) + v47abc);
+int v49abc = !((((i37abc - 32) - c40abc) >= 69));
+}
+if((p1abcd <= 0)){
+f0abcd((-(65) == 65),-((p1abcd + p0abcd)));
+int v50abc = ((21 < (78 / 1)) && v47abc);
+} else {
+p0abcd = !((((v47abc - 19) - i37abc) + f1abcd(45)));
+int v51abc = (((v47abc - p0abcd) + c40abc) - ((80 == (f0abcd(i37abc,p1abcd) * 72)) != v47abc));
+v51abc = v47abc;
+f0abcd(((93 != 98) + p1abcd),25);
+}
+} else {
+int v52abc = (6 + !((70 + f1abcd(i37abc))));
+}
+};
+int v53abc = (((p1abcd * f1abcd(12)) * p1abcd) + 20);
+return !(p0abcd);
+}
+
+int f3abcd(int p0abcd){
+if((((72 + (34 * 72)) - 78) != p0abcd)){
+int v0abcd = !(((f2abcd(2,53) * p0abcd) / 4));
+f0abcd(-((p0abcd || 68)),(v0abcd == (22 * f2abcd(v0abcd,p0abcd))));
+}
+int c1abcd = 1;
+while((c1abcd > 0)){
+int v2abcd = (p0abcd + ((95 * 35) * f1abcd(43)));
+v2abcd = ((f2abcd(p0abcd,77) + f1abcd(75)) && (((35 * p0abcd) * (63 - 60)) - v2abcd));
+fio::println(v2abcd);
+int c3abcd = 2;
+while((c3abcd > 0)){
+p0abcd = ((70 * (25 - 90)) + 95);
+c3abcd = (c3abcd - 1);
+}
+int v4abcd = ((45 && p0abcd) >= ((p0abcd - 26) + ((p0abcd <= 14) * 88)));
+int v5abcd = (v2abcd < (10 - (v2abcd / 8)));
+c1abcd = (c1abcd - 1);
+}
+int v6abcd = ((p0abcd * (c1abcd - 62)) - (c1abcd < (c1abcd - 72)));
+return (((v6abcd < c1abcd) && v6abcd) - (42 + -(95)));
+}
+
+int f4abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = -(((p2abcd - 75) - (86 != p1abcd)));
+int c1abcd = 4;
+while((c1abcd > 0)){
+int v2abcd = (f2abcd(c1abcd,-(f3abcd(p2abcd))) <= f3abcd(-(v0abcd)));
+p0abcd = (v2abcd * ((p2abcd > 98) >= (c1abcd + 19)));
+int v3abcd = 39;
+int v4abcd = p2abcd;
+int v5abcd = p1abcd;
+c1abcd = (c1abcd - 1);
+}
+f1abcd(v0abcd);
+for(int i6abcd = 0; i6abcd < 1; i6abcd++){
+int c7abcd = 1;
+while((c7abcd > 0)){
+p0abcd = (p2abcd != -((p1abcd > 57)));
+p2abcd = (((38 * i6abcd) * c1abcd) >= (v0abcd / 5));
+p1abcd = (p1abcd && i6abcd);
+c7abcd = (c7abcd - 1);
+}
+int c8abcd = 2;
+while((c8abcd > 0)){
+fio::println(v0abcd);
+if((((28 == p1abcd) == (i6abcd - v0abcd)) != 6)){
+v0abcd = (p0abcd + (((p0abcd * 6) * 9) * p1abcd));
+f2abcd((p1abcd && ((p1abcd - 99) != 29)),92);
+int v9abcd = (6 * p2abcd);
+int v10abc = !(((34 + v0abcd) * p0abcd));
+p1abcd = ((9 - v0abcd) != (!(65) / 4));
+f2abcd(((c8abcd + p0abcd) - c1abcd),42);
+} else {
+int v11abc = p2abcd;
+int v12abc = ((i6abcd * (v11abc * 39)) <= (15 * v0abcd));
+fio::println(i6abcd);
+int v13abc = 98;
+int v14abc = (-((f2abcd(p0abcd,v11abc) && 43)) <= i6abcd);
+}
+int c15abc = 2;
+while((c15abc > 0)){
+int v16abc = ((p1abcd == 20) == (f1abcd(p1abcd) <= 99));
+c15abc = (c15abc - 1);
+}
+p0abcd = c8abcd;
+for(int i17abc = 0;(i17abc < 4);i17abc++){
+p1abcd = (87 / 3);
+int v18abc = 96;
+fio::println(c15abc);
+int v19abc = -((c7abcd <= (99 + (i6abcd * c8abcd))));
+f1abcd(-((p2abcd - 56)));
+}
+int c20abc = 1;
+while((c20abc > 0)){
+int v21abc = (((((p0abcd - f0abcd(p2abcd,p0abcd)) > (p2abcd + 16)) * 20) + c8abcd) < c15abc);
+int v22abc = c1abcd;
+v0abcd = c7abcd;
+fio::println(c15abc);
+int v23abc = f1abcd(((v0abcd / 1) + (p0abcd * 20)));
+c20abc = (c20abc - 1);
+}
+c8abcd = (c8abcd - 1);
+}
+int v24abc = ((v0abcd == ((c8abcd + 43) < f0abcd(i6abcd,v0abcd))) || (c1abcd >= ((c1abcd * p0abcd) + i6abcd)));
+for(int i25abc = 0; i25abc < 4; i25abc++){
+int v26abc = (((i25abc - p2abcd) * (f1abcd(i25abc) || c8abcd)) >= !((95 / 5)));
+};
+fio::println(c7abcd);
+};
+for(int i27abc = 0;(i27abc < 4);i27abc++){
+int v28abc = p0abcd;
+for(int i29abc = 0; i29abc < 3; i29abc++){
+f3abcd(((59 - v0abcd) + -(c1abcd)));
+int v30abc = v28abc;
+};
+for(int i31abc = 0; i31abc < 4; i31abc++){
+fio::println(v0abcd);
+for(int i32abc = 0; i32abc < 2; i32abc++){
+int v33abc = (90 - (76 / 4));
+fio::println(c1abcd);
+int v34abc = 86;
+};
+for(int i35abc = 0; i35abc < 1; i35abc++){
+p1abcd = (((f0abcd(21,f0abcd(p1abcd,i35abc)) * 71) >= ((42 + -(p1abcd)) - f1abcd(69))) && i27abc);
+int v36abc = (i31abc > -((i35abc - i27abc)));
+f2abcd(((20 * p2abcd) * !(38)),((v0abcd + i35abc) - -(i31abc)));
+int v37abc = ((v36abc - i31abc) > (81 - v28abc));
+p0abcd = (((90 + i27abc) - v37abc) < (25 - 30));
+};
+int c38abc = 3;
+while((c38abc > 0)){
+int v39abc = (-((c38abc * 86)) / 7);
+c38abc = (c38abc - 1);
+}
+int v40abc = (((9 + c1abcd) + 30) + (60 * p0abcd));
+};
+p0abcd = v0abcd;
+for(int i41abc = 0;(i41abc < 2);i41abc++){
+fio::println(v0abcd);
+fio::println(v0abcd);
+int v42abc = f0abcd(88,i27abc);
+f1abcd(-((8 - 10)));
+}
+}
+int v43abc = (!((91 / 1)) / 4);
+return (((v0abcd != f2abcd(v0abcd,p2abcd)) == 29) == c1abcd);
+}
+
+int f5abcd(int p0abcd){
+p0abcd = 45;
+return !(p0abcd);
+}
+
+int f6abcd(int p0abcd){
+int c0abcd = 2;
+while((c0abcd > 0)){
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+f2abcd(!(i1abcd),(f1abcd(68) || (95 + 25)));
+int v2abcd = i1abcd;
+int c3abcd = 1;
+while((c3abcd > 0)){
+p0abcd = (f2abcd(c3abcd,(p0abcd - 63)) != ((v2abcd / 5) || (39 / 9)));
+c3abcd = (c3abcd - 1);
+}
+for(int i4abcd = 0;(i4abcd < 1);i4abcd++){
+int v5abcd = (((84 * p0abcd) + c3abcd) + i1abcd);
+int v6abcd = 58;
+fio::println(c3abcd);
+f0abcd(((42 + p0abcd) && (78 * p0abcd)),((p0abcd / 1) - c0abcd));
+fio::println(i1abcd);
+}
+int v7abcd = 1;
+}
+int v8abcd = 33;
+int c9abcd = 1;
+while((c9abcd > 0)){
+int c10abc = 3;
+while((c10abc > 0)){
+p0abcd = ((f3abcd((48 + c0abcd)) - (0 || v8abcd)) && (61 / 9));
+c10abc = (c10abc - 1);
+}
+if(((p0abcd <= ((46 * c0abcd) + 68)) < p0abcd)){
+f2abcd((c0abcd + v8abcd),81);
+int v11abc = 93;
+}
+f2abcd(((c9abcd * v8abcd) - (43 * 55)),67);
+c9abcd = (c9abcd - 1);
+}
+for(int i12abc = 0;(i12abc < 2);i12abc++){
+for(int i13abc = 0; i13abc < 2; i13abc++){
+int v14abc = !(90);
+p0abcd = i12abc;
+f1abcd((46 * v14abc));
+int v15abc = (p0abcd + !((c0abcd - v8abcd)));
+p0abcd = (!(-(v14abc)) + i12abc);
+};
+int v16abc = ((i12abc * 57) + !((16 + f1abcd(89))));
+int v17abc = (!((v16abc + i12abc)) / 3);
+int v18abc = (-(i12abc) == (v17abc + (c9abcd / 2)));
+if((c9abcd < (f5abcd(v16abc) * -(77)))){
+int v19abc = 92;
+} else {
+int v20abc = !((((8 * 80) - 57) - v8abcd));
+fio::println(v20abc);
+fio::println(c9abcd);
+f3abcd(28);
+}
+}
+c0abcd = (c0abcd - 1);
+}
+f3abcd((40 * c0abcd));
+for(int i21abc = 0; i21abc < 3; i21abc++){
+f2abcd(((i21abc * 78) + c0abcd),f2abcd((f0abcd(c0abcd,98) == 42),(i21abc + p0abcd)));
+};
+int c22abc = 3;
+while((c22abc > 0)){
+if((!((p0abcd - c22abc)) > 4)){
+for(int i23abc = 0; i23abc < 3; i23abc++){
+int v24abc = i23abc;
+};
+int c25abc = 2;
+while((c25abc > 0)){
+p0abcd = ((p0abcd != 98) == (c25abc > (c22abc - 71)));
+c25abc = (c25abc - 1);
+}
+int v26abc = (((c0abcd * f4abcd(46,17,97)) <= p0abcd) != 30);
+if(((c25abc + -(f4abcd(v26abc,p0abcd,c25abc))) < (46 / 5))){
+f5abcd((v26abc - -(p0abcd)));
+int v27abc = -((c22abc + -(p0abcd)));
+p0abcd = c25abc;
+f3abcd((p0abcd <= -(c22abc)));
+p0abcd = ((c0abcd - !(f5abcd(c22abc))) - v26abc);
+}
+}
+c22abc = (c22abc - 1);
+}
+return ((p0abcd / 7) / 3);
+}
+
+int f7abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = 46;
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+int v2abcd = (((55 < ((p2abcd * 44) + v0abcd)) <= (i1abcd + 69)) <= (f3abcd(34) - p0abcd));
+}
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+int v4abcd = ((((v0abcd + i3abcd) - f2abcd(89,p1abcd)) < (p2abcd + p2abcd)) || (89 / 9));
+};
+int v5abcd = (p1abcd + (-(p0abcd) * 91));
+for(int i6abcd = 0; i6abcd < 2; i6abcd++){
+int v7abcd = (i6abcd || (44 && 62));
+if(((f4abcd(9,65,v0abcd) + p2abcd) && ((69 <= p0abcd) <= ((2 != i6abcd) - 27)))){
+int c8abcd = 1;
+while((c8abcd > 0)){
+int v9abcd = ((f1abcd(52) - 65) <= (((63 * i6abcd) / 1) - p2abcd));
+int v10abc = ((p2abcd + (49 && f1abcd(37))) || p0abcd);
+v0abcd = (26 == 15);
+v7abcd = 64;
+c8abcd = (c8abcd - 1);
+}
+} else {
+int v11abc = (p0abcd - (-(p0abcd) + (f2abcd(v5abcd,p2abcd) * p1abcd)));
+int v12abc = f3abcd(p0abcd);
+}
+int v13abc = ((47 != (60 + 37)) || !((8 <= i6abcd)));
+for(int i14abc = 0; i14abc < 2; i14abc++){
+int v15abc = -(v5abcd);
+};
+p1abcd = (((40 - ((15 * v0abcd) / 4)) < ((p0abcd - 18) - 94)) || 66);
+};
+for(int i16abc = 0; i16abc < 2; i16abc++){
+int v17abc = -((29 > (f1abcd(p2abcd) - p1abcd)));
+int v18abc = (((6 - p0abcd) <= (78 - 84)) == p1abcd);
+for(int i19abc = 0;(i19abc < 2);i19abc++){
+v17abc = -(((p1abcd - v5abcd) < v0abcd));
+for(int i20abc = 0; i20abc < 3; i20abc++){
+fio::println(i19abc);
+int v21abc = 76;
+int v22abc = i20abc;
+p2abcd = ((11 - (i19abc || 19)) < (((69 * v21abc) * 80) * f4abcd(44,p0abcd,73)));
+};
+int v23abc = ((((v0abcd + 3) + (v0abcd * v18abc)) >= 75) && p1abcd);
+if((((p1abcd - (p1abcd / 4)) < i19abc) <= (i19abc + f1abcd(v17abc)))){
+v5abcd = i19abc;
+int v24abc = ((36 < ((v0abcd * 55) / 1)) || ((v17abc + v23abc) && !(v18abc)));
+int v25abc = v18abc;
+f3abcd((i19abc < (v0abcd / 1)));
+}
+}
+int v26abc = (((v5abcd + 71) && v17abc) && (v17abc * 11));
+};
+return (((v5abcd * f2abcd(61,v5abcd)) - (90 * v0abcd)) + ((19 < v5abcd) || 22));
+}
+
+int f8abcd(){
+int v0abcd = (((47 > 53) * (95 != 39)) >= 9);
+int v1abcd = (v0abcd - v0abcd);
+fio::println(v0abcd);
+f5abcd((v0abcd - (v0abcd && f2abcd(v1abcd,v1abcd))));
+int v2abcd = ((((v0abcd * 98) >= (v1abcd * 35)) && (50 + (22 * 21))) && v1abcd);
+fio::println(v1abcd);
+return 67;
+}
+
+int f9abcd(int p0abcd){
+f2abcd(((p0abcd || (61 - p0abcd)) || 2),p0abcd);
+int v0abcd = p0abcd;
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+f5abcd(v0abcd);
+}
+int c2abcd = 2;
+while((c2abcd > 0)){
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+v0abcd = (((1 * c2abcd) != f5abcd(v0abcd)) - 80);
+fio::println(i3abcd);
+f6abcd((95 != (f3abcd(c2abcd) * p0abcd)));
+};
+for(int i4abcd = 0; i4abcd < 2; i4abcd++){
+for(int i5abcd = 0; i5abcd < 1; i5abcd++){
+int v6abcd = (((c2abcd + i4abcd) >= ((i5abcd - c2abcd) - (i4abcd * p0abcd))) || (30 == i4abcd));
+fio::println(p0abcd);
+f6abcd(49);
+int v7abcd = 83;
+f2abcd((70 && (v7abcd == (p0abcd * v7abcd))),((27 - 82) < v6abcd));
+};
+if((((i4abcd != ((99 * 2) * 81)) != i4abcd) != (i4abcd < 93))){
+int v8abcd = -(((50 - f4abcd(i4abcd,i4abcd,v0abcd)) / 8));
+int v9abcd = v0abcd;
+int v10abc = (((!(c2abcd) + f6abcd(c2abcd)) + v8abcd) || v8abcd);
+}
+fio::println(i4abcd);
+};
+int v11abc = (11 <= ((32 * p0abcd) - p0abcd));
+if(((((p0abcd < v11abc) * (v11abc - 54)) != (34 * 9)) || (v0abcd - v11abc))){
+f5abcd(((v11abc <= 85) < f6abcd(p0abcd)));
+int c12abc = 1;
+while((c12abc > 0)){
+int v13abc = (p0abcd && (f7abcd(v11abc,p0abcd,c12abc) != (c12abc + (p0abcd / 2))));
+fio::println(v0abcd);
+fio::println(c12abc);
+v13abc = -((((c2abcd - v11abc) + c2abcd) > 22));
+c12abc = (c12abc - 1);
+}
+int v14abc = ((30 || (29 && p0abcd)) || (p0abcd + p0abcd));
+} else {
+if((((v0abcd == v0abcd) == c2abcd) != (v0abcd >= (13 - 93)))){
+v11abc = ((((v0abcd * v11abc) + v0abcd) - 31) - p0abcd);
+}
+}
+c2abcd = (c2abcd - 1);
+}
+return 37;
+}
+
+int f10abc(){
+int v0abcd = ((39 - 47) - (((13 * 34) * 35) / 5));
+int c1abcd = 4;
+while((c1abcd > 0)){
+for(int i2abcd = 0; i2abcd < 3; i2abcd++){
+for(int i3abcd = 0; i3abcd < 4; i3abcd++){
+f5abcd((i3abcd || (v0abcd - v0abcd)));
+int v4abcd = 31;
+};
+int v5abcd = (!(c1abcd) + ((v0abcd * i2abcd) * ((c1abcd + 27) >= v0abcd)));
+int c6abcd = 4;
+while((c6abcd > 0)){
+v0abcd = (((v0abcd >= ((50 * 5) * 95)) - 35) == (c6abcd * !(37)));
+c6abcd = (c6abcd - 1);
+}
+for(int i7abcd = 0; i7abcd < 2; i7abcd++){
+f0abcd((i7abcd >= ((v0abcd * 78) + 20)),((54 * 81) - f9abcd(i2abcd)));
+int v8abcd = ((50 - (i2abcd * 28)) < (27 + 23));
+v5abcd = !((i7abcd - 82));
+int v9abcd = (!((c6abcd / 5)) / 4);
+int v10abc = (((v5abcd + v8abcd) && v9abcd) || (c6abcd / 1));
+};
+};
+f9abcd((c1abcd / 9));
+for(int i11abc = 0; i11abc < 1; i11abc++){
+for(int i12abc = 0;(i12abc < 2);i12abc++){
+fio::println(i12abc);
+int v13abc = f9abcd((((16 / 5) * i12abc) < i11abc));
+int v14abc = ((v13abc - (77 * c1abcd)) == (c1abcd * v0abcd));
+}
+f6abcd(((c1abcd / 7) / 5));
+int v15abc = ((v0abcd * c1abcd) != (c1abcd * 92));
+};
+int c16abc = 1;
+while((c16abc > 0)){
+v0abcd = (((c16abc * c16abc) <= -(c16abc)) + c16abc);
+c16abc = (c16abc - 1);
+}
+if(((88 < 25) || (59 + c16abc))){
+int c17abc = 1;
+while((c17abc > 0)){
+v0abcd = c17abc;
+c17abc = (c17abc - 1);
+}
+int v18abc = ((v0abcd - c17abc) / 5);
+int v19abc = !((v0abcd - (c17abc / 8)));
+for(int i20abc = 0;(i20abc < 3);i20abc++){
+int v21abc = f9abcd(((f5abcd(f9abcd(v0abcd)) * v19abc) * v18abc));
+int v22abc = ((((39 + v0abcd) - c1abcd) - v0abcd) - (((v18abc == c17abc) - v18abc) - 60));
+int v23abc = (((19 * v18abc) * 16) + 7);
+v22abc = (f4abcd(15,(v0abcd / 3),(v19abc + 40)) + v0abcd);
+int v24abc = (-((v0abcd * i20abc)) - v21abc);
+}
+} else {
+int v25abc = ((((f4abcd(v0abcd,c1abcd,20) + c16abc) * 58) + c16abc) + v0abcd);
+f9abcd((92 != (v25abc * v0abcd)));
+int v26abc = (((82 - v25abc) * 30) || (83 / 8));
+}
+c1abcd = (c1abcd - 1);
+}
+f3abcd(-(-(c1abcd)));
+for(int i27abc = 0; i27abc < 1; i27abc++){
+f9abcd(((i27abc || 43) - 60));
+for(int i28abc = 0; i28abc < 1; i28abc++){
+fio::println(v0abcd);
+int c29abc = 4;
+while((c29abc > 0)){
+fio::println(v0abcd);
+fio::println(i27abc);
+int v30abc = ((50 > 47) || (49 * ((v0abcd || (i28abc == i28abc)) || v0abcd)));
+f1abcd(56);
+c29abc = (c29abc - 1);
+}
+};
+int v31abc = 36;
+int c32abc = 1;
+while((c32abc > 0)){
+f2abcd(((i27abc * v31abc) - i27abc),((47 + f7abcd(i27abc,34,c32abc)) - (f2abcd(v0abcd,c1abcd) == 84)));
+int v33abc = ((((c1abcd == 9) * 46) - v31abc) < ((c32abc * c32abc) * 0));
+for(int i34abc = 0; i34abc < 1; i34abc++){
+v0abcd = ((v31abc + i27abc) + 33);
+};
+int c35abc = 4;
+while((c35abc > 0)){
+int v36abc = (((7 + ((80 * (3 >= c1abcd)) * c32abc)) - 34) >= v31abc);
+f8abcd();
+fio::println(c32abc);
+int v37abc = ((!(c35abc) * (c1abcd * v0abcd)) >= (20 + c35abc));
+c35abc = (c35abc - 1);
+}
+fio::println(c35abc);
+c32abc = (c32abc - 1);
+}
+fio::println(c32abc);
+};
+return 78;
+}
+
+int f11abc(){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int c1abcd = 4;
+while((c1abcd > 0)){
+int v2abcd = ((c1abcd - 38) < (22 * ((c1abcd + c1abcd) || i0abcd)));
+c1abcd = (c1abcd - 1);
+}
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+if((16 != ((28 - 44) > ((i3abcd * f10abc()) + (i3abcd * i0abcd))))){
+fio::println(c1abcd);
+} else {
+int v4abcd = ((c1abcd + f4abcd(93,31,c1abcd)) || (-(c1abcd) / 9));
+f7abcd(((v4abcd || f8abcd()) + v4abcd),((22 * f7abcd(c1abcd,15,i3abcd)) / 8),((i3abcd + i0abcd) / 4));
+}
+int v5abcd = -(((f3abcd(49) + i0abcd) - (c1abcd / 9)));
+int v6abcd = (((c1abcd * 78) / 6) + -((11 + 44)));
+f10abc();
+for(int i7abcd = 0; i7abcd < 1; i7abcd++){
+int v8abcd = ((v5abcd == v5abcd) || (c1abcd * (28 / 2)));
+int v9abcd = (f8abcd() && (75 < (87 * v8abcd)));
+int v10abc = (((v5abcd * v9abcd) - -(i7abcd)) && i3abcd);
+v8abcd = (((33 + 90) + 62) <= ((f2abcd(79,c1abcd) / 2) - (i0abcd < 64)));
+int v11abc = ((i7abcd - (i3abcd * (f6abcd(v10abc) * v5abcd))) < f4abcd(v6abcd,(60 - 99),71));
+};
+};
+};
+int v12abc = (!(52) - (73 / 7));
+f2abcd((((v12abc * 83) > 23) > v12abc),-((v12abc > v12abc)));
+return v12abc;
+}
+
+int f12abc(int p0abcd){
+int v0abcd = ((p0abcd + p0abcd) - (p0abcd / 2));
+return ((30 - (p0abcd / 4)) * p0abcd);
+}
+
+int f13abc(int p0abcd){
+if((98 != ((22 || 21) || p0abcd))){
+int c0abcd = 4;
+while((c0abcd > 0)){
+f1abcd((p0abcd * -(31)));
+int v1abcd = 38;
+c0abcd = (c0abcd - 1);
+}
+}
+int v2abcd = ((28 + 14) + (42 / 2));
+f11abc();
+fio::println(p0abcd);
+int v3abcd = v2abcd;
+return (!(v2abcd) / 8);
+}
+
+int f14abc(int p0abcd){
+for(int i0abcd = 0; i0abcd < 4; i0abcd++){
+int v1abcd = i0abcd;
+for(int i2abcd = 0;(i2abcd < 2);i2abcd++){
+int v3abcd = f10abc();
+int v4abcd = ((i2abcd < (64 + (p0abcd * 87))) >= i0abcd);
+if((((94 + v4abcd) - -(23)) > (f8abcd() - (i0abcd < 99)))){
+fio::println(i2abcd);
+int v5abcd = (-((38 + p0abcd)) * 4);
+int v6abcd = f1abcd((v3abcd - (69 * i0abcd)));
+int v7abcd = 1;
+fio::println(v4abcd);
+}
+int c8abcd = 1;
+while((c8abcd > 0)){
+int v9abcd = ((((f3abcd(57) * v3abcd) / 5) - 28) - v3abcd);
+c8abcd = (c8abcd - 1);
+}
+int v10abc = p0abcd;
+}
+if((((f5abcd(8) + i0abcd) - (v1abcd - 53)) <= i0abcd)){
+int v11abc = (((-(v1abcd) * v1abcd) * v1abcd) / 3);
+} else {
+if((((70 * i0abcd) * i0abcd) >= (((14 * i0abcd) * p0abcd) * p0abcd))){
+fio::println(i0abcd);
+int v12abc = 60;
+fio::println(p0abcd);
+fio::println(p0abcd);
+}
+}
+if((i0abcd >= 29)){
+fio::println(v1abcd);
+if((v1abcd < !((p0abcd * f0abcd(76,i0abcd))))){
+fio::println(i0abcd);
+int v13abc = ((v1abcd == ((87 * 22) < 31)) / 4);
+int v14abc = (i0abcd * v1abcd);
+f6abcd(v1abcd);
+}
+for(int i15abc = 0; i15abc < 2; i15abc++){
+fio::println(v1abcd);
+int v16abc = ((i15abc - 5) == (!(i15abc) >= (56 / 3)));
+int v17abc = ((f7abcd(v1abcd,(p0abcd != 43),v16abc) + ((66 * i15abc) * 20)) + 17);
+int v18abc = ((((i0abcd + (70 * v1abcd)) - p0abcd) - v1abcd) - (7 * v17abc));
+p0abcd = ((v1abcd * v17abc) && (i0abcd / 8));
+};
+for(int i19abc = 0; i19abc < 2; i19abc++){
+f3abcd(45);
+int v20abc = (((v1abcd * i19abc) * 50) / 8);
+v20abc = i19abc;
+f4abcd((v20abc + !(f1abcd(v1abcd))),((55 > v1abcd) || (v20abc <= 71)),i19abc);
+};
+if((((p0abcd * 12) == p0abcd) <= ((i0abcd == 66) * !(f6abcd(50))))){
+int v21abc = (p0abcd - ((p0abcd + 33) + 62));
+int v22abc = p0abcd;
+int v23abc = 17;
+f8abcd();
+int v24abc = v23abc;
+v23abc = 71;
+} else {
+int v25abc = ((((((p0abcd * 92) + 14) - 19) + (v1abcd + v1abcd)) - v1abcd) <= v1abcd);
+int v26abc = (((v25abc <= 12) >= 42) <= i0abcd);
+}
+}
+p0abcd = (6 != v1abcd);
+};
+int v27abc = !(49);
+int v28abc = (p0abcd * (p0abcd - p0abcd));
+for(int i29abc = 0; i29abc < 3; i29abc++){
+if((10 != 21)){
+int v30abc = (((30 * v27abc) / 8) < ((11 + (v28abc * i29abc)) + v27abc));
+int v31abc = ((33 + i29abc) <= (f10abc() / 3));
+int v32abc = ((v27abc - f2abcd(v30abc,v30abc)) && i29abc);
+if(((v32abc < ((7 - v28abc) + 68)) == (((v28abc / 7) - i29abc) + 89))){
+int v33abc = (v31abc / 5);
+f4abcd(64,((p0abcd * v31abc) && f13abc(v32abc)),((f9abcd(81) - v32abc) < (v31abc / 9)));
+int v34abc = (v30abc * v28abc);
+int v35abc = ((7 / 4) > !((i29abc != v31abc)));
+int v36abc = p0abcd;
+} else {
+v30abc = ((v28abc + v27abc) && (f4abcd(i29abc,84,i29abc) <= f8abcd()));
+int v37abc = 18;
+v28abc = (!(v31abc) - ((83 > f13abc(v27abc)) / 9));
+f7abcd(p0abcd,19,((14 / 8) < (v30abc + v28abc)));
+f1abcd(v30abc);
+p0abcd = (90 || ((((p0abcd + p0abcd) + v30abc) - (v30abc * v32abc)) - v31abc));
+}
+if((-((7 - v31abc)) > ((36 < v28abc) / 6))){
+int v38abc = ((!(v30abc) - (10 * 65)) || (81 + (v31abc == p0abcd)));
+int v39abc = ((v38abc + p0abcd) || (((62 * 22) != v27abc) && (12 / 9)));
+f5abcd(1);
+f4abcd((((v28abc * 36) - 77) == 72),96,(54 + v38abc));
+f3abcd((!(v39abc) + (v38abc / 5)));
+int v40abc = (19 > p0abcd);
+} else {
+f12abc(v30abc);
+}
+}
+int v41abc = 76;
+int c42abc = 1;
+while((c42abc > 0)){
+int c43abc = 2;
+while((c43abc > 0)){
+int v44abc = ((v28abc / 5) / 5);
+c43abc = (c43abc - 1);
+}
+f0abcd((f12abc(c42abc) && (34 / 8)),(81 > (86 / 4)));
+int v45abc = (((p0abcd - (92 * f13abc(79))) - 29) && (97 - (c43abc * 88)));
+c42abc = (c42abc - 1);
+}
+for(int i46abc = 0; i46abc < 4; i46abc++){
+fio::println(i46abc);
+if((((f9abcd(20) - (82 > i46abc)) >= 62) || (v27abc >= p0abcd))){
+int v47abc = ((93 + i46abc) || i29abc);
+int v48abc = (((v41abc != i29abc) || 60) < (73 / 6));
+fio::println(v48abc);
+}
+int v49abc = ((-(79) + i46abc) >= (20 - (46 / 4)));
+};
+};
+fio::println(p0abcd);
+f3abcd(((p0abcd - f13abc(v27abc)) < v27abc));
+return v27abc;
+}
+
+int f15abc(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = f14abc((36 >= (32 / 2)));
+int v1abcd = 16;
+return v0abcd;
+}
+
+int f16abc(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 3; i0abcd++){
+int v1abcd = 42;
+for(int i2abcd = 0; i2abcd < 3; i2abcd++){
+p2abcd = ((p0abcd + v1abcd) && (f12abc(p2abcd) * p2abcd));
+fio::println(v1abcd);
+int v3abcd = ((!(v1abcd) / 9) < i2abcd);
+int c4abcd = 1;
+while((c4abcd > 0)){
+int v5abcd = 53;
+p0abcd = (v3abcd || ((f7abcd(p1abcd,31,c4abcd) - 68) / 8));
+int v6abcd = (((0 - 3) <= ((i0abcd + i2abcd) - p1abcd)) >= (96 / 4));
+c4abcd = (c4abcd - 1);
+}
+};
+int c7abcd = 1;
+while((c7abcd > 0)){
+if(((p1abcd + (i0abcd / 4)) < 19)){
+fio::println(p1abcd);
+int v8abcd = (((p2abcd * 89) * (c7abcd || p1abcd)) * i0abcd);
+int v9abcd = ((p0abcd - ((45 && 41) * c7abcd)) && v8abcd);
+int v10abc = c7abcd;
+fio::println(p1abcd);
+}
+p0abcd = ((((p2abcd / 3) * f14abc(3)) + p1abcd) != f10abc());
+int v11abc = (((i0abcd * f0abcd(p0abcd,62)) - v1abcd) + ((53 * (65 / 4)) / 1));
+for(int i12abc = 0; i12abc < 1; i12abc++){
+int v13abc = (((((60 + 94) - p2abcd) + (p2abcd * 46)) > i0abcd) >= f11abc());
+v11abc = 89;
+int v14abc = (((p2abcd - p2abcd) + v11abc) != (f3abcd(p2abcd) && (v13abc >= 8)));
+p1abcd = v13abc;
+int v15abc = i0abcd;
+int v16abc = (i0abcd / 3);
+};
+int c17abc = 1;
+while((c17abc > 0)){
+v1abcd = (p2abcd / 3);
+fio::println(v1abcd);
+int v18abc = (((22 * 16) / 9) + p1abcd);
+c17abc = (c17abc - 1);
+}
+if(((((28 && c17abc) < f15abc(c7abcd,v1abcd,i0abcd)) <= 94) == (((89 * 11) - v1abcd) - 69))){
+int v19abc = 3;
+} else {
+int v20abc = i0abcd;
+}
+c7abcd = (c7abcd - 1);
+}
+};
+return (p1abcd / 6);
+}
+
+int f17abc(int p0abcd,int p1abcd,int p2abcd){
+if(((((f7abcd(p1abcd,p0abcd,p1abcd) * p1abcd) * p2abcd) * 28) != (!(p1abcd) + 34))){
+if((((((p0abcd / 5) > 38) == f12abc(p2abcd)) > p0abcd) && (30 / 1))){
+for(int i0abcd = 0; i0abcd < 3; i0abcd++){
+fio::println(p2abcd);
+f5abcd((31 / 4));
+};
+fio::println(p2abcd);
+int v1abcd = p0abcd;
+int v2abcd = (((78 * v1abcd) - p1abcd) || v1abcd);
+for(int i3abcd = 0;(i3abcd < 2);i3abcd++){
+int v4abcd = (p2abcd - (p0abcd * v1abcd));
+}
+for(int i5abcd = 0;(i5abcd < 4);i5abcd++){
+int v6abcd = (2 || ((f14abc(i5abcd) + v1abcd) + -((57 >= v2abcd))));
+int v7abcd = 73;
+}
+} else {
+if(((-(52) + (p2abcd * 10)) < (!(85) && 28))){
+int v8abcd = p0abcd;
+int v9abcd = -(-(f3abcd(v8abcd)));
+int v10abc = p1abcd;
+v8abcd = v10abc;
+fio::println(p1abcd);
+p0abcd = (!((p2abcd * v8abcd)) - ((v10abc + v10abc) + (p1abcd * v8abcd)));
+} else {
+int v11abc = (p1abcd != (76 + p2abcd));
+int v12abc = ((((p2abcd >= p1abcd) + p1abcd) + (90 || 33)) != 24);
+}
+for(int i13abc = 0;(i13abc < 2);i13abc++){
+fio::println(p1abcd);
+int v14abc = (((f2abcd(33,79) * f16abc(68,27,p2abcd)) + -(52)) - (((p0abcd * 74) + 98) - p1abcd));
+int v15abc = (p0abcd - 94);
+}
+f9abcd(((p0abcd - p0abcd) == p1abcd));
+int c16abc = 1;
+while((c16abc > 0)){
+fio::println(p0abcd);
+p2abcd = ((22 != (85 / 1)) / 9);
+fio::println(p1abcd);
+f13abc((81 / 2));
+c16abc = (c16abc - 1);
+}
+fio::println(p0abcd);
+fio::println(p2abcd);
+}
+int v17abc = 63;
+int v18abc = ((f11abc() || f6abcd(p2abcd)) == ((v17abc - v17abc) * ((p0abcd + 13) == p0abcd)));
+int v19abc = ((p2abcd - (32 / 6)) >= 80);
+v19abc = !(((25 - v19abc) && (6 / 2)));
+} else {
+fio::println(p1abcd);
+int v20abc = ((58 < (12 - p2abcd)) >= 66);
+}
+for(int i21abc = 0;(i21abc < 4);i21abc++){
+for(int i22abc = 0; i22abc < 4; i22abc++){
+int c23abc = 3;
+while((c23abc > 0)){
+fio::println(p2abcd);
+c23abc = (c23abc - 1);
+}
+int c24abc = 1;
+while((c24abc > 0)){
+f6abcd(((p1abcd - 48) + (85 && c24abc)));
+int v25abc = (86 / 7);
+fio::println(p1abcd);
+c24abc = (c24abc - 1);
+}
+fio::println(c24abc);
+};
+}
+fio::println(p0abcd);
+return 4;
+}
+
+int f18abc(){
+int v0abcd = (!((65 - 41)) / 9);
+int v1abcd = ((12 + f14abc(v0abcd)) - (85 || (v0abcd <= (v0abcd + v0abcd))));
+int c2abcd = 3;
+while((c2abcd > 0)){
+if((59 && (v1abcd >= 25))){
+int v3abcd = ((v0abcd > (c2abcd - c2abcd)) != c2abcd);
+} else {
+int c4abcd = 4;
+while((c4abcd > 0)){
+int v5abcd = c4abcd;
+int v6abcd = ((v1abcd <= (56 - c2abcd)) && (6 < (38 - v1abcd)));
+fio::println(v6abcd);
+f11abc();
+c4abcd = (c4abcd - 1);
+}
+int c7abcd = 2;
+while((c7abcd > 0)){
+int v8abcd = c7abcd;
+f2abcd(((v8abcd * 5) * v1abcd),(-(c2abcd) / 3));
+c7abcd = (c7abcd - 1);
+}
+for(int i9abcd = 0; i9abcd < 1; i9abcd++){
+int v10abc = (4 - ((17 && 18) && (29 + i9abcd)));
+};
+}
+if((v1abcd != ((-(65) - c2abcd) >= 64))){
+int v11abc = 39;
+int c12abc = 4;
+while((c12abc > 0)){
+fio::println(v1abcd);
+c12abc = (c12abc - 1);
+}
+int c13abc = 3;
+while((c13abc > 0)){
+int v14abc = -(v0abcd);
+int v15abc = ((((5 - f7abcd(68,82,v0abcd)) - (25 * v14abc)) == (v1abcd * 58)) != (f13abc(60) * 49));
+v11abc = (((28 / 8) - (75 * f15abc(v11abc,98,v14abc))) && (c13abc == 62));
+int v16abc = v15abc;
+c13abc = (c13abc - 1);
+}
+fio::println(c13abc);
+int c17abc = 3;
+while((c17abc > 0)){
+v0abcd = (((v1abcd + c13abc) + v1abcd) >= ((12 + 22) <= c17abc));
+v0abcd = ((((((c12abc * v1abcd) + v11abc) + f10abc()) + 94) - v11abc) + (c2abcd / 6));
+fio::println(c12abc);
+f11abc();
+fio::println(c17abc);
+c17abc = (c17abc - 1);
+}
+int v18abc = 52;
+}
+fio::println(v1abcd);
+for(int i19abc = 0; i19abc < 1; i19abc++){
+int c20abc = 4;
+while((c20abc > 0)){
+int v21abc = (!(21) - (23 >= (44 * v0abcd)));
+int v22abc = ((c20abc >= (v0abcd / 5)) - ((62 == v0abcd) != !(30)));
+fio::println(c20abc);
+int v23abc = (f16abc((i19abc + 48),(c20abc < 78),(v1abcd && v0abcd)) >= i19abc);
+f8abcd();
+v1abcd = ((f15abc((f9abcd(v1abcd) + f6abcd(i19abc)),(25 && f1abcd(v22abc)),(v22abc * 48)) * c2abcd) != 63);
+c20abc = (c20abc - 1);
+}
+for(int i24abc = 0; i24abc < 3; i24abc++){
+f5abcd(((i19abc * v1abcd) == (c20abc + c20abc)));
+fio::println(i19abc);
+int v25abc = -(((83 - 79) == (v0abcd / 6)));
+int v26abc = ((i24abc * !(i24abc)) - c2abcd);
+};
+for(int i27abc = 0;(i27abc < 1);i27abc++){
+v0abcd = v0abcd;
+f16abc(i19abc,!((56 + 1)),(f0abcd(i19abc,v1abcd) <= (f3abcd(i19abc) - 35)));
+v0abcd = (27 >= (i27abc || (f8abcd() <= f6abcd(i19abc))));
+f11abc();
+}
+int v28abc = (((38 - c20abc) >= c20abc) >= (c2abcd + v0abcd));
+int c29abc = 3;
+while((c29abc > 0)){
+v28abc = c20abc;
+int v30abc = v1abcd;
+c29abc = (c29abc - 1);
+}
+};
+c2abcd = (c2abcd - 1);
+}
+return (((51 * v0abcd) - v0abcd) && (v1abcd * v1abcd));
+}
+
+int f19abc(int p0abcd,int p1abcd,int p2abcd){
+int c0abcd = 1;
+while((c0abcd > 0)){
+fio::println(p0abcd);
+int v1abcd = (p0abcd && 25);
+c0abcd = (c0abcd - 1);
+}
+for(int i2abcd = 0;(i2abcd < 2);i2abcd++){
+int c3abcd = 3;
+while((c3abcd > 0)){
+for(int i4abcd = 0;(i4abcd < 1);i4abcd++){
+int v5abcd = (0 * ((p0abcd - c0abcd) - (p0abcd * 90)));
+int v6abcd = ((c0abcd / 3) && (i2abcd == (c0abcd + v5abcd)));
+int v7abcd = (((-((v6abcd / 8)) - c0abcd) + (p2abcd * f0abcd(c0abcd,39))) - c0abcd);
+}
+int c8abcd = 4;
+while((c8abcd > 0)){
+int v9abcd = (c8abcd * (3 + (f9abcd(i2abcd) * c3abcd)));
+int v10abc = (((38 + p0abcd) >= (15 - 5)) * ((i2abcd - 37) && (81 >= i2abcd)));
+fio::println(p2abcd);
+p2abcd = (94 != (41 <= ((f3abcd(13) + p1abcd) - (c8abcd / 1))));
+fio::println(c8abcd);
+c8abcd = (c8abcd - 1);
+}
+int v11abc = ((c0abcd != (65 * 78)) == (p0abcd * p1abcd));
+v11abc = ((((p0abcd * v11abc) * (93 - p0abcd)) * (52 + 93)) >= (42 + v11abc));
+v11abc = (((c8abcd + p0abcd) - (v11abc || 89)) / 8);
+f8abcd();
+c3abcd = (c3abcd - 1);
+}
+if((((p1abcd - f16abc(27,c0abcd,i2abcd)) == i2abcd) != ((p0abcd < c3abcd) <= (82 / 6)))){
+p0abcd = 36;
+int v12abc = (i2abcd > 87);
+int c13abc = 1;
+while((c13abc > 0)){
+p2abcd = c0abcd;
+c13abc = (c13abc - 1);
+}
+fio::println(c13abc);
+int v14abc = (((c0abcd * 66) * f2abcd(i2abcd,98)) - 8);
+p1abcd = p0abcd;
+} else {
+fio::println(p2abcd);
+}
+fio::println(c0abcd);
+int v15abc = c3abcd;
+int c16abc = 2;
+while((c16abc > 0)){
+int v17abc = (!((21 - c16abc)) == i2abcd);
+p1abcd = ((((p2abcd == 56) + f18abc()) - f13abc(20)) - c16abc);
+c16abc = (c16abc - 1);
+}
+}
+return p2abcd;
+}
+
+int f20abc(){
+for(int i0abcd = 0;(i0abcd < 3);i0abcd++){
+int v1abcd = f8abcd();
+int c2abcd = 4;
+while((c2abcd > 0)){
+for(int i3abcd = 0;(i3abcd < 3);i3abcd++){
+int v4abcd = (v1abcd != ((c2abcd <= (i3abcd * 79)) < (86 + 9)));
+int v5abcd = ((v1abcd - i3abcd) + (v1abcd || (f13abc(v4abcd) + (i3abcd * c2abcd))));
+v5abcd = (((v5abcd * f6abcd(i0abcd)) * v5abcd) && f18abc());
+int v6abcd = (v1abcd || ((((78 + f13abc(v5abcd)) + v5abcd) + (i0abcd * v1abcd)) && v1abcd));
+}
+int c7abcd = 4;
+while((c7abcd > 0)){
+int v8abcd = (c2abcd + ((78 != 8) * f0abcd(c2abcd,c2abcd)));
+int v9abcd = (((94 / 8) * c7abcd) >= ((v1abcd < c2abcd) - (v8abcd - i0abcd)));
+v8abcd = (c2abcd == (((35 / 8) - v8abcd) >= -(f12abc(c2abcd))));
+int v10abc = ((62 * v8abcd) / 5);
+c7abcd = (c7abcd - 1);
+}
+f9abcd((82 || (c2abcd + (c2abcd * 99))));
+v1abcd = ((i0abcd - (c7abcd * v1abcd)) - i0abcd);
+if(((((c2abcd * 17) / 6) == 18) == (i0abcd + (68 * c7abcd)))){
+int v11abc = (v1abcd != (54 > (c7abcd - i0abcd)));
+int v12abc = c2abcd;
+int v13abc = 60;
+fio::println(c7abcd);
+f1abcd(v1abcd);
+f11abc();
+} else {
+f19abc(((43 * c2abcd) / 8),(41 >= (22 / 8)),-(i0abcd));
+f19abc((95 <= ((c7abcd - c7abcd) - c7abcd)),(f13abc(c2abcd) == (82 <= -(v1abcd))),i0abcd);
+int v14abc = 79;
+v14abc = ((!(i0abcd) / 1) + ((49 - f13abc(66)) <= !(14)));
+f16abc(27,c2abcd,(((i0abcd - v1abcd) + 87) + i0abcd));
+f14abc(-((i0abcd >= c2abcd)));
+}
+c2abcd = (c2abcd - 1);
+}
+for(int i15abc = 0;(i15abc < 4);i15abc++){
+int v16abc = ((i0abcd + (30 - 69)) != 37);
+fio::println(i0abcd);
+fio::println(c2abcd);
+for(int i17abc = 0; i17abc < 2; i17abc++){
+f0abcd((1 + (v16abc * v1abcd)),83);
+fio::println(c2abcd);
+int v18abc = (((53 * v1abcd) + 92) - v1abcd);
+};
+}
+fio::println(v1abcd);
+if((v1abcd != (c2abcd / 3))){
+f6abcd(((c2abcd + c2abcd) + 5));
+int c19abc = 2;
+while((c19abc > 0)){
+f17abc((!(c19abc) / 4),((-(c2abcd) - 93) || c2abcd),49);
+v1abcd = v1abcd;
+int v20abc = 92;
+c19abc = (c19abc - 1);
+}
+int v21abc = ((54 >= i0abcd) > ((c2abcd * c19abc) * i0abcd));
+f9abcd(((c19abc - c2abcd) != 49));
+int v22abc = ((((c19abc + 70) + 3) == f10abc()) != 97);
+} else {
+if((0 < 23)){
+int v23abc = c2abcd;
+fio::println(i0abcd);
+fio::println(i0abcd);
+int v24abc = (38 != ((v23abc / 3) - i0abcd));
+v24abc = (c2abcd / 2);
+}
+int v25abc = !(v1abcd);
+if((20 > (-(v25abc) - (0 || f4abcd(33,v1abcd,13))))){
+int v26abc = (34 + ((68 * 86) + v25abc));
+}
+}
+}
+for(int i27abc = 0; i27abc < 2; i27abc++){
+fio::println(i27abc);
+if((i27abc < i27abc)){
+for(int i28abc = 0; i28abc < 2; i28abc++){
+f6abcd(-((i28abc * i27abc)));
+int v29abc = (((i28abc + i28abc) - f8abcd()) && (i28abc - (80 + i27abc)));
+f18abc();
+f16abc(i27abc,(85 - (90 / 2)),((57 > (46 + i28abc)) < 65));
+f17abc((v29abc || (77 * i28abc)),(((i27abc <= i28abc) - i27abc) - i28abc),(-(i28abc) / 1));
+};
+fio::println(i27abc);
+for(int i30abc = 0; i30abc < 2; i30abc++){
+fio::println(i27abc);
+f7abcd((i27abc && (34 + 32)),88,((i27abc < 96) >= -(56)));
+};
+}
+int v31abc = (i27abc >= ((i27abc || 12) + (i27abc * i27abc)));
+for(int i32abc = 0; i32abc < 4; i32abc++){
+f4abcd(((v31abc * 15) / 8),(i27abc && 37),(i32abc || (60 - (4 && 17))));
+v31abc = i32abc;
+f4abcd(((41 * i27abc) / 3),(v31abc - v31abc),((11 || f17abc(i27abc,v31abc,86)) / 8));
+};
+f5abcd(f6abcd((v31abc / 4)));
+};
+int v33abc = (52 + -((40 || 36)));
+return ((((-(v33abc) * v33abc) - v33abc) - (v33abc + v33abc)) != f7abcd(28,v33abc,87));
+}
+
+int f21abc(int p0abcd){
+f18abc();
+int v0abcd = (((p0abcd + 82) / 5) - f16abc((5 == 72),p0abcd,(p0abcd * 85)));
+f20abc();
+fio::println(v0abcd);
+p0abcd = (36 < -((27 != f8abcd())));
+int v1abcd = (p0abcd < -((v0abcd && 20)));
+return (((p0abcd / 3) + (66 - 6)) + v1abcd);
+}
+
+int f22abc(int p0abcd,int p1abcd){
+int v0abcd = ((p0abcd - !(76)) - p0abcd);
+if((((p1abcd / 5) - 78) != (1 / 5))){
+fio::println(p1abcd);
+int v1abcd = (84 < v0abcd);
+} else {
+for(int i2abcd = 0; i2abcd < 2; i2abcd++){
+fio::println(p0abcd);
+int v3abcd = ((i2abcd * p0abcd) + 72);
+for(int i4abcd = 0; i4abcd < 2; i4abcd++){
+int v5abcd = 56;
+int v6abcd = 43;
+int v7abcd = i2abcd;
+int v8abcd = (15 + i2abcd);
+p1abcd = (i4abcd == (((59 + (32 && p0abcd)) + p0abcd) <= (v0abcd / 6)));
+};
+for(int i9abcd = 0; i9abcd < 3; i9abcd++){
+int v10abc = 42;
+int v11abc = (((v10abc - (i2abcd * 47)) < (37 * 52)) < 92);
+};
+int v12abc = v3abcd;
+int c13abc = 1;
+while((c13abc > 0)){
+int v14abc = 4;
+fio::println(c13abc);
+int v15abc = (p0abcd - 1);
+f20abc();
+v15abc = (v0abcd + v14abc);
+fio::println(v12abc);
+c13abc = (c13abc - 1);
+}
+};
+fio::println(p0abcd);
+int v16abc = p1abcd;
+if((v0abcd <= v16abc)){
+f7abcd((!(f11abc()) + p1abcd),((22 < (p0abcd * p1abcd)) <= 10),((p0abcd / 8) && p0abcd));
+for(int i17abc = 0; i17abc < 1; i17abc++){
+f15abc((v16abc <= (p1abcd + 36)),(((v16abc != i17abc) >= 33) || p0abcd),p1abcd);
+int v18abc = 13;
+f10abc();
+fio::println(v0abcd);
+int v19abc = f21abc(96);
+};
+for(int i20abc = 0; i20abc < 2; i20abc++){
+int v21abc = i20abc;
+fio::println(v21abc);
+};
+p0abcd = (((!(28) <= p1abcd) != (92 * 99)) && v16abc);
+}
+fio::println(v16abc);
+int v22abc = !(((p1abcd + v0abcd) + v16abc));
+}
+return ((26 != (p1abcd + (v0abcd * p0abcd))) / 6);
+}
+
+int f23abc(){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+if((41 != 68)){
+int v1abcd = ((i0abcd * !(30)) || (i0abcd / 9));
+int v2abcd = f6abcd((v1abcd - (99 * (v1abcd >= i0abcd))));
+for(int i3abcd = 0;(i3abcd < 2);i3abcd++){
+int v4abcd = 80;
+fio::println(v2abcd);
+}
+fio::println(v1abcd);
+int v5abcd = i0abcd;
+} else {
+int v6abcd = i0abcd;
+int c7abcd = 4;
+while((c7abcd > 0)){
+f4abcd((74 || ((i0abcd - 70) <= i0abcd)),(v6abcd * 57),c7abcd);
+int v8abcd = v6abcd;
+fio::println(v8abcd);
+int v9abcd = ((((c7abcd + v8abcd) * 96) >= i0abcd) != ((i0abcd * i0abcd) >= 85));
+v8abcd = -(7);
+fio::println(v6abcd);
+c7abcd = (c7abcd - 1);
+}
+if((84 >= 56)){
+v6abcd = ((-(c7abcd) - (i0abcd * 48)) - f6abcd(f1abcd(79)));
+int v10abc = !((-(c7abcd) + -(i0abcd)));
+int v11abc = ((v10abc > v6abcd) || (3 > i0abcd));
+}
+int v12abc = 74;
+if(((f13abc((47 && c7abcd)) > (f19abc(c7abcd,29,40) - 57)) == !(60))){
+v12abc = (((i0abcd * v12abc) / 6) - ((22 - f6abcd(v12abc)) - c7abcd));
+int v13abc = i0abcd;
+fio::println(v6abcd);
+fio::println(v6abcd);
+fio::println(c7abcd);
+}
+}
+int v14abc = i0abcd;
+if(((v14abc + (v14abc * v14abc)) >= ((0 - 94) + v14abc))){
+fio::println(v14abc);
+if(((v14abc / 6) == (f13abc(v14abc) - (v14abc < v14abc)))){
+fio::println(v14abc);
+int v15abc = (v14abc <= ((i0abcd <= 53) / 8));
+int v16abc = ((v15abc <= (v15abc + (i0abcd >= 56))) * (73 * (f3abcd(i0abcd) - f15abc(v14abc,97,54))));
+fio::println(v15abc);
+} else {
+int v17abc = (((v14abc * 84) * v14abc) <= f7abcd(!(i0abcd),-(v14abc),(i0abcd > v14abc)));
+fio::println(v14abc);
+int v18abc = ((f1abcd((i0abcd * v14abc)) - (i0abcd * i0abcd)) - (i0abcd < 83));
+f1abcd((-(27) != (42 + i0abcd)));
+int v19abc = (79 > (f21abc(v18abc) + ((v18abc * f3abcd(48)) / 3)));
+int v20abc = 35;
+}
+f9abcd((i0abcd < (v14abc - v14abc)));
+int v21abc = -((f5abcd(84) - v14abc));
+} else {
+f5abcd(((91 + f3abcd(80)) - i0abcd));
+v14abc = (18 >= -(79));
+}
+int v22abc = ((v14abc - (i0abcd && i0abcd)) - i0abcd);
+fio::println(v14abc);
+};
+int v23abc = (47 || ((57 - 76) <= (15 * 80)));
+int v24abc = (((f17abc(v23abc,70,51) + 32) - 25) == (v23abc > (v23abc * v23abc)));
+int v25abc = (f0abcd(v24abc,-(64)) / 3);
+int v26abc = ((v23abc * 94) - 93);
+int v27abc = ((22 - v23abc) || (36 > 66));
+return (33 > 16);
+}
+
+int f24abc(int p0abcd){
+int v0abcd = 66;
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+int v2abcd = ((i1abcd + 32) != (p0abcd - f2abcd(i1abcd,p0abcd)));
+p0abcd = (((f10abc() < p0abcd) != p0abcd) && 24);
+int v3abcd = f5abcd((-(v2abcd) / 7));
+int v4abcd = 57;
+};
+int v5abcd = ((v0abcd + v0abcd) || (((v0abcd + 89) * -(43)) > (p0abcd + p0abcd)));
+int v6abcd = ((v5abcd * p0abcd) || ((f7abcd(v0abcd,54,94) * v5abcd) / 9));
+int c7abcd = 1;
+while((c7abcd > 0)){
+for(int i8abcd = 0; i8abcd < 1; i8abcd++){
+int v9abcd = (f14abc(97) == ((v0abcd / 1) + (v5abcd / 8)));
+f5abcd(14);
+if(((v6abcd < (v5abcd - i8abcd)) != (v5abcd * 79))){
+int v10abc = (f14abc(v6abcd) >= ((58 * v5abcd) / 7));
+f15abc((p0abcd - p0abcd),((55 == c7abcd) >= (c7abcd + p0abcd)),-((v9abcd + i8abcd)));
+int v11abc = (((p0abcd * c7abcd) / 8) + v5abcd);
+v10abc = ((f12abc(81) / 3) && (((f6abcd(60) - v10abc) + i8abcd) + (v10abc / 8)));
+fio::println(i8abcd);
+int v12abc = (((v11abc - v5abcd) >= (v6abcd + v6abcd)) < f17abc((v9abcd == i8abcd),i8abcd,(41 != i8abcd)));
+}
+};
+int v13abc = (((32 * p0abcd) + f23abc()) * 84);
+c7abcd = (c7abcd - 1);
+}
+return (((p0abcd * v0abcd) * (v0abcd - 39)) < (p0abcd || (f4abcd(48,p0abcd,v5abcd) && (87 - 91))));
+}
+
+int f25abc(int p0abcd){
+for(int i0abcd = 0; i0abcd < 3; i0abcd++){
+int v1abcd = ((78 - f21abc(92)) + !(i0abcd));
+int v2abcd = p0abcd;
+};
+if(((((((87 + 77) - f22abc(p0abcd,p0abcd)) + p0abcd) == p0abcd) != p0abcd) && (p0abcd == p0abcd))){
+int v3abcd = 6;
+int c4abcd = 3;
+while((c4abcd > 0)){
+p0abcd = (!((f3abcd(c4abcd) && 29)) + c4abcd);
+for(int i5abcd = 0; i5abcd < 2; i5abcd++){
+int v6abcd = 21;
+};
+for(int i7abcd = 0;(i7abcd < 4);i7abcd++){
+f22abc(((i7abcd * p0abcd) == p0abcd),((46 * 41) >= c4abcd));
+}
+fio::println(p0abcd);
+c4abcd = (c4abcd - 1);
+}
+}
+int v8abcd = (73 || (((12 * f11abc()) * 83) && 14));
+int v9abcd = -(((v8abcd + 11) == !(11)));
+return ((45 || (v8abcd * v9abcd)) || v8abcd);
+}
+
+int f26abc(int p0abcd,int p1abcd){
+int v0abcd = (p0abcd + (p0abcd * (p0abcd - p0abcd)));
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+int v2abcd = v0abcd;
+int v3abcd = i1abcd;
+p1abcd = ((80 >= ((11 + 23) - v2abcd)) / 5);
+}
+f17abc(3,(87 == (p0abcd + (p1abcd * 2))),p0abcd);
+fio::println(p1abcd);
+int c4abcd = 1;
+while((c4abcd > 0)){
+int c5abcd = 4;
+while((c5abcd > 0)){
+fio::println(c5abcd);
+p0abcd = -((p0abcd * (c4abcd / 2)));
+fio::println(v0abcd);
+int v6abcd = ((-(f20abc()) + c4abcd) >= (p1abcd / 7));
+for(int i7abcd = 0;(i7abcd < 1);i7abcd++){
+int v8abcd = ((c4abcd >= 52) && v6abcd);
+f11abc();
+int v9abcd = ((p1abcd / 1) != (v6abcd - 68));
+}
+int v10abc = (29 - 53);
+c5abcd = (c5abcd - 1);
+}
+int v11abc = ((82 * 35) != (v0abcd / 3));
+for(int i12abc = 0; i12abc < 3; i12abc++){
+int v13abc = (10 - v11abc);
+int v14abc = ((p1abcd / 8) / 1);
+int c15abc = 1;
+while((c15abc > 0)){
+int v16abc = (f25abc(63) * (f6abcd(v14abc) < (v14abc - (v0abcd / 8))));
+fio::println(c4abcd);
+int v17abc = !((-(v13abc) * f12abc(c4abcd)));
+fio::println(c5abcd);
+f7abcd(36,(c15abc + (v13abc / 2)),i12abc);
+int v18abc = ((((-((18 + 49)) * f1abcd(v14abc)) - f8abcd()) < c4abcd) >= c4abcd);
+c15abc = (c15abc - 1);
+}
+int c19abc = 2;
+while((c19abc > 0)){
+fio::println(c15abc);
+int v20abc = (!(p0abcd) * 63);
+fio::println(c5abcd);
+v0abcd = (31 <= (v20abc - ((f6abcd(i12abc) - (43 * v14abc)) < f1abcd(p0abcd))));
+p1abcd = ((c19abc > c15abc) != (v0abcd + i12abc));
+c19abc = (c19abc - 1);
+}
+int v21abc = ((56 + v0abcd) || (v14abc + 75));
+};
+for(int i22abc = 0;(i22abc < 1);i22abc++){
+for(int i23abc = 0;(i23abc < 3);i23abc++){
+int v24abc = ((-(c4abcd) - 56) || (c5abcd + (15 / 3)));
+f4abcd((f17abc(v0abcd,i22abc,p0abcd) * (v11abc * v24abc)),(i22abc * c5abcd),(v11abc >= (c5abcd + (10 - c5abcd))));
+int v25abc = (((f16abc(i23abc,v0abcd,c4abcd) + i22abc) <= v11abc) || (51 * p0abcd));
+f16abc((23 - (c4abcd * c5abcd)),((v11abc + c5abcd) || (v25abc * 25)),(((p0abcd && v25abc) + v25abc) - 70));
+p1abcd = (p0abcd && -((v0abcd + p1abcd)));
+int v26abc = (((69 - (48 * p0abcd)) + i23abc) - f15abc(21,p0abcd,81));
+}
+}
+int v27abc = (p0abcd <= v0abcd);
+c4abcd = (c4abcd - 1);
+}
+f10abc();
+return ((v0abcd * p1abcd) >= ((10 * p1abcd) / 5));
+}
+
+int f27abc(){
+int v0abcd = 53;
+int v1abcd = ((v0abcd > f17abc(60,79,v0abcd)) || (((3 + 79) > v0abcd) == (v0abcd - -(v0abcd))));
+int v2abcd = (v1abcd * -((62 || 11)));
+int v3abcd = (-(v0abcd) * v1abcd);
+return !(((29 <= (v3abcd - v3abcd)) > f12abc(6)));
+}
+
+int f28abc(int p0abcd,int p1abcd){
+for(int i0abcd = 0;(i0abcd < 2);i0abcd++){
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+int v2abcd = !((p0abcd - (46 / 2)));
+fio::println(i0abcd);
+int v3abcd = ((i1abcd / 6) + (-(v2abcd) * (f22abc(i0abcd,44) + (52 * !(p0abcd)))));
+if(((97 * (98 + f0abcd(p1abcd,56))) <= !((i0abcd - 7)))){
+fio::println(p1abcd);
+f13abc(i0abcd);
+} else {
+f5abcd(77);
+int v4abcd = (v2abcd < (f1abcd(p0abcd) / 9));
+fio::println(p1abcd);
+v3abcd = (((78 - v2abcd) == 34) + !((14 * p1abcd)));
+}
+};
+int c5abcd = 4;
+while((c5abcd > 0)){
+for(int i6abcd = 0;(i6abcd < 1);i6abcd++){
+int v7abcd = (i0abcd <= (76 - (f20abc() * 14)));
+fio::println(i0abcd);
+fio::println(i6abcd);
+fio::println(i0abcd);
+}
+f21abc(((c5abcd + f3abcd(p1abcd)) != i0abcd));
+fio::println(c5abcd);
+int c8abcd = 4;
+while((c8abcd > 0)){
+int v9abcd = ((c8abcd + c5abcd) || ((33 == (c5abcd + c5abcd)) == i0abcd));
+f9abcd((((28 * p1abcd) + 23) + 30));
+p0abcd = (((91 + v9abcd) - v9abcd) - (v9abcd * (28 - p1abcd)));
+int v10abc = ((c8abcd - 13) * -((f20abc() <= 94)));
+c8abcd = (c8abcd - 1);
+}
+c5abcd = (c5abcd - 1);
+}
+fio::println(c5abcd);
+for(int i11abc = 0;(i11abc < 2);i11abc++){
+int v12abc = ((f2abcd(i0abcd,c5abcd) <= (f25abc(i0abcd) - p1abcd)) > i0abcd);
+p1abcd = ((37 + ((c5abcd != 61) * 77)) < p1abcd);
+int v13abc = (i0abcd || (i0abcd - c5abcd));
+}
+}
+return 61;
+}
+
+int f29abc(int p0abcd,int p1abcd,int p2abcd){
+f8abcd();
+int v0abcd = (((p0abcd * p1abcd) + 23) && (p0abcd - (p1abcd * 54)));
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+int v2abcd = 82;
+if(((-((f21abc(p0abcd) < i1abcd)) == (90 - p1abcd)) == (p2abcd + v0abcd))){
+int v3abcd = (((55 == (f28abc(7,32) >= !(p1abcd))) >= v2abcd) > (93 * v0abcd));
+int v4abcd = (f6abcd(p0abcd) <= ((f21abc(91) + 55) + f10abc()));
+int v5abcd = i1abcd;
+if(((16 * (73 / 6)) >= -(v0abcd))){
+fio::println(v4abcd);
+} else {
+fio::println(v3abcd);
+int v6abcd = (((v5abcd / 4) * (22 - 16)) * ((73 != 53) && (p2abcd - 71)));
+f16abc((f28abc(v4abcd,70) - (83 * (v0abcd * 48))),(v0abcd == (v2abcd + (p2abcd * 92))),v3abcd);
+v6abcd = (!((4 <= f2abcd(v0abcd,p1abcd))) >= ((96 + 44) + 12));
+int v7abcd = (((((v2abcd * f16abc(p0abcd,i1abcd,v0abcd)) - 98) - 99) + v5abcd) - (p2abcd >= v6abcd));
+}
+int v8abcd = (((((v3abcd * 87) / 6) * 91) > 41) > f27abc());
+int c9abcd = 4;
+while((c9abcd > 0)){
+fio::println(p0abcd);
+v5abcd = p2abcd;
+int v10abc = ((66 + f0abcd(v4abcd,81)) == ((99 / 6) <= v3abcd));
+c9abcd = (c9abcd - 1);
+}
+}
+};
+int v11abc = ((8 / 2) - p0abcd);
+for(int i12abc = 0;(i12abc < 1);i12abc++){
+fio::println(p1abcd);
+f8abcd();
+}
+return ((78 * 75) / 4);
+}
+
+int solve(int p0abcd){
+int v0abcd = p0abcd;
+int v1abcd = (-((f0abcd(76,p0abcd) - 71)) - f3abcd((96 + p0abcd)));
+v0abcd = ((v1abcd - f19abc(v0abcd,v0abcd,21)) || (99 / 5));
+return (((v1abcd - (p0abcd * v1abcd)) > (p0abcd - v1abcd)) == (60 - 1));
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
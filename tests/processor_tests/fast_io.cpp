@@ -0,0 +1,94 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int solve(int a){
+int n = 0;
+fio::read(n);
+int total = 0;
+for(int i = 0; i < n; i++){
+int v = 0;
+fio::read(v);
+total = (total + v);
+};
+float f = 0.0;
+fio::read(f);
+char c = 'a';
+fio::read(c);
+bool b = 1;
+fio::println(total);
+fio::println(f);
+fio::println(c);
+fio::println(b);
+fio::println("done");
+int neg = (0 - total);
+fio::println(neg);
+int big = 0;
+fio::read(big);
+int x = 0;
+for(int i = 0; i < big; i++){
+x = i;
+fio::println(x);
+};
+return 0;
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
@@ -0,0 +1,640 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(int p0abcd,int p1abcd,int p2abcd){
+int c0abcd = 2;
+while((c0abcd > 0)){
+int v1abcd = ((15 * c0abcd) < 48);
+int c2abcd = 3;
+while((c2abcd > 0)){
+int v3abcd = (((-(c0abcd) * v1abcd) * 75) && ((2 || v1abcd) / 7));
+int c4abcd = 2;
+while((c4abcd > 0)){
+int v5abcd = 59;
+fio::println(c4abcd);
+int v6abcd = ((p0abcd + -(v3abcd)) - (p1abcd / 6));
+int v7abcd = v3abcd;
+int v8abcd = (((c0abcd != c0abcd) <= v5abcd) - p0abcd);
+c4abcd = (c4abcd - 1);
+}
+int v9abcd = ((69 == v3abcd) <= ((81 * c2abcd) / 4));
+c2abcd = (c2abcd - 1);
+}
+fio::println(v1abcd);
+for(int i10abc = 0; i10abc < 1; i10abc++){
+fio::println(p2abcd);
+for(int i11abc = 0;(i11abc < 3);i11abc++){
+int v12abc = p2abcd;
+int v13abc = (i10abc > (i10abc + (c0abcd * 36)));
+}
+v1abcd = p1abcd;
+int v14abc = (((57 || (67 + 95)) * 5) - (v1abcd * i10abc));
+int v15abc = (((-(i10abc) + p1abcd) - 64) + p0abcd);
+};
+int v16abc = (p1abcd + (p0abcd * v1abcd));
+c0abcd = (c0abcd - 1);
+}
+for(int i17abc = 0; i17abc < 1; i17abc++){
+if((!(35) != (p1abcd * -(48)))){
+int v18abc = (!((p1abcd < p1abcd)) >= 37);
+for(int i19abc = 0; i19abc < 3; i19abc++){
+fio::println(i19abc);
+int v20abc = (!((v18abc - i19abc)) - (v18abc / 5));
+};
+int v21abc = ((c0abcd || (c0abcd * p0abcd)) || 31);
+if(((p0abcd + c0abcd) == ((v21abc && p1abcd) + c0abcd))){
+int v22abc = (c0abcd && ((p0abcd * c0abcd) >= (p2abcd + v21abc)));
+p1abcd = !(((13 - v18abc) != v22abc));
+fio::println(v22abc);
+int v23abc = (((((i17abc - 21) - 82) - 85) + (73 - v18abc)) - p1abcd);
+v21abc = (36 - v22abc);
+v23abc = (95 >= 56);
+} else {
+int v24abc = ((71 * 15) * (p2abcd && (23 - (v21abc * v18abc))));
+fio::println(v24abc);
+fio::println(p0abcd);
+}
+} else {
+int v25abc = p1abcd;
+}
+};
+if((p2abcd == !(18))){
+for(int i26abc = 0;(i26abc < 2);i26abc++){
+int v27abc = (46 && ((p0abcd - i26abc) != (4 / 8)));
+int v28abc = ((((v27abc < 32) * 52) * 40) > (95 * !(p2abcd)));
+}
+}
+fio::println(p1abcd);
+return (!((43 * c0abcd)) != (c0abcd - (p1abcd != c0abcd)));
+}
+
+int f1abcd(int p0abcd,int p1abcd,int p2abcd){
+if(((53 <= 35) != (50 >= p0abcd))){
+int v0abcd = (((14 * 3) - (p2abcd * p1abcd)) + 96);
+int v1abcd = ((!(73) + 51) <= (59 && (21 * 26)));
+fio::println(p2abcd);
+int v2abcd = ((24 <= 85) && (58 * ((-(91) - v1abcd) - p2abcd)));
+} else {
+for(int i3abcd = 0;(i3abcd < 1);i3abcd++){
+int v4abcd = ((p0abcd && 74) && (-(i3abcd) / 9));
+fio::println(p2abcd);
+for(int i5abcd = 0;(i5abcd < 2);i5abcd++){
+int v6abcd = 89;
+}
+int v7abcd = -(((p2abcd >= 39) != -(56)));
+}
+int c8abcd = 4;
+while((c8abcd > 0)){
+for(int i9abcd = 0; i9abcd < 1; i9abcd++){
+int v10abc = ((i9abcd + c8abcd) && ((39 < (i9abcd - i9abcd)) < p0abcd));
+};
+c8abcd = (c8abcd - 1);
+}
+int v11abc = (((p2abcd * 23) + c8abcd) || ((89 >= p1abcd) != (p0abcd / 6)));
+int v12abc = (((v11abc - c8abcd) - c8abcd) && 77);
+int v13abc = (74 <= ((v12abc || p2abcd) / 8));
+}
+int v14abc = ((p2abcd - (p2abcd / 1)) || ((p0abcd - p0abcd) && (p2abcd || p2abcd)));
+for(int i15abc = 0; i15abc < 4; i15abc++){
+for(int i16abc = 0;(i16abc < 2);i16abc++){
+v14abc = (p2abcd == ((v14abc * 64) <= (20 + p2abcd)));
+int v17abc = 47;
+if(((-(18) == p0abcd) == (p0abcd < (((i16abc >= p2abcd) + 11) - i16abc)))){
+int v18abc = (v14abc == (p2abcd - 17));
+int v19abc = v18abc;
+v18abc = ((p2abcd + 86) - ((i16abc * p1abcd) / 4));
+int v20abc = (p2abcd != v18abc);
+}
+int v21abc = (((i15abc / 2) - i15abc) == ((v14abc / 4) > 65));
+}
+};
+return -(p1abcd);
+}
+
+int f2abcd(int p0abcd,int p1abcd){
+if((((p0abcd > p1abcd) == (p0abcd + p1abcd)) != ((16 / 5) >= p1abcd))){
+int v0abcd = (p1abcd - p1abcd);
+} else {
+for(int i1abcd = 0; i1abcd < 4; i1abcd++){
+p1abcd = ((i1abcd + !(66)) >= (((98 / 4) * 39) || p1abcd));
+int v2abcd = ((!(p1abcd) / 5) != 97);
+for(int i3abcd = 0; i3abcd < 4; i3abcd++){
+int v4abcd = (((46 * 38) - (81 * p1abcd)) + -(i1abcd));
+fio::println(i3abcd);
+fio::println(i3abcd);
+v2abcd = 17;
+fio::println(p0abcd);
+};
+int c5abcd = 4;
+while((c5abcd > 0)){
+int v6abcd = (((-((i1abcd && 79)) - c5abcd) + p0abcd) >= 52);
+c5abcd = (c5abcd - 1);
+}
+};
+int v7abcd = ((21 <= (p0abcd + 58)) == p0abcd);
+int v8abcd = ((88 && (51 + 91)) && (((57 * p0abcd) * 80) + p0abcd));
+if(((v7abcd + (60 * (v7abcd - 91))) > (p1abcd + (p1abcd * p1abcd)))){
+int v9abcd = (((((v8abcd + p0abcd) != p0abcd) * 9) < p1abcd) != p1abcd);
+}
+}
+if(((p0abcd + (p1abcd * p0abcd)) != 65)){
+int v10abc = ((p1abcd - (p0abcd && 34)) - (p0abcd == 4));
+if((85 < v10abc)){
+for(int i11abc = 0; i11abc < 1; i11abc++){
+int v12abc = (-((28 - 63)) / 6);
+int v13abc = (53 <= 71);
+};
+int v14abc = (((58 - (30 * 84)) && 16) && -((p0abcd - p1abcd)));
+if(((v10abc == (v14abc / 1)) >= ((v14abc - 68) + p0abcd))){
+v14abc = (-((p1abcd - p1abcd)) || (72 + (v14abc != p1abcd)));
+int v15abc = v10abc;
+int v16abc = 28;
+} else {
+int v17abc = ((((p0abcd + 10) + 55) + (98 * -(82))) + v14abc);
+int v18abc = p1abcd;
+int v19abc = 70;
+fio::println(v14abc);
+}
+int v20abc = ((((v10abc >= 36) > (56 * p1abcd)) == v14abc) != p0abcd);
+int v21abc = (((95 + 62) + 2) * ((v20abc + (p1abcd * 43)) + p1abcd));
+if((((p1abcd / 7) - (p0abcd - 88)) >= ((v14abc * v21abc) < (99 * p0abcd)))){
+v14abc = v21abc;
+v20abc = ((v20abc <= -(v21abc)) || ((p0abcd + 76) * 15));
+int v22abc = (v10abc && p1abcd);
+int v23abc = ((10 - (v10abc - v20abc)) - (34 / 2));
+}
+} else {
+int v24abc = 0;
+fio::println(v24abc);
+if(((((88 / 1) * v10abc) + p1abcd) <= p1abcd)){
+int v25abc = 26;
+v25abc = (v24abc + !(2));
+int v26abc = ((v10abc <= p1abcd) || ((v25abc - p0abcd) && (p1abcd + 87)));
+int v27abc = 80;
+int v28abc = (77 == ((p1abcd + 68) <= (v26abc + v26abc)));
+int v29abc = 42;
+} else {
+v24abc = 77;
+int v30abc = (v10abc / 4);
+int v31abc = (((v30abc >= p0abcd) || p1abcd) || (70 + ((-(58) * 40) - 24)));
+int v32abc = ((v24abc - (v30abc >= 64)) + 72);
+}
+int v33abc = (p0abcd * ((41 / 1) != (p1abcd < p1abcd)));
+for(int i34abc = 0; i34abc < 1; i34abc++){
+int v35abc = v24abc;
+fio::println(p1abcd);
+int v36abc = v33abc;
+int v37abc = (v35abc * (v33abc / 1));
+v36abc = v37abc;
+fio::println(v10abc);
+};
+for(int i38abc = 0;(i38abc < 2);i38abc++){
+int v39abc = (i38abc - 12);
+fio::println(p0abcd);
+int v40abc = v24abc;
+}
+}
+p1abcd = (((!((p0abcd * v10abc)) + 66) <= p0abcd) && (39 - p0abcd));
+} else {
+if(((!(p0abcd) >= !(p1abcd)) && 8)){
+int v41abc = (87 * p0abcd);
+} else {
+int v42abc = (76 + p1abcd);
+if(((28 - (49 / 4)) != (60 - (v42abc * 93)))){
+int v43abc = (p1abcd != ((52 - p0abcd) <= p1abcd));
+int v44abc = ((((77 - (v42abc / 3)) - 8) > (71 * 99)) != 24);
+p0abcd = ((-((12 * 0)) < (p0abcd + 10)) && -(v44abc));
+}
+fio::println(p0abcd);
+}
+fio::println(p0abcd);
+if(((66 <= 78) != p1abcd)){
+for(int i45abc = 0;(i45abc < 1);i45abc++){
+int v46abc = p0abcd;
+int v47abc = (((-(35) + 63) - 58) == (i45abc + v46abc));
+int v48abc = i45abc;
+}
+for(int i49abc = 0;(i49abc < 3);i49abc++){
+fio::println(p1abcd);
+int v50abc = ((i49abc + p0abcd) == (3 / 2));
+fio::println(v50abc);
+int v51abc = (p1abcd >= (i49abc / 8));
+}
+p1abcd = (((92 / 4) || (p0abcd * 93)) / 1);
+int v52abc = (p1abcd / 5);
+} else {
+int v53abc = (((p0abcd / 4) < (p1abcd * p0abcd)) < (p1abcd - 98));
+int v54abc = ((((97 - p1abcd) + p1abcd) + 46) - (p0abcd != p1abcd));
+}
+int v55abc = ((55 - (54 / 8)) - (-(67) * p0abcd));
+}
+fio::println(p0abcd);
+return ((((p0abcd + p1abcd) - (p1abcd * 5)) + ((p1abcd * 42) * p1abcd)) - 54);
+}
+
+int f3abcd(int p0abcd){
+if(((p0abcd != (10 + 95)) == 29)){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int c1abcd = 2;
+while((c1abcd > 0)){
+int v2abcd = (((p0abcd + 78) - p0abcd) + 54);
+fio::println(v2abcd);
+c1abcd = (c1abcd - 1);
+}
+int v3abcd = ((((((c1abcd >= 95) && (44 + 87)) + 27) + p0abcd) + c1abcd) + i0abcd);
+int c4abcd = 4;
+while((c4abcd > 0)){
+v3abcd = v3abcd;
+int v5abcd = ((!(-(24)) - ((4 / 3) * c1abcd)) + i0abcd);
+int v6abcd = (v3abcd * i0abcd);
+v6abcd = (c1abcd - p0abcd);
+fio::println(c4abcd);
+c4abcd = (c4abcd - 1);
+}
+v3abcd = (c1abcd || ((c4abcd && i0abcd) == (-(44) / 6)));
+};
+}
+int v7abcd = ((p0abcd * 16) + (p0abcd * 59));
+int v8abcd = ((76 + 87) - p0abcd);
+return -(v7abcd);
+}
+
+int f4abcd(int p0abcd,int p1abcd){
+int v0abcd = (((9 * 29) - p1abcd) + (4 / 4));
+for(int i1abcd = 0;(i1abcd < 2);i1abcd++){
+int v2abcd = p1abcd;
+int c3abcd = 2;
+while((c3abcd > 0)){
+if((((!(52) * 72) * i1abcd) == ((97 * c3abcd) || v0abcd))){
+fio::println(v2abcd);
+fio::println(c3abcd);
+int v4abcd = 90;
+fio::println(v4abcd);
+}
+int c5abcd = 1;
+while((c5abcd > 0)){
+p0abcd = ((((c5abcd / 9) - c3abcd) - 37) - 89);
+c5abcd = (c5abcd - 1);
+}
+int v6abcd = (86 > 28);
+c3abcd = (c3abcd - 1);
+}
+fio::println(v0abcd);
+int v7abcd = (((v2abcd * i1abcd) >= 28) + (p1abcd == (65 / 3)));
+int c8abcd = 2;
+while((c8abcd > 0)){
+for(int i9abcd = 0; i9abcd < 4; i9abcd++){
+int v10abc = c8abcd;
+int v11abc = (v2abcd != (66 - (v10abc >= 15)));
+fio::println(i9abcd);
+fio::println(i9abcd);
+v7abcd = 72;
+fio::println(v0abcd);
+};
+int v12abc = 16;
+int v13abc = ((((p1abcd * p0abcd) > (v7abcd * v2abcd)) > 27) >= i1abcd);
+c8abcd = (c8abcd - 1);
+}
+}
+int v14abc = (((p0abcd && 60) + p0abcd) + 10);
+return (((p0abcd + (0 * 5)) - p1abcd) != (79 + 15));
+}
+
+int f5abcd(int p0abcd,int p1abcd){
+int v0abcd = 31;
+int v1abcd = 6;
+return (((p1abcd + 9) / 8) + 70);
+}
+
+int f6abcd(int p0abcd,int p1abcd){
+int c0abcd = 4;
+while((c0abcd > 0)){
+for(int i1abcd = 0;(i1abcd < 3);i1abcd++){
+int v2abcd = !(((14 && (c0abcd <= 22)) || i1abcd));
+int v3abcd = ((40 + 24) + ((31 + p0abcd) / 2));
+int v4abcd = 15;
+for(int i5abcd = 0;(i5abcd < 4);i5abcd++){
+int v6abcd = (((64 <= p0abcd) || (11 - i5abcd)) * 9);
+v4abcd = v4abcd;
+fio::println(v6abcd);
+p1abcd = (((p1abcd < 14) - (i1abcd || v3abcd)) > (86 || (92 / 2)));
+}
+for(int i7abcd = 0;(i7abcd < 3);i7abcd++){
+int v8abcd = c0abcd;
+p1abcd = i1abcd;
+}
+}
+c0abcd = (c0abcd - 1);
+}
+int v9abcd = ((43 * p1abcd) && ((p0abcd + 9) < (71 / 2)));
+fio::println(c0abcd);
+int v10abc = (p1abcd - ((v9abcd + p0abcd) / 6));
+return ((((92 < p0abcd) < (21 + 44)) && v10abc) || (p1abcd + (5 - c0abcd)));
+}
+
+int f7abcd(){
+int v0abcd = (17 + ((42 < 40) / 5));
+int v1abcd = 86;
+int v2abcd = ((69 <= 32) == (v1abcd / 6));
+int v3abcd = v0abcd;
+v0abcd = -(!((v0abcd / 2)));
+for(int i4abcd = 0; i4abcd < 1; i4abcd++){
+for(int i5abcd = 0;(i5abcd < 3);i5abcd++){
+int v6abcd = i4abcd;
+v3abcd = (v2abcd || (82 / 5));
+fio::println(v1abcd);
+int v7abcd = v2abcd;
+for(int i8abcd = 0;(i8abcd < 4);i8abcd++){
+int v9abcd = 77;
+}
+for(int i10abc = 0;(i10abc < 2);i10abc++){
+v1abcd = i10abc;
+fio::println(v6abcd);
+}
+}
+int v11abc = 58;
+if((((54 - v2abcd) - 24) == v3abcd)){
+int c12abc = 1;
+while((c12abc > 0)){
+int v13abc = ((!(v0abcd) + (70 * v2abcd)) - ((c12abc >= v1abcd) / 4));
+int v14abc = (i4abcd * (94 + v2abcd));
+int v15abc = 35;
+int v16abc = (v13abc + 2);
+c12abc = (c12abc - 1);
+}
+v0abcd = v1abcd;
+for(int i17abc = 0; i17abc < 2; i17abc++){
+int v18abc = (i17abc && (v2abcd == ((i4abcd - v1abcd) >= c12abc)));
+v18abc = ((i4abcd + 91) - (v11abc <= v11abc));
+int v19abc = (((i17abc - v1abcd) + i4abcd) - v3abcd);
+int v20abc = 88;
+};
+int c21abc = 1;
+while((c21abc > 0)){
+fio::println(v3abcd);
+fio::println(v2abcd);
+int v22abc = v11abc;
+int v23abc = (i4abcd != ((c12abc - v11abc) < (63 / 4)));
+c21abc = (c21abc - 1);
+}
+}
+};
+return (v2abcd + (v3abcd * v2abcd));
+}
+
+int f8abcd(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+if(((p1abcd > (7 + 48)) >= p0abcd)){
+for(int i1abcd = 0;(i1abcd < 2);i1abcd++){
+int v2abcd = (-(i1abcd) < -((i1abcd / 6)));
+int v3abcd = (((p0abcd - 28) - p2abcd) > 47);
+int v4abcd = i1abcd;
+fio::println(p2abcd);
+}
+} else {
+fio::println(p2abcd);
+int v5abcd = (62 || ((p1abcd + (i0abcd * 93)) - p0abcd));
+for(int i6abcd = 0;(i6abcd < 2);i6abcd++){
+p1abcd = (i6abcd / 5);
+fio::println(i6abcd);
+int v7abcd = !(((36 <= i0abcd) || (p1abcd * 7)));
+fio::println(v7abcd);
+int v8abcd = (p2abcd + ((p1abcd / 7) / 6));
+int v9abcd = (91 - ((i6abcd - i0abcd) - v8abcd));
+}
+}
+int v10abc = ((p1abcd + !(p1abcd)) > (p1abcd * 71));
+int c11abc = 1;
+while((c11abc > 0)){
+int v12abc = !(((-(18) + 88) >= p1abcd));
+fio::println(v10abc);
+if((((c11abc * v10abc) * v12abc) < ((v12abc <= 53) - 48))){
+int v13abc = 15;
+fio::println(v13abc);
+} else {
+int v14abc = (((v12abc - (p1abcd / 3)) >= -(67)) && (27 && 32));
+int v15abc = ((v12abc < (v14abc <= 0)) || v14abc);
+int v16abc = (((p0abcd - 97) - 66) - v10abc);
+}
+int v17abc = i0abcd;
+fio::println(p2abcd);
+c11abc = (c11abc - 1);
+}
+p1abcd = ((p0abcd != (((c11abc * 56) - 60) >= (p1abcd * 85))) && p1abcd);
+for(int i18abc = 0;(i18abc < 2);i18abc++){
+int v19abc = (c11abc < i0abcd);
+}
+int v20abc = (83 || ((c11abc + 0) * (v10abc < (51 + 8))));
+};
+return (p1abcd + p0abcd);
+}
+
+int f9abcd(int p0abcd,int p1abcd){
+int c0abcd = 3;
+while((c0abcd > 0)){
+if(((49 * p0abcd) >= c0abcd)){
+int c1abcd = 1;
+while((c1abcd > 0)){
+int v2abcd = ((86 || 52) == ((p0abcd + 64) - ((77 * 45) / 1)));
+int v3abcd = ((93 <= ((p1abcd + v2abcd) - p0abcd)) && (v2abcd + (c1abcd / 4)));
+c1abcd = (c1abcd - 1);
+}
+if((89 != (44 - c0abcd))){
+int v4abcd = ((7 >= (28 - (61 / 9))) != ((-(p0abcd) * p0abcd) / 9));
+}
+int v5abcd = ((((82 * 66) + p1abcd) < c0abcd) >= c0abcd);
+}
+c0abcd = (c0abcd - 1);
+}
+return 19;
+}
+
+int solve(int p0abcd){
+int v0abcd = 65;
+int c1abcd = 1;
+while((c1abcd > 0)){
+int c2abcd = 3;
+while((c2abcd > 0)){
+int v3abcd = ((-((81 + p0abcd)) - !(c1abcd)) >= (c2abcd + 76));
+if((69 <= v3abcd)){
+p0abcd = 12;
+p0abcd = (-(v3abcd) && (v3abcd / 4));
+int v4abcd = !((53 * -(c2abcd)));
+}
+int c5abcd = 4;
+while((c5abcd > 0)){
+int v6abcd = ((!((p0abcd + c2abcd)) * (80 < 9)) || 77);
+int v7abcd = (55 && ((c5abcd - 99) + ((v6abcd / 4) <= (c1abcd + 44))));
+fio::println(c5abcd);
+int v8abcd = c1abcd;
+int v9abcd = ((45 * v7abcd) <= ((v8abcd * 64) - (v8abcd / 1)));
+int v10abc = ((v7abcd == c1abcd) || (!(c2abcd) + 98));
+c5abcd = (c5abcd - 1);
+}
+if((27 >= (v0abcd + 55))){
+v0abcd = (((v3abcd * v3abcd) - p0abcd) * 28);
+p0abcd = (32 || ((v3abcd * c2abcd) - (18 || (v3abcd > (v3abcd + v0abcd)))));
+} else {
+fio::println(c5abcd);
+int v11abc = p0abcd;
+int v12abc = ((c5abcd || v0abcd) || ((12 + v0abcd) > (0 * c1abcd)));
+}
+c2abcd = (c2abcd - 1);
+}
+int v13abc = 83;
+int v14abc = ((((71 + (p0abcd * 58)) <= 70) < p0abcd) > c2abcd);
+for(int i15abc = 0;(i15abc < 3);i15abc++){
+for(int i16abc = 0; i16abc < 1; i16abc++){
+p0abcd = i15abc;
+int v17abc = 14;
+};
+int c18abc = 4;
+while((c18abc > 0)){
+fio::println(p0abcd);
+c18abc = (c18abc - 1);
+}
+int v19abc = v14abc;
+int c20abc = 1;
+while((c20abc > 0)){
+fio::println(c1abcd);
+int v21abc = (((((65 && i15abc) + (p0abcd / 7)) + !(36)) + 68) - c1abcd);
+int v22abc = (35 || ((85 + v19abc) <= 93));
+c20abc = (c20abc - 1);
+}
+int v23abc = (((61 > 57) != i15abc) || (v0abcd - (62 * v19abc)));
+fio::println(v14abc);
+}
+int v24abc = (((78 - 98) - c2abcd) <= (v14abc * v14abc));
+int c25abc = 4;
+while((c25abc > 0)){
+if((p0abcd == (((v13abc - 64) - 3) + 98))){
+v14abc = (93 >= !((v24abc || 62)));
+int v26abc = !(43);
+int v27abc = !(((v24abc + p0abcd) == v0abcd));
+int v28abc = ((v24abc - p0abcd) - (69 * v24abc));
+int v29abc = ((19 + 48) || ((c1abcd - 77) > 13));
+} else {
+int v30abc = (c2abcd < ((p0abcd + v14abc) - (47 > c1abcd)));
+v0abcd = (((((c2abcd / 6) - v0abcd) != v0abcd) - (87 * v30abc)) && (v13abc != 71));
+int v31abc = v14abc;
+}
+for(int i32abc = 0;(i32abc < 2);i32abc++){
+int v33abc = (((8 * v13abc) - 58) * ((v24abc + v24abc) != c1abcd));
+int v34abc = (((i32abc * v13abc) / 2) == ((v0abcd - i32abc) > v24abc));
+int v35abc = (v34abc + v14abc);
+int v36abc = -(p0abcd);
+}
+int v37abc = (6 != ((90 - c1abcd) * -((52 + p0abcd))));
+int v38abc = ((54 - (c1abcd * c1abcd)) / 2);
+int v39abc = (v14abc != ((v14abc + 27) >= 33));
+c25abc = (c25abc - 1);
+}
+c1abcd = (c1abcd - 1);
+}
+if((((c1abcd && 6) <= (p0abcd + 48)) > v0abcd)){
+if((p0abcd != c1abcd)){
+if((p0abcd < ((69 * c1abcd) * p0abcd))){
+int v40abc = !((v0abcd && (74 / 7)));
+v40abc = ((27 && (71 + (58 || 61))) + ((v0abcd * 56) - (49 / 8)));
+int v41abc = v0abcd;
+int v42abc = ((v0abcd / 5) <= ((v40abc < p0abcd) * (92 >= (v41abc / 8))));
+int v43abc = (-((v41abc * v40abc)) <= 54);
+} else {
+int v44abc = ((((v0abcd || 51) && v0abcd) * (78 * 84)) > (p0abcd + c1abcd));
+}
+int v45abc = (((39 - c1abcd) >= v0abcd) > ((3 <= 14) < 39));
+int v46abc = v45abc;
+int v47abc = (((87 / 2) + (v46abc / 5)) + (-(v45abc) + (8 / 2)));
+if(((p0abcd < p0abcd) >= (27 * v46abc))){
+int v48abc = 47;
+} else {
+int v49abc = v45abc;
+fio::println(v45abc);
+int v50abc = (v47abc >= 31);
+int v51abc = (((v50abc <= (((v49abc - v0abcd) - 50) - (39 * v49abc))) != 93) || v47abc);
+fio::println(v49abc);
+int v52abc = v0abcd;
+}
+} else {
+int c53abc = 4;
+while((c53abc > 0)){
+int v54abc = c1abcd;
+v54abc = ((((55 - c1abcd) - 58) - -(46)) == (14 * 97));
+int v55abc = (((((p0abcd - c1abcd) / 3) + 98) + v54abc) - (44 * v0abcd));
+c53abc = (c53abc - 1);
+}
+for(int i56abc = 0;(i56abc < 1);i56abc++){
+fio::println(p0abcd);
+int v57abc = (((83 * i56abc) * c1abcd) / 6);
+}
+}
+int v58abc = 77;
+fio::println(c1abcd);
+p0abcd = (c1abcd <= ((44 / 2) + 84));
+v58abc = ((v0abcd - (v0abcd * p0abcd)) - (-(v0abcd) * (c1abcd - 11)));
+int v59abc = ((v0abcd - 33) <= (v0abcd + 27));
+}
+fio::println(v0abcd);
+return (65 * 73);
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
@@ -0,0 +1,612 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 4; i0abcd++){
+int c1abcd = 1;
+while((c1abcd > 0)){
+int v2abcd = ((74 != (p1abcd / 9)) != -(16));
+fio::println(i0abcd);
+int v3abcd = (v2abcd / 7);
+int v4abcd = (p1abcd && (((76 + 19) + 0) < 9));
+int v5abcd = ((((!(7) * 67) + (92 + c1abcd)) >= v3abcd) <= p1abcd);
+int v6abcd = (47 * 42);
+c1abcd = (c1abcd - 1);
+}
+int v7abcd = i0abcd;
+for(int i8abcd = 0;(i8abcd < 4);i8abcd++){
+int c9abcd = 1;
+while((c9abcd > 0)){
+int v10abc = (p0abcd + (52 == ((c9abcd * 66) / 8)));
+fio::println(i8abcd);
+int v11abc = (((52 / 9) && 17) + v10abc);
+fio::println(i0abcd);
+c9abcd = (c9abcd - 1);
+}
+int v12abc = (p0abcd && (c9abcd != (25 / 9)));
+int v13abc = (((i0abcd * c9abcd) - c9abcd) < (c9abcd - (60 || (v12abc * 57))));
+int v14abc = ((p0abcd - (v12abc / 8)) || 95);
+}
+p2abcd = 96;
+int v15abc = (((i0abcd * p2abcd) - p2abcd) / 6);
+};
+int c16abc = 1;
+while((c16abc > 0)){
+if((p2abcd <= (p1abcd - (p0abcd * !(11))))){
+if((95 >= ((c16abc - 36) + (p2abcd - 90)))){
+int v17abc = (p0abcd / 9);
+v17abc = ((55 - (p2abcd * p2abcd)) + 90);
+} else {
+p0abcd = p0abcd;
+p2abcd = ((38 + 54) <= (p0abcd + c16abc));
+fio::println(p2abcd);
+fio::println(c16abc);
+}
+int c18abc = 2;
+while((c18abc > 0)){
+fio::println(p2abcd);
+int v19abc = !(c16abc);
+int v20abc = -(c16abc);
+int v21abc = (((v20abc * c18abc) != (c18abc * p0abcd)) - !((p0abcd * v20abc)));
+int v22abc = (v19abc <= ((v19abc + p1abcd) + (p0abcd / 5)));
+int v23abc = 79;
+c18abc = (c18abc - 1);
+}
+fio::println(c18abc);
+p0abcd = ((9 > 62) <= (c18abc - (62 / 7)));
+}
+int v24abc = (88 + (p1abcd * p1abcd));
+c16abc = (c16abc - 1);
+}
+return (p0abcd && (((p0abcd - 67) + p1abcd) != (p2abcd + (29 * p2abcd))));
+}
+
+int f1abcd(int p0abcd,int p1abcd,int p2abcd){
+if((((p2abcd + 60) == (p0abcd * p2abcd)) <= 96)){
+for(int i0abcd = 0;(i0abcd < 1);i0abcd++){
+fio::println(i0abcd);
+fio::println(i0abcd);
+for(int i1abcd = 0; i1abcd < 2; i1abcd++){
+int v2abcd = !((38 > (p1abcd + 59)));
+p1abcd = ((45 + 84) || (17 > (p2abcd * -(i1abcd))));
+};
+if((((p1abcd >= p0abcd) <= p2abcd) == (34 - (9 / 2)))){
+p1abcd = p0abcd;
+fio::println(p0abcd);
+fio::println(p1abcd);
+int v3abcd = (15 / 8);
+v3abcd = ((p2abcd * v3abcd) != ((p0abcd * 74) / 9));
+fio::println(p1abcd);
+} else {
+int v4abcd = (89 >= ((55 * i0abcd) + 52));
+fio::println(p0abcd);
+}
+}
+for(int i5abcd = 0;(i5abcd < 2);i5abcd++){
+int v6abcd = ((((24 || 75) * (61 * p1abcd)) * (p2abcd * 2)) || 55);
+int v7abcd = ((((59 * p0abcd) + p1abcd) - 84) != (12 == 22));
+int v8abcd = 78;
+for(int i9abcd = 0;(i9abcd < 2);i9abcd++){
+int v10abc = !(((11 * i5abcd) - v8abcd));
+int v11abc = ((v7abcd == v10abc) - (-(97) * 24));
+fio::println(p0abcd);
+int v12abc = ((v10abc * 38) > (p2abcd - 52));
+int v13abc = (!(v11abc) || (-(3) + ((98 + p1abcd) || (p1abcd + v10abc))));
+fio::println(i9abcd);
+}
+for(int i14abc = 0; i14abc < 3; i14abc++){
+int v15abc = (((p0abcd + 38) * 13) * (((p1abcd / 6) + v6abcd) == p1abcd));
+};
+p1abcd = ((v6abcd - v7abcd) || (p0abcd / 5));
+}
+int v16abc = -(-((p0abcd / 5)));
+int v17abc = -((v16abc - (1 / 8)));
+for(int i18abc = 0;(i18abc < 1);i18abc++){
+for(int i19abc = 0;(i19abc < 4);i19abc++){
+int v20abc = v17abc;
+int v21abc = ((i18abc + v16abc) - 52);
+}
+for(int i22abc = 0;(i22abc < 1);i22abc++){
+fio::println(v17abc);
+fio::println(i22abc);
+int v23abc = (((v16abc / 1) >= (v16abc / 1)) >= i22abc);
+fio::println(p0abcd);
+int v24abc = ((p1abcd * (22 * v17abc)) && !((90 + i18abc)));
+p2abcd = (((i22abc / 7) <= (46 + i22abc)) != ((35 - 51) + v16abc));
+}
+fio::println(p0abcd);
+if(((i18abc <= p0abcd) >= i18abc)){
+int v25abc = ((p1abcd >= (72 - !(98))) / 8);
+p1abcd = (!((p1abcd / 1)) / 9);
+int v26abc = 57;
+int v27abc = v16abc;
+int v28abc = 33;
+fio::println(i18abc);
+} else {
+fio::println(v16abc);
+fio::println(v16abc);
+int v29abc = 42;
+int v30abc = v29abc;
+int v31abc = (((v30abc + v16abc) >= (85 != 72)) >= 42);
+}
+int v32abc = ((((23 - v16abc) * 64) - 66) != p0abcd);
+int v33abc = (((v32abc * v17abc) || (p0abcd == v17abc)) + 49);
+}
+int v34abc = (((7 + v16abc) * v16abc) / 6);
+}
+return 0;
+}
+
+int f2abcd(int p0abcd,int p1abcd){
+int v0abcd = (!((42 + p0abcd)) > ((p1abcd - p1abcd) - p0abcd));
+int v1abcd = ((v0abcd + v0abcd) <= ((v0abcd + p0abcd) + (p0abcd > (v0abcd * p0abcd))));
+fio::println(p0abcd);
+return 85;
+}
+
+int f3abcd(int p0abcd,int p1abcd,int p2abcd){
+fio::println(p0abcd);
+for(int i0abcd = 0; i0abcd < 3; i0abcd++){
+if(((53 - (85 + 4)) <= ((p0abcd / 6) / 4))){
+for(int i1abcd = 0; i1abcd < 3; i1abcd++){
+int v2abcd = (23 + ((p2abcd / 1) - p2abcd));
+int v3abcd = 21;
+int v4abcd = !((v2abcd < (54 * i0abcd)));
+};
+}
+fio::println(p0abcd);
+p1abcd = i0abcd;
+for(int i5abcd = 0;(i5abcd < 4);i5abcd++){
+for(int i6abcd = 0;(i6abcd < 2);i6abcd++){
+int v7abcd = (60 && i6abcd);
+int v8abcd = i5abcd;
+int v9abcd = 41;
+p2abcd = (-((72 < p2abcd)) || ((p2abcd * 39) - p1abcd));
+int v10abc = !(p1abcd);
+}
+p1abcd = i0abcd;
+p0abcd = ((i0abcd / 9) / 8);
+}
+int v11abc = (((16 * 9) - (p1abcd * -(p2abcd))) && (65 - i0abcd));
+};
+for(int i12abc = 0;(i12abc < 4);i12abc++){
+for(int i13abc = 0;(i13abc < 1);i13abc++){
+int v14abc = (((p0abcd + i12abc) > i12abc) || (i13abc + (28 && 85)));
+}
+}
+int v15abc = ((((p1abcd / 4) * p0abcd) != 70) != !((p1abcd + 40)));
+for(int i16abc = 0;(i16abc < 1);i16abc++){
+fio::println(p0abcd);
+int v17abc = p1abcd;
+}
+return ((((p2abcd * p1abcd) * 52) != 26) + (p2abcd * (p2abcd + p2abcd)));
+}
+
+int f4abcd(int p0abcd,int p1abcd){
+for(int i0abcd = 0;(i0abcd < 4);i0abcd++){
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+p0abcd = (!((12 >= i1abcd)) - ((i0abcd - i1abcd) == 74));
+};
+int v2abcd = p0abcd;
+fio::println(p0abcd);
+int c3abcd = 1;
+while((c3abcd > 0)){
+int c4abcd = 4;
+while((c4abcd > 0)){
+int v5abcd = (((c3abcd && 91) || (p0abcd + v2abcd)) || c3abcd);
+v5abcd = 42;
+int v6abcd = (i0abcd && ((39 != 28) != (c3abcd * p1abcd)));
+v5abcd = -(c3abcd);
+int v7abcd = (c3abcd < (((p0abcd - 24) * 63) / 2));
+c4abcd = (c4abcd - 1);
+}
+int v8abcd = ((((64 * 67) + (41 * 26)) - 42) != ((i0abcd * 45) / 1));
+if((-((c4abcd + 19)) > ((60 * v8abcd) >= 46))){
+p0abcd = (((v8abcd / 2) + (89 - p0abcd)) > ((p1abcd >= c4abcd) + !(p1abcd)));
+p1abcd = p0abcd;
+int v9abcd = (-((80 != 21)) - (((v8abcd - v2abcd) + 12) + 46));
+int v10abc = ((96 - (p0abcd * 84)) || (c3abcd + 6));
+}
+if((p1abcd >= -(p0abcd))){
+int v11abc = (i0abcd || ((v8abcd - -(72)) - 32));
+int v12abc = (p0abcd && ((13 * 38) + ((68 + p0abcd) / 1)));
+int v13abc = ((c3abcd - v2abcd) != (85 - c3abcd));
+int v14abc = (v13abc * (i0abcd || (8 + (c4abcd / 6))));
+fio::println(v13abc);
+int v15abc = (-((37 * 68)) + v2abcd);
+} else {
+fio::println(p1abcd);
+int v16abc = ((c3abcd - (v8abcd * 91)) - v2abcd);
+fio::println(v8abcd);
+int v17abc = ((((v2abcd + 85) + ((c3abcd / 9) * p0abcd)) || 87) || 44);
+int v18abc = (1 || ((i0abcd && 95) && v16abc));
+}
+c3abcd = (c3abcd - 1);
+}
+int v19abc = 12;
+fio::println(c3abcd);
+}
+p0abcd = (37 / 7);
+int v20abc = 22;
+return ((((v20abc / 9) * 41) * 10) * -((p0abcd / 5)));
+}
+
+int f5abcd(int p0abcd){
+if((!(-(p0abcd)) >= p0abcd)){
+p0abcd = ((!(p0abcd) || (89 + p0abcd)) / 4);
+} else {
+int v0abcd = !(p0abcd);
+for(int i1abcd = 0;(i1abcd < 2);i1abcd++){
+for(int i2abcd = 0; i2abcd < 4; i2abcd++){
+int v3abcd = !(((i2abcd - v0abcd) - i2abcd));
+int v4abcd = (v0abcd - p0abcd);
+int v5abcd = (i2abcd / 8);
+int v6abcd = ((v5abcd < (94 + v4abcd)) || ((v3abcd * 91) - v5abcd));
+};
+}
+}
+fio::println(p0abcd);
+int v7abcd = (((55 - p0abcd) + p0abcd) - ((p0abcd - 87) == p0abcd));
+return (p0abcd < ((97 - 72) * v7abcd));
+}
+
+int f6abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = ((24 * p0abcd) - 40);
+int v1abcd = p1abcd;
+return p2abcd;
+}
+
+int f7abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = ((((p1abcd != p2abcd) / 4) * 72) - p0abcd);
+for(int i1abcd = 0;(i1abcd < 3);i1abcd++){
+int v2abcd = (((p0abcd > (p2abcd / 5)) * v0abcd) || (v0abcd - (6 + v0abcd)));
+for(int i3abcd = 0;(i3abcd < 1);i3abcd++){
+int v4abcd = (((p0abcd - p1abcd) == i1abcd) != (i1abcd - p2abcd));
+}
+}
+return p2abcd;
+}
+
+int f8abcd(){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+int v1abcd = i0abcd;
+};
+for(int i2abcd = 0; i2abcd < 1; i2abcd++){
+for(int i3abcd = 0;(i3abcd < 3);i3abcd++){
+for(int i4abcd = 0;(i4abcd < 2);i4abcd++){
+fio::println(i3abcd);
+}
+}
+};
+if((((((72 - 17) + 12) != 13) == 24) && (98 + 37))){
+for(int i5abcd = 0; i5abcd < 2; i5abcd++){
+int v6abcd = (-((16 && i5abcd)) / 3);
+v6abcd = 96;
+};
+int v7abcd = (((59 + (60 / 8)) * 39) != 59);
+int v8abcd = !(((98 + 6) * v7abcd));
+for(int i9abcd = 0; i9abcd < 4; i9abcd++){
+int v10abc = -(-(39));
+};
+int v11abc = (((93 || v8abcd) / 2) || ((44 * v7abcd) - (v7abcd * v7abcd)));
+} else {
+int v12abc = ((43 == (32 + 87)) || (61 >= 11));
+}
+int v13abc = (((4 * 63) * 42) + (89 * !((1 || 26))));
+int v14abc = ((((v13abc * 28) / 6) - 65) + (v13abc * 48));
+int v15abc = v14abc;
+return -(((63 || 97) || (38 * 17)));
+}
+
+int f9abcd(int p0abcd){
+int v0abcd = ((p0abcd - p0abcd) - 39);
+int v1abcd = (((p0abcd || (v0abcd - p0abcd)) || v0abcd) < p0abcd);
+if((65 >= v1abcd)){
+if(((((16 != 84) > 21) == 45) == ((44 - v1abcd) >= v1abcd))){
+int v2abcd = 11;
+int c3abcd = 2;
+while((c3abcd > 0)){
+v0abcd = 24;
+int v4abcd = (v0abcd <= v0abcd);
+int v5abcd = (((70 - (v1abcd / 3)) - 13) < v0abcd);
+c3abcd = (c3abcd - 1);
+}
+for(int i6abcd = 0; i6abcd < 2; i6abcd++){
+fio::println(v2abcd);
+int v7abcd = 26;
+int v8abcd = v1abcd;
+int v9abcd = !(22);
+fio::println(v2abcd);
+int v10abc = ((3 <= 98) - i6abcd);
+};
+p0abcd = ((c3abcd <= (89 + 89)) == (v0abcd + (10 * v2abcd)));
+v0abcd = v0abcd;
+} else {
+int v11abc = ((p0abcd - p0abcd) != (((17 * v1abcd) * 81) / 9));
+int v12abc = (((83 - v0abcd) + ((v1abcd * v0abcd) * v1abcd)) - ((v11abc * p0abcd) * 70));
+v12abc = (42 || ((40 * v1abcd) == (((v0abcd * 69) - 94) <= v12abc)));
+for(int i13abc = 0;(i13abc < 4);i13abc++){
+int v14abc = (!((84 - 19)) == (v12abc - i13abc));
+fio::println(v14abc);
+int v15abc = (18 + 79);
+v0abcd = v0abcd;
+int v16abc = (45 - v1abcd);
+fio::println(v16abc);
+}
+}
+int v17abc = ((((70 < (v1abcd * 35)) - v1abcd) - 7) + (v1abcd - p0abcd));
+int c18abc = 4;
+while((c18abc > 0)){
+int c19abc = 3;
+while((c19abc > 0)){
+int v20abc = (!(v0abcd) * 81);
+c19abc = (c19abc - 1);
+}
+int c21abc = 4;
+while((c21abc > 0)){
+int v22abc = (((v1abcd + 34) - 57) < 82);
+p0abcd = (!((c19abc < p0abcd)) * c21abc);
+c21abc = (c21abc - 1);
+}
+int v23abc = v17abc;
+int v24abc = (v1abcd / 1);
+int v25abc = ((91 != c21abc) <= (v1abcd + (16 / 9)));
+c18abc = (c18abc - 1);
+}
+}
+if(((37 && p0abcd) > ((v0abcd / 6) * v1abcd))){
+fio::println(p0abcd);
+for(int i26abc = 0; i26abc < 4; i26abc++){
+for(int i27abc = 0; i27abc < 3; i27abc++){
+int v28abc = v0abcd;
+};
+};
+p0abcd = ((((82 + 93) + (58 && 65)) - (p0abcd + 25)) - p0abcd);
+if((((p0abcd + 43) <= (49 || v0abcd)) > (p0abcd + (50 * v1abcd)))){
+p0abcd = p0abcd;
+int v29abc = !((v0abcd >= ((v0abcd - v0abcd) - p0abcd)));
+for(int i30abc = 0; i30abc < 3; i30abc++){
+int v31abc = (((i30abc / 9) / 3) > p0abcd);
+int v32abc = ((41 * v1abcd) && v29abc);
+p0abcd = (v31abc || ((50 - i30abc) >= (v0abcd + v0abcd)));
+};
+} else {
+int v33abc = (((((v0abcd && p0abcd) - 99) + v1abcd) + v1abcd) + 46);
+v0abcd = v0abcd;
+int v34abc = (((v1abcd == v0abcd) && (v1abcd + v33abc)) < v0abcd);
+if((!((v33abc - 18)) >= (31 - 7))){
+fio::println(v1abcd);
+int v35abc = (v33abc > 98);
+fio::println(v35abc);
+v1abcd = v35abc;
+} else {
+int v36abc = (v1abcd / 4);
+p0abcd = (-((v0abcd * v34abc)) / 3);
+int v37abc = (((78 / 6) * 69) * (v0abcd + v36abc));
+int v38abc = ((((86 + v33abc) + 39) + (92 * v37abc)) + (3 / 3));
+int v39abc = (!(!(v0abcd)) == ((!(v37abc) + v0abcd) - v38abc));
+fio::println(v34abc);
+}
+for(int i40abc = 0;(i40abc < 1);i40abc++){
+int v41abc = ((((-(v0abcd) + 69) || v1abcd) + v0abcd) + 12);
+int v42abc = -((v33abc >= (v1abcd - p0abcd)));
+}
+}
+if((p0abcd < ((66 * 66) + p0abcd))){
+int v43abc = p0abcd;
+for(int i44abc = 0;(i44abc < 1);i44abc++){
+v0abcd = (((i44abc * v1abcd) / 1) > 0);
+p0abcd = (((28 * (v0abcd - v0abcd)) - 66) && i44abc);
+int v45abc = ((65 - 82) - (35 * 74));
+int v46abc = i44abc;
+v46abc = 11;
+fio::println(v1abcd);
+}
+for(int i47abc = 0; i47abc < 3; i47abc++){
+int v48abc = (97 >= 58);
+int v49abc = (((((v1abcd || 4) * i47abc) * v1abcd) - v43abc) != (v0abcd == 10));
+v1abcd = ((v48abc - v43abc) && -((i47abc * v48abc)));
+int v50abc = (((v43abc - v48abc) - (p0abcd >= 81)) * v49abc);
+int v51abc = 44;
+};
+int v52abc = v43abc;
+for(int i53abc = 0;(i53abc < 1);i53abc++){
+int v54abc = (((-(39) * v43abc) == p0abcd) && 95);
+fio::println(v0abcd);
+}
+} else {
+v1abcd = (2 * ((p0abcd - 33) && p0abcd));
+int v55abc = (20 == ((p0abcd - (v0abcd + 57)) + (59 >= (p0abcd / 6))));
+int v56abc = (((77 - 10) + 17) - p0abcd);
+for(int i57abc = 0;(i57abc < 2);i57abc++){
+int v58abc = ((p0abcd && (83 > v1abcd)) != i57abc);
+v55abc = ((!(i57abc) <= (v58abc + 62)) || (99 * 91));
+int v59abc = (77 == 60);
+}
+int v60abc = (((25 / 8) || 46) >= (((p0abcd * v56abc) + p0abcd) - 3));
+for(int i61abc = 0;(i61abc < 2);i61abc++){
+int v62abc = (6 - 53);
+v1abcd = (((v0abcd + v56abc) == (v60abc / 4)) != (p0abcd + (3 - i61abc)));
+int v63abc = (v55abc < ((v60abc - v55abc) - ((v55abc * i61abc) - v60abc)));
+p0abcd = (v63abc - ((v55abc > v55abc) / 2));
+v63abc = ((43 - p0abcd) >= ((v63abc * v63abc) + (79 * v56abc)));
+int v64abc = (-(42) * (v63abc + 7));
+}
+}
+for(int i65abc = 0; i65abc < 3; i65abc++){
+if(((14 / 8) && ((89 - i65abc) == -(i65abc)))){
+v0abcd = (((p0abcd * 31) * 43) * ((56 + i65abc) - (0 || 25)));
+int v66abc = (31 + 5);
+int v67abc = (((v0abcd + (v1abcd * 16)) - 49) + i65abc);
+} else {
+int v68abc = ((46 + (v0abcd * (v1abcd / 7))) * !((v0abcd >= v0abcd)));
+v68abc = (((v0abcd + 39) != v0abcd) <= 28);
+int v69abc = v68abc;
+int v70abc = p0abcd;
+int v71abc = ((!((22 - 94)) - (p0abcd * 26)) && !(v68abc));
+int v72abc = v69abc;
+}
+for(int i73abc = 0;(i73abc < 4);i73abc++){
+int v74abc = p0abcd;
+}
+int v75abc = -(-(p0abcd));
+for(int i76abc = 0;(i76abc < 4);i76abc++){
+int v77abc = ((p0abcd == (0 < v1abcd)) || 11);
+int v78abc = i76abc;
+}
+int v79abc = (p0abcd != (41 >= (((97 + (v0abcd - 6)) + v1abcd) + v75abc)));
+fio::println(i65abc);
+};
+} else {
+fio::println(v0abcd);
+fio::println(v0abcd);
+}
+if((((((p0abcd + v1abcd) - (v1abcd <= p0abcd)) > 23) <= 58) < 87)){
+int v80abc = v0abcd;
+int v81abc = (((74 == v1abcd) <= !(v1abcd)) <= (((1 * v80abc) * 30) * 78));
+v80abc = ((47 - (51 && 86)) == (p0abcd >= ((p0abcd * v81abc) * v81abc)));
+fio::println(v81abc);
+for(int i82abc = 0; i82abc < 1; i82abc++){
+int v83abc = ((!(v1abcd) + v81abc) || (v80abc - v81abc));
+int c84abc = 4;
+while((c84abc > 0)){
+int v85abc = 83;
+int v86abc = ((v81abc * 3) >= ((19 + 81) - (v1abcd - (i82abc * (v83abc * 75)))));
+c84abc = (c84abc - 1);
+}
+v80abc = 37;
+for(int i87abc = 0; i87abc < 3; i87abc++){
+fio::println(v1abcd);
+int v88abc = c84abc;
+int v89abc = (((p0abcd * 10) + (v81abc * 61)) + c84abc);
+fio::println(p0abcd);
+v83abc = (26 != ((v83abc + 56) - (i87abc / 8)));
+};
+v81abc = ((v0abcd - ((73 * v81abc) / 3)) <= p0abcd);
+};
+}
+return (((37 + (v0abcd / 3)) + (p0abcd < p0abcd)) + 77);
+}
+
+int solve(int p0abcd){
+int v0abcd = ((p0abcd - 74) != (!(p0abcd) + (((p0abcd - p0abcd) || p0abcd) || p0abcd)));
+for(int i1abcd = 0; i1abcd < 3; i1abcd++){
+for(int i2abcd = 0;(i2abcd < 4);i2abcd++){
+int c3abcd = 3;
+while((c3abcd > 0)){
+int v4abcd = ((i1abcd * 68) - -((i2abcd + v0abcd)));
+int v5abcd = -(i2abcd);
+int v6abcd = (((43 * 38) / 9) - (((i1abcd / 8) + i1abcd) - 29));
+int v7abcd = v5abcd;
+v4abcd = (((v5abcd - 18) / 9) - c3abcd);
+c3abcd = (c3abcd - 1);
+}
+int v8abcd = (-(!(c3abcd)) > ((26 * i2abcd) - c3abcd));
+}
+v0abcd = (i1abcd * p0abcd);
+for(int i9abcd = 0;(i9abcd < 3);i9abcd++){
+int v10abc = ((v0abcd + 91) + (-(i9abcd) <= 81));
+int v11abc = (i9abcd <= (((v10abc * p0abcd) - 20) + i1abcd));
+for(int i12abc = 0;(i12abc < 3);i12abc++){
+int v13abc = (((v10abc - (v11abc + 96)) + 38) <= (v11abc - (60 / 7)));
+int v14abc = (((v13abc + v11abc) < (v13abc + 75)) != !(61));
+int v15abc = (((98 < v11abc) > 79) < (35 + 21));
+fio::println(i1abcd);
+int v16abc = (-(v0abcd) > ((76 + v11abc) + 64));
+}
+int v17abc = ((7 + v11abc) || (i1abcd - v11abc));
+if((19 < 28)){
+p0abcd = ((v17abc + v17abc) <= v10abc);
+} else {
+v10abc = i1abcd;
+int v18abc = ((v0abcd && (p0abcd * i9abcd)) + (v11abc + v11abc));
+int v19abc = ((9 * (16 + 77)) <= (80 / 7));
+v10abc = (17 != ((22 * 45) + (v19abc - v19abc)));
+int v20abc = ((45 / 7) + ((49 / 6) / 5));
+}
+int c21abc = 4;
+while((c21abc > 0)){
+int v22abc = (((v0abcd * 96) || 69) || c21abc);
+int v23abc = ((i1abcd + (v22abc * (v0abcd != p0abcd))) * 74);
+int v24abc = ((65 != (56 + i9abcd)) != (64 >= (!(81) + 27)));
+c21abc = (c21abc - 1);
+}
+}
+for(int i25abc = 0; i25abc < 3; i25abc++){
+p0abcd = (70 && (((i1abcd * p0abcd) + !(79)) + v0abcd));
+fio::println(i25abc);
+int v26abc = 34;
+fio::println(i1abcd);
+fio::println(v26abc);
+p0abcd = ((p0abcd * i25abc) != (i1abcd - (i1abcd != i1abcd)));
+};
+};
+int c27abc = 3;
+while((c27abc > 0)){
+int v28abc = ((c27abc && (82 * c27abc)) || (((c27abc || 17) + 34) < c27abc));
+c27abc = (c27abc - 1);
+}
+int v29abc = (v0abcd != 10);
+return (v29abc / 8);
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int solve(int p0abcd){
+p0abcd = 19;
+p0abcd = 19;
+fio::println(p0abcd);
+int c1abcd = 2;
+while((c1abcd > 0)){
+int v2abcd = ((p0abcd * c1abcd) && (18 + (p0abcd * (p0abcd / 9))));
+fio::println(p0abcd);
+if(1){
+int c3abcd = 2;
+while((c3abcd > 0)){
+c3abcd = (c3abcd - 1);
+}
+int v5abcd = (c1abcd && ((46 - v2abcd) - 0));
+fio::println(p0abcd);
+if(1){
+int v7abcd = 21;
+fio::println(v7abcd);
+v2abcd = (-36 && v2abcd);
+} else {
+p0abcd = 80;
+fio::println(v5abcd);
+}
+}
+c1abcd = (c1abcd - 1);
+}
+for(int i9abcd = 0;(i9abcd < 4);i9abcd++){
+int c11abc = 2;
+while((c11abc > 0)){
+int c12abc = 4;
+while((c12abc > 0)){
+c12abc = (c12abc - 1);
+}
+for(int i14abc = 0; i14abc < 2; i14abc++){
+fio::println(i14abc);
+};
+c11abc = (c11abc - 1);
+}
+int c15abc = 1;
+while((c15abc > 0)){
+int c16abc = 1;
+while((c16abc > 0)){
+fio::println(i9abcd);
+c16abc = (c16abc - 1);
+}
+c15abc = (c15abc - 1);
+}
+}
+return (92 * (!(p0abcd) + (c1abcd * c1abcd)));
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
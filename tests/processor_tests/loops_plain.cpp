@@ -0,0 +1,896 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(int p0abcd,int p1abcd){
+int v0abcd = (((p0abcd * p0abcd) * 56) / 2);
+p1abcd = v0abcd;
+fio::println(p0abcd);
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+if((((p0abcd * 66) - v0abcd) >= (9 * (v0abcd - 64)))){
+int v2abcd = (!((p1abcd + 35)) - p0abcd);
+int v3abcd = (43 + 72);
+int v4abcd = (((v2abcd + p0abcd) == v0abcd) || (v2abcd / 2));
+fio::println(v2abcd);
+if((v3abcd < 11)){
+int v5abcd = v0abcd;
+int v6abcd = (-(46) / 7);
+int v7abcd = v0abcd;
+int v8abcd = ((86 * (10 * 88)) != 31);
+} else {
+int v9abcd = (54 - 41);
+int v10abc = p1abcd;
+int v11abc = (((33 - p0abcd) + (89 * v9abcd)) != (((v0abcd - p0abcd) + v4abcd) + v9abcd));
+}
+for(int i12abc = 0;(i12abc < 2);i12abc++){
+int v13abc = ((((73 * v3abcd) + p1abcd) != p0abcd) || ((v4abcd * v3abcd) != v2abcd));
+int v14abc = (((57 + 30) - i12abc) / 1);
+int v15abc = -((v13abc == ((11 * 11) + v0abcd)));
+int v16abc = i12abc;
+int v17abc = (((v2abcd / 6) + v13abc) || (v4abcd <= v3abcd));
+}
+} else {
+if(((!(p0abcd) + 58) > ((90 * p0abcd) + (i1abcd * 56)))){
+int v18abc = p1abcd;
+int v19abc = !(p0abcd);
+int v20abc = (((i1abcd - 84) <= 53) >= ((1 - 28) + (i1abcd - 49)));
+int v21abc = ((-(v0abcd) * v18abc) + v19abc);
+v18abc = (v21abc >= v20abc);
+fio::println(p0abcd);
+} else {
+int v22abc = (58 / 6);
+fio::println(p0abcd);
+}
+int v23abc = (((p1abcd - 6) + -(p0abcd)) - (v0abcd > (v0abcd / 5)));
+if((((v23abc - 5) <= v23abc) < (!(62) + v0abcd))){
+fio::println(p1abcd);
+int v24abc = ((-((83 + 26)) * (v0abcd - 25)) - (97 * 43));
+}
+int v25abc = (v0abcd - !((v23abc - v0abcd)));
+p1abcd = v0abcd;
+fio::println(p1abcd);
+}
+for(int i26abc = 0;(i26abc < 3);i26abc++){
+if((v0abcd && ((i26abc + -(i1abcd)) < i26abc))){
+int v27abc = (35 / 5);
+int v28abc = ((i26abc + (0 * 52)) == (((90 - p1abcd) - p0abcd) > 72));
+} else {
+int v29abc = 24;
+int v30abc = (((i1abcd <= p1abcd) / 8) / 1);
+}
+fio::println(i26abc);
+v0abcd = i1abcd;
+}
+for(int i31abc = 0;(i31abc < 1);i31abc++){
+for(int i32abc = 0; i32abc < 1; i32abc++){
+int v33abc = ((v0abcd + i31abc) > (i1abcd / 3));
+fio::println(v0abcd);
+fio::println(v0abcd);
+v33abc = 8;
+int v34abc = i1abcd;
+int v35abc = ((i1abcd * 1) && (v34abc * i31abc));
+};
+fio::println(v0abcd);
+for(int i36abc = 0;(i36abc < 1);i36abc++){
+int v37abc = ((v0abcd * !(72)) >= 96);
+fio::println(v0abcd);
+int v38abc = (((21 + p1abcd) / 2) / 1);
+}
+v0abcd = (((i1abcd - 5) >= 93) || (p1abcd != ((i1abcd < 93) / 9)));
+for(int i39abc = 0;(i39abc < 3);i39abc++){
+fio::println(p1abcd);
+}
+for(int i40abc = 0;(i40abc < 1);i40abc++){
+int v41abc = (((p0abcd - 6) * 20) || (31 - 25));
+int v42abc = (i40abc && ((23 / 7) == (13 * (37 / 4))));
+int v43abc = p1abcd;
+int v44abc = i31abc;
+}
+}
+for(int i45abc = 0; i45abc < 1; i45abc++){
+int v46abc = (((i1abcd / 4) * i45abc) - i45abc);
+if((((p1abcd - (v46abc * i45abc)) == p1abcd) < p1abcd)){
+int v47abc = (((53 + i1abcd) - p1abcd) - 72);
+fio::println(p1abcd);
+int v48abc = (!(p0abcd) + ((20 + 26) > p1abcd));
+}
+if(((i1abcd * 24) || (p0abcd > v0abcd))){
+fio::println(i1abcd);
+v0abcd = (-(-(v0abcd)) / 7);
+}
+int v49abc = 53;
+fio::println(v0abcd);
+int v50abc = (((i45abc + p0abcd) + 11) && (i45abc && 86));
+};
+for(int i51abc = 0;(i51abc < 4);i51abc++){
+int c52abc = 2;
+while((c52abc > 0)){
+fio::println(p1abcd);
+int v53abc = (((v0abcd >= (p1abcd * 63)) || (i1abcd + v0abcd)) || v0abcd);
+int v54abc = p1abcd;
+c52abc = (c52abc - 1);
+}
+int v55abc = c52abc;
+for(int i56abc = 0;(i56abc < 2);i56abc++){
+int v57abc = (((72 * i56abc) * -(p0abcd)) || ((i1abcd + 94) <= p1abcd));
+p0abcd = (((c52abc * p1abcd) / 1) || -(88));
+}
+}
+int c58abc = 2;
+while((c58abc > 0)){
+fio::println(p1abcd);
+c58abc = (c58abc - 1);
+}
+}
+fio::println(p0abcd);
+fio::println(p1abcd);
+return (((51 + p0abcd) + v0abcd) + (p1abcd <= (p1abcd + (p0abcd / 3))));
+}
+
+int f1abcd(){
+int v0abcd = (-(27) / 7);
+int v1abcd = ((((57 * v0abcd) * 81) + v0abcd) + v0abcd);
+int v2abcd = v0abcd;
+for(int i3abcd = 0; i3abcd < 3; i3abcd++){
+int v4abcd = (((v1abcd == 30) - v1abcd) + (i3abcd * v0abcd));
+fio::println(v2abcd);
+int v5abcd = (((88 != v4abcd) / 5) >= v2abcd);
+};
+return (v1abcd / 8);
+}
+
+int f2abcd(int p0abcd,int p1abcd){
+for(int i0abcd = 0; i0abcd < 4; i0abcd++){
+int v1abcd = (((((p1abcd + 2) + 10) - (28 * 44)) + p0abcd) != (p0abcd + 18));
+for(int i2abcd = 0;(i2abcd < 2);i2abcd++){
+int c3abcd = 3;
+while((c3abcd > 0)){
+int v4abcd = ((v1abcd - (12 * 27)) <= (19 + 14));
+fio::println(i0abcd);
+int v5abcd = v1abcd;
+c3abcd = (c3abcd - 1);
+}
+p0abcd = (19 >= ((65 <= 34) / 3));
+if(((78 == ((40 * v1abcd) < p0abcd)) || (26 <= i2abcd))){
+int v6abcd = (v1abcd || i0abcd);
+int v7abcd = (i2abcd != ((i0abcd != 2) / 2));
+fio::println(i2abcd);
+int v8abcd = (((v6abcd + p1abcd) == (i2abcd <= i0abcd)) || 48);
+int v9abcd = v8abcd;
+}
+int v10abc = i0abcd;
+}
+int v11abc = ((25 || (79 * 45)) - v1abcd);
+};
+int v12abc = (-((p0abcd - 15)) + (((p0abcd + p0abcd) * 37) / 6));
+int v13abc = (((p1abcd + p1abcd) || (69 - v12abc)) <= v12abc);
+if((((14 - 18) - 85) != (((41 * 43) - v13abc) + p1abcd))){
+int c14abc = 1;
+while((c14abc > 0)){
+if((47 == ((45 - v13abc) > v12abc))){
+v12abc = c14abc;
+p1abcd = ((c14abc || (34 * (58 * v12abc))) + (p0abcd * 95));
+int v15abc = p0abcd;
+v15abc = v15abc;
+} else {
+fio::println(p1abcd);
+v13abc = ((93 * v12abc) / 4);
+int v16abc = ((47 < v12abc) && (v13abc - (((p0abcd * 70) - 91) + 68)));
+}
+int v17abc = (!((8 * 66)) * ((-(c14abc) + 48) && c14abc));
+int v18abc = v12abc;
+for(int i19abc = 0;(i19abc < 2);i19abc++){
+int v20abc = v13abc;
+fio::println(p0abcd);
+int v21abc = ((((v20abc - 57) + v13abc) || 8) * (44 < (78 / 4)));
+}
+int c22abc = 2;
+while((c22abc > 0)){
+fio::println(c14abc);
+v12abc = (((99 / 5) - (84 / 7)) <= c22abc);
+fio::println(p1abcd);
+v13abc = ((61 - (v18abc && 15)) >= v13abc);
+v13abc = ((p0abcd + p1abcd) && (v12abc / 6));
+int v23abc = (((c14abc - v18abc) > (v12abc - 69)) && ((p0abcd / 9) + (v17abc / 5)));
+c22abc = (c22abc - 1);
+}
+c14abc = (c14abc - 1);
+}
+}
+for(int i24abc = 0;(i24abc < 4);i24abc++){
+int c25abc = 1;
+while((c25abc > 0)){
+int c26abc = 3;
+while((c26abc > 0)){
+v13abc = (p0abcd - (41 - (4 / 2)));
+int v27abc = (!((v12abc > 40)) - 25);
+v13abc = 29;
+c26abc = (c26abc - 1);
+}
+int v28abc = (((c26abc > (i24abc - 43)) < (p0abcd * v12abc)) != (c25abc * 61));
+c25abc = (c25abc - 1);
+}
+}
+return 91;
+}
+
+int f3abcd(int p0abcd){
+for(int i0abcd = 0;(i0abcd < 3);i0abcd++){
+int v1abcd = ((p0abcd && (11 * i0abcd)) && ((55 * 66) - i0abcd));
+for(int i2abcd = 0; i2abcd < 4; i2abcd++){
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+int v4abcd = (((i0abcd + 15) || (v1abcd != i3abcd)) || (i2abcd - 10));
+p0abcd = i3abcd;
+};
+for(int i5abcd = 0;(i5abcd < 2);i5abcd++){
+int v6abcd = (((((i0abcd * v1abcd) * i5abcd) - i0abcd) + i2abcd) || (i5abcd * 49));
+v6abcd = p0abcd;
+}
+v1abcd = (((94 + 15) + ((i2abcd * (i2abcd + i0abcd)) * i0abcd)) + 86);
+};
+}
+for(int i7abcd = 0; i7abcd < 3; i7abcd++){
+int v8abcd = p0abcd;
+fio::println(i7abcd);
+for(int i9abcd = 0;(i9abcd < 2);i9abcd++){
+for(int i10abc = 0;(i10abc < 3);i10abc++){
+int v11abc = 62;
+int v12abc = p0abcd;
+int v13abc = !((v11abc - (i9abcd * 21)));
+fio::println(i7abcd);
+}
+int v14abc = 10;
+int v15abc = -((v14abc - 69));
+for(int i16abc = 0;(i16abc < 4);i16abc++){
+fio::println(i7abcd);
+int v17abc = (!((v14abc > v15abc)) != (!(i16abc) && (85 > 42)));
+int v18abc = v17abc;
+fio::println(v15abc);
+v18abc = v8abcd;
+fio::println(v8abcd);
+}
+if((v8abcd > ((62 * v8abcd) && (i9abcd - v14abc)))){
+int v19abc = ((50 + (i9abcd / 5)) || (i7abcd + (v15abc / 8)));
+int v20abc = ((26 < (43 - 68)) > 18);
+} else {
+int v21abc = (p0abcd == 94);
+v15abc = 36;
+int v22abc = ((i7abcd + (p0abcd / 9)) + ((v21abc * p0abcd) >= v8abcd));
+fio::println(v15abc);
+int v23abc = 95;
+fio::println(p0abcd);
+}
+int v24abc = (((p0abcd * v15abc) + v8abcd) || (-(3) + 23));
+}
+for(int i25abc = 0;(i25abc < 2);i25abc++){
+for(int i26abc = 0; i26abc < 1; i26abc++){
+int v27abc = v8abcd;
+v8abcd = (60 <= (32 - (!(1) != (p0abcd + i26abc))));
+v27abc = (i7abcd || ((i7abcd + i25abc) + (v27abc + p0abcd)));
+fio::println(i25abc);
+int v28abc = (((i26abc * i26abc) * !(i25abc)) / 6);
+p0abcd = 3;
+};
+int v29abc = (p0abcd + ((20 * i7abcd) * 17));
+fio::println(v8abcd);
+for(int i30abc = 0;(i30abc < 4);i30abc++){
+int v31abc = 63;
+v31abc = 99;
+int v32abc = ((-(29) / 1) - ((56 * 6) * (90 * v8abcd)));
+p0abcd = (((v8abcd / 9) + (p0abcd / 7)) && v32abc);
+int v33abc = (74 != ((i30abc > i30abc) + (77 / 6)));
+fio::println(v33abc);
+}
+}
+for(int i34abc = 0;(i34abc < 3);i34abc++){
+if((i34abc != (i34abc + (99 / 3)))){
+int v35abc = (98 * i7abcd);
+int v36abc = (((((v8abcd * i34abc) / 7) + (p0abcd / 7)) - p0abcd) && i34abc);
+int v37abc = 77;
+int v38abc = (((i7abcd - !(i7abcd)) * i34abc) / 9);
+fio::println(v8abcd);
+int v39abc = p0abcd;
+} else {
+p0abcd = (((i7abcd && v8abcd) * i34abc) + (i34abc / 2));
+}
+int v40abc = i34abc;
+if((((p0abcd / 8) / 9) > (p0abcd + p0abcd))){
+int v41abc = (13 && (52 >= v8abcd));
+fio::println(v40abc);
+v41abc = -((-(29) <= (22 + i34abc)));
+}
+int v42abc = (((80 / 9) * 7) > (i34abc / 2));
+int c43abc = 3;
+while((c43abc > 0)){
+v8abcd = (i34abc - i7abcd);
+int v44abc = (v8abcd || ((v8abcd + p0abcd) - (c43abc <= -(v8abcd))));
+fio::println(p0abcd);
+int v45abc = (((4 * 93) - ((v44abc * 7) * 91)) - i7abcd);
+fio::println(i34abc);
+c43abc = (c43abc - 1);
+}
+int v46abc = ((((19 != (c43abc - v40abc)) * p0abcd) + 45) - p0abcd);
+}
+p0abcd = (((v8abcd / 2) - (98 / 8)) * (((27 * p0abcd) * v8abcd) + p0abcd));
+};
+int v47abc = ((p0abcd - (p0abcd / 1)) || 45);
+fio::println(p0abcd);
+v47abc = (p0abcd == ((21 || v47abc) || v47abc));
+for(int i48abc = 0; i48abc < 3; i48abc++){
+int v49abc = i48abc;
+int v50abc = (((v47abc / 8) + 90) || -(v49abc));
+};
+return -((p0abcd * (v47abc - p0abcd)));
+}
+
+int f4abcd(int p0abcd,int p1abcd){
+p0abcd = (((p1abcd - 68) + p1abcd) <= (p1abcd - 51));
+int v0abcd = p0abcd;
+int v1abcd = p1abcd;
+int c2abcd = 1;
+while((c2abcd > 0)){
+for(int i3abcd = 0; i3abcd < 1; i3abcd++){
+int v4abcd = ((((p1abcd * i3abcd) - p0abcd) - v0abcd) != ((57 * 88) / 8));
+for(int i5abcd = 0; i5abcd < 2; i5abcd++){
+int v6abcd = (0 || ((c2abcd * p1abcd) + -(88)));
+int v7abcd = (((31 + 3) - v1abcd) || (v0abcd != (p0abcd * v6abcd)));
+int v8abcd = ((((v1abcd / 5) * 90) + i3abcd) + (47 - (v0abcd * (50 - 8))));
+};
+if((((43 - 43) <= v4abcd) == (((i3abcd - p0abcd) + c2abcd) + p1abcd))){
+int v9abcd = (i3abcd && 88);
+int v10abc = (((v1abcd > p1abcd) <= c2abcd) != v9abcd);
+int v11abc = p1abcd;
+} else {
+int v12abc = (p0abcd == v4abcd);
+fio::println(c2abcd);
+int v13abc = ((-(v12abc) * !(c2abcd)) / 8);
+int v14abc = v12abc;
+}
+v4abcd = (-(30) || -((p0abcd < 42)));
+int v15abc = ((c2abcd / 3) == (v4abcd < ((v1abcd - 50) - v1abcd)));
+v15abc = (((p0abcd + 24) / 6) < v15abc);
+};
+c2abcd = (c2abcd - 1);
+}
+fio::println(p1abcd);
+for(int i16abc = 0;(i16abc < 3);i16abc++){
+int v17abc = (!((v0abcd - v1abcd)) >= (!(i16abc) * v1abcd));
+}
+return (((v0abcd * c2abcd) * (89 + c2abcd)) - c2abcd);
+}
+
+int f5abcd(int p0abcd,int p1abcd,int p2abcd){
+p2abcd = ((p2abcd + p0abcd) - !(p0abcd));
+for(int i0abcd = 0;(i0abcd < 2);i0abcd++){
+int v1abcd = 28;
+int c2abcd = 4;
+while((c2abcd > 0)){
+for(int i3abcd = 0;(i3abcd < 2);i3abcd++){
+int v4abcd = 84;
+int v5abcd = -((70 + (p1abcd * 12)));
+int v6abcd = v1abcd;
+int v7abcd = 23;
+v1abcd = -(((47 / 8) > (i3abcd + c2abcd)));
+}
+int v8abcd = (v1abcd + p2abcd);
+int c9abcd = 2;
+while((c9abcd > 0)){
+int v10abc = (v8abcd - p2abcd);
+int v11abc = ((68 && 6) && ((98 > 86) < (p1abcd + (77 * 66))));
+int v12abc = ((v11abc > (v8abcd * v8abcd)) <= v10abc);
+int v13abc = 49;
+c9abcd = (c9abcd - 1);
+}
+c2abcd = (c2abcd - 1);
+}
+}
+return p0abcd;
+}
+
+int f6abcd(int p0abcd,int p1abcd){
+p1abcd = 64;
+int v0abcd = p1abcd;
+p1abcd = ((p0abcd + v0abcd) && p0abcd);
+return ((((p1abcd - (p0abcd != p0abcd)) * v0abcd) - 27) && (p0abcd - v0abcd));
+}
+
+int f7abcd(){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int v1abcd = (((59 + i0abcd) + i0abcd) + i0abcd);
+};
+int v2abcd = (9 - ((52 * 12) * 2));
+fio::println(v2abcd);
+return (v2abcd / 1);
+}
+
+int f8abcd(){
+int v0abcd = (((47 - 64) - 99) && (41 || (52 - 15)));
+int v1abcd = v0abcd;
+int v2abcd = ((74 != v0abcd) != (57 * v0abcd));
+if((71 != (-(v1abcd) <= v2abcd))){
+fio::println(v0abcd);
+int c3abcd = 3;
+while((c3abcd > 0)){
+int v4abcd = (c3abcd > (c3abcd + (49 / 7)));
+int v5abcd = (((v4abcd * v2abcd) / 3) - (-(v1abcd) - 80));
+int v6abcd = ((84 / 2) <= (((2 * 27) - (v4abcd * v4abcd)) + v1abcd));
+c3abcd = (c3abcd - 1);
+}
+for(int i7abcd = 0; i7abcd < 3; i7abcd++){
+if(((1 * v2abcd) >= i7abcd)){
+int v8abcd = 32;
+int v9abcd = 20;
+int v10abc = -(((v1abcd * 54) || (v9abcd - v1abcd)));
+v10abc = v8abcd;
+}
+if((((((v0abcd + c3abcd) - !(c3abcd)) < c3abcd) >= v1abcd) >= 13)){
+int v11abc = 21;
+int v12abc = ((-((v0abcd / 4)) + v2abcd) + 50);
+int v13abc = (v0abcd * c3abcd);
+} else {
+fio::println(v0abcd);
+}
+};
+} else {
+int c14abc = 1;
+while((c14abc > 0)){
+for(int i15abc = 0;(i15abc < 4);i15abc++){
+fio::println(i15abc);
+v2abcd = ((v1abcd * v2abcd) * ((v0abcd - v0abcd) + v1abcd));
+int v16abc = -((v1abcd / 9));
+}
+int v17abc = 60;
+int v18abc = (((56 >= v17abc) <= (v0abcd + v0abcd)) <= (v17abc - (96 * 11)));
+for(int i19abc = 0;(i19abc < 2);i19abc++){
+int v20abc = (!(v18abc) + 50);
+int v21abc = ((v1abcd < 62) == (26 <= -(!(v1abcd))));
+int v22abc = ((i19abc + 85) <= ((v18abc + v1abcd) + v1abcd));
+int v23abc = 25;
+int v24abc = v21abc;
+int v25abc = v0abcd;
+}
+int v26abc = 7;
+v17abc = (c14abc / 1);
+c14abc = (c14abc - 1);
+}
+v2abcd = v0abcd;
+fio::println(v0abcd);
+}
+v0abcd = v1abcd;
+for(int i27abc = 0; i27abc < 1; i27abc++){
+v2abcd = (v0abcd - ((i27abc * 57) / 1));
+int v28abc = 34;
+int v29abc = (!(i27abc) && (v2abcd * (v0abcd || ((v1abcd * v2abcd) * v0abcd))));
+if((8 != ((v2abcd / 1) >= (61 + 60)))){
+v1abcd = -(-((75 + v1abcd)));
+int v30abc = 19;
+int c31abc = 1;
+while((c31abc > 0)){
+int v32abc = 0;
+int v33abc = (v30abc <= ((v30abc + c31abc) + (c31abc * 31)));
+int v34abc = -(29);
+v1abcd = (((((v0abcd - v33abc) - v0abcd) && v1abcd) - (65 * 12)) + v34abc);
+c31abc = (c31abc - 1);
+}
+int c35abc = 4;
+while((c35abc > 0)){
+int v36abc = ((((20 / 2) + (((11 * 49) * v29abc) * c35abc)) - 58) - v2abcd);
+int v37abc = v30abc;
+int v38abc = (((v28abc - 28) == (c31abc + c35abc)) / 7);
+int v39abc = c35abc;
+int v40abc = 36;
+int v41abc = (((c31abc + -(47)) + 8) + 73);
+c35abc = (c35abc - 1);
+}
+int v42abc = ((((v28abc - (10 * v1abcd)) - c31abc) + 26) - v2abcd);
+}
+int v43abc = v2abcd;
+for(int i44abc = 0; i44abc < 1; i44abc++){
+int c45abc = 4;
+while((c45abc > 0)){
+int v46abc = (3 == (81 * 93));
+int v47abc = (((!(3) + 22) + v43abc) == (23 / 6));
+c45abc = (c45abc - 1);
+}
+for(int i48abc = 0;(i48abc < 4);i48abc++){
+int v49abc = 16;
+fio::println(i44abc);
+}
+};
+};
+return (48 * v1abcd);
+}
+
+int f9abcd(int p0abcd,int p1abcd,int p2abcd){
+int c0abcd = 3;
+while((c0abcd > 0)){
+int c1abcd = 4;
+while((c1abcd > 0)){
+int c2abcd = 4;
+while((c2abcd > 0)){
+int v3abcd = 85;
+fio::println(v3abcd);
+v3abcd = 67;
+c2abcd = (c2abcd - 1);
+}
+c1abcd = (c1abcd - 1);
+}
+for(int i4abcd = 0; i4abcd < 4; i4abcd++){
+int v5abcd = (((p1abcd - p1abcd) && 86) || ((p1abcd > p2abcd) || c0abcd));
+v5abcd = ((p1abcd * p1abcd) * ((94 + (p2abcd * v5abcd)) == 55));
+};
+fio::println(p1abcd);
+for(int i6abcd = 0;(i6abcd < 4);i6abcd++){
+fio::println(c1abcd);
+for(int i7abcd = 0; i7abcd < 1; i7abcd++){
+int v8abcd = (!((58 && c0abcd)) != ((17 + 17) - !(i7abcd)));
+fio::println(p0abcd);
+fio::println(v8abcd);
+fio::println(v8abcd);
+int v9abcd = (((c1abcd / 3) * p2abcd) + ((38 + 44) - (95 * i7abcd)));
+};
+for(int i10abc = 0; i10abc < 4; i10abc++){
+int v11abc = !((p0abcd - (c0abcd - 83)));
+};
+int v12abc = !((!(p1abcd) - c0abcd));
+int v13abc = (((26 - p1abcd) - c0abcd) - (c0abcd || 6));
+int v14abc = (((c1abcd == (31 + 42)) || c1abcd) && 64);
+}
+fio::println(p1abcd);
+fio::println(p2abcd);
+c0abcd = (c0abcd - 1);
+}
+for(int i15abc = 0; i15abc < 1; i15abc++){
+int c16abc = 4;
+while((c16abc > 0)){
+p1abcd = ((p2abcd + !(42)) - p2abcd);
+c16abc = (c16abc - 1);
+}
+int v17abc = (-(c0abcd) <= ((((c16abc * 6) + 4) - 9) + c0abcd));
+};
+return ((80 + ((p1abcd * c0abcd) * c0abcd)) >= (p0abcd + c0abcd));
+}
+
+int f10abc(int p0abcd,int p1abcd,int p2abcd){
+fio::println(p0abcd);
+int v0abcd = 63;
+if(((-(v0abcd) * !(90)) >= ((36 - p1abcd) + p1abcd))){
+int c1abcd = 1;
+while((c1abcd > 0)){
+v0abcd = -(p2abcd);
+int v2abcd = (p2abcd + ((v0abcd + p2abcd) * -((21 > p1abcd))));
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+fio::println(c1abcd);
+};
+c1abcd = (c1abcd - 1);
+}
+}
+for(int i4abcd = 0;(i4abcd < 3);i4abcd++){
+int v5abcd = 24;
+int v6abcd = (p1abcd + p1abcd);
+for(int i7abcd = 0; i7abcd < 4; i7abcd++){
+int v8abcd = ((((v5abcd > p2abcd) * p0abcd) < p1abcd) != v5abcd);
+int c9abcd = 1;
+while((c9abcd > 0)){
+fio::println(i4abcd);
+int v10abc = (((p1abcd * 65) + (v5abcd * 14)) + 43);
+int v11abc = p1abcd;
+int v12abc = ((6 > (p0abcd / 1)) * ((28 * 85) * (88 == 71)));
+v6abcd = 77;
+int v13abc = (77 - p2abcd);
+c9abcd = (c9abcd - 1);
+}
+int v14abc = ((v6abcd + -(c9abcd)) <= (((v0abcd + 69) + 46) + i7abcd));
+int v15abc = (v14abc * p0abcd);
+int v16abc = 13;
+};
+}
+for(int i17abc = 0; i17abc < 1; i17abc++){
+if((!((p1abcd != 43)) > 19)){
+int v18abc = 98;
+int v19abc = p2abcd;
+} else {
+int v20abc = ((!(!(84)) + 76) > (2 / 4));
+if((!(92) <= 26)){
+p0abcd = ((p0abcd > 53) >= ((p0abcd - v20abc) * p0abcd));
+fio::println(i17abc);
+int v21abc = ((96 >= 50) < (81 * v20abc));
+} else {
+int v22abc = (((i17abc != v20abc) || (p1abcd && p2abcd)) && (25 == (v0abcd + p0abcd)));
+}
+int c23abc = 3;
+while((c23abc > 0)){
+int v24abc = (((v0abcd * v20abc) < (c23abc + 6)) && (i17abc * (v20abc - i17abc)));
+fio::println(v24abc);
+int v25abc = 31;
+p1abcd = (((v25abc <= 26) == ((v24abc - p1abcd) + v24abc)) != (49 * 61));
+int v26abc = p1abcd;
+c23abc = (c23abc - 1);
+}
+int v27abc = p2abcd;
+}
+fio::println(p1abcd);
+};
+return 66;
+}
+
+int f11abc(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int v1abcd = ((53 / 6) - 99);
+fio::println(i0abcd);
+int v2abcd = v1abcd;
+if((v1abcd > ((p2abcd + (96 * v1abcd)) - p1abcd))){
+int v3abcd = (v1abcd >= ((20 * p1abcd) + (21 || 95)));
+int v4abcd = ((p2abcd / 7) - 12);
+int v5abcd = (p2abcd + 20);
+int v6abcd = p2abcd;
+}
+int v7abcd = ((p0abcd > v1abcd) > (26 * 64));
+};
+int v8abcd = (((p0abcd * 86) || p2abcd) * p2abcd);
+int v9abcd = 78;
+if(((((p0abcd / 1) * (p0abcd > p0abcd)) <= 14) < ((93 * p1abcd) - 5))){
+int v10abc = ((v9abcd + 86) < ((72 >= 32) / 8));
+for(int i11abc = 0;(i11abc < 1);i11abc++){
+int c12abc = 4;
+while((c12abc > 0)){
+int v13abc = p0abcd;
+int v14abc = !(((v9abcd + (p1abcd * 33)) != c12abc));
+c12abc = (c12abc - 1);
+}
+for(int i15abc = 0; i15abc < 1; i15abc++){
+int v16abc = ((v8abcd > (p1abcd / 8)) != 46);
+};
+int v17abc = !((11 || i11abc));
+int v18abc = v8abcd;
+}
+if(((21 + (29 || p0abcd)) == !((p0abcd <= 22)))){
+fio::println(p0abcd);
+int v19abc = v9abcd;
+fio::println(v9abcd);
+int c20abc = 1;
+while((c20abc > 0)){
+fio::println(p2abcd);
+v10abc = v9abcd;
+c20abc = (c20abc - 1);
+}
+int v21abc = (52 <= (((36 * (p1abcd - 68)) + p0abcd) + 44));
+int v22abc = ((!(v9abcd) + v9abcd) && ((p2abcd + ((95 * 79) * 10)) + v19abc));
+}
+for(int i23abc = 0; i23abc < 2; i23abc++){
+for(int i24abc = 0; i24abc < 2; i24abc++){
+fio::println(p1abcd);
+fio::println(p2abcd);
+int v25abc = (((17 * 3) - 17) || (v10abc - (p1abcd * 20)));
+fio::println(p1abcd);
+int v26abc = ((13 - i24abc) + v10abc);
+v10abc = (((i24abc + !(v10abc)) - 53) || (v26abc * 90));
+};
+for(int i27abc = 0; i27abc < 4; i27abc++){
+int v28abc = ((((68 * 23) - 85) - 28) != p2abcd);
+int v29abc = ((!(i27abc) + v10abc) + (p2abcd - (1 / 4)));
+};
+int c30abc = 2;
+while((c30abc > 0)){
+int v31abc = !(c30abc);
+int v32abc = (((-((p1abcd * p0abcd)) * i23abc) * p2abcd) && v9abcd);
+v31abc = (1 * i23abc);
+v32abc = p0abcd;
+c30abc = (c30abc - 1);
+}
+if((((45 + v9abcd) * 37) > (32 * 56))){
+v10abc = (20 * i23abc);
+fio::println(v10abc);
+int v33abc = (c30abc * -((v8abcd * p2abcd)));
+}
+for(int i34abc = 0; i34abc < 1; i34abc++){
+int v35abc = !(!((v8abcd >= p0abcd)));
+fio::println(c30abc);
+int v36abc = -(!((i23abc && 24)));
+};
+};
+if((((83 < v9abcd) / 4) >= 2)){
+if((-((v9abcd - v8abcd)) == !((v8abcd + p1abcd)))){
+fio::println(p1abcd);
+}
+int v37abc = ((21 - (87 / 6)) != ((p0abcd * p0abcd) <= p0abcd));
+if((96 <= 16)){
+int v38abc = ((v9abcd != 82) / 5);
+int v39abc = (((v10abc * 55) * 84) - (6 / 7));
+int v40abc = p0abcd;
+int v41abc = v10abc;
+int v42abc = p1abcd;
+} else {
+int v43abc = ((v9abcd - (v8abcd != v37abc)) && ((v9abcd / 3) > 82));
+fio::println(p0abcd);
+fio::println(v9abcd);
+}
+int v44abc = (p2abcd && (22 > (45 * 76)));
+for(int i45abc = 0; i45abc < 3; i45abc++){
+int v46abc = !((32 / 4));
+};
+int c47abc = 3;
+while((c47abc > 0)){
+p1abcd = p0abcd;
+c47abc = (c47abc - 1);
+}
+} else {
+int v48abc = (((56 - 98) <= v9abcd) > (80 - 23));
+int v49abc = v8abcd;
+}
+} else {
+int v50abc = (((14 / 3) * (v8abcd && 6)) && ((91 || 26) / 3));
+fio::println(v9abcd);
+int v51abc = (p2abcd == (!(p1abcd) + -((p2abcd >= 16))));
+int v52abc = p0abcd;
+}
+if((((v9abcd - p1abcd) + v9abcd) > p2abcd)){
+int v53abc = ((37 * v8abcd) != ((v9abcd <= v9abcd) + -(45)));
+int c54abc = 4;
+while((c54abc > 0)){
+fio::println(c54abc);
+for(int i55abc = 0; i55abc < 4; i55abc++){
+int v56abc = (-(v8abcd) * v8abcd);
+p2abcd = (((p0abcd > v56abc) * (22 + p2abcd)) || ((i55abc + 96) / 3));
+int v57abc = c54abc;
+fio::println(p0abcd);
+int v58abc = ((33 - 3) == (54 * ((p1abcd - 15) + p0abcd)));
+};
+for(int i59abc = 0;(i59abc < 2);i59abc++){
+fio::println(v53abc);
+p2abcd = v8abcd;
+int v60abc = (i59abc <= ((18 || 40) + -(v53abc)));
+v8abcd = (((85 / 6) * (p0abcd + v60abc)) && ((v60abc + v9abcd) + 47));
+int v61abc = !((((v9abcd * 94) >= v9abcd) < v53abc));
+int v62abc = ((c54abc - (76 / 4)) - !(49));
+}
+c54abc = (c54abc - 1);
+}
+if(((v8abcd >= 73) != (17 + p1abcd))){
+int v63abc = (1 && (((v8abcd * c54abc) <= (v9abcd - 82)) <= (34 * v8abcd)));
+for(int i64abc = 0;(i64abc < 3);i64abc++){
+int v65abc = p2abcd;
+}
+for(int i66abc = 0;(i66abc < 2);i66abc++){
+fio::println(p2abcd);
+}
+for(int i67abc = 0; i67abc < 2; i67abc++){
+int v68abc = (((v63abc >= (56 + 40)) > ((v53abc * c54abc) + v63abc)) || (78 + 6));
+int v69abc = ((12 / 4) || (((v63abc + i67abc) - 49) >= v68abc));
+int v70abc = ((32 + (53 > i67abc)) + (51 * i67abc));
+int v71abc = (((v9abcd * v9abcd) + 72) > (v63abc * !(c54abc)));
+v8abcd = (v8abcd / 1);
+};
+int v72abc = !(!((v53abc == p1abcd)));
+} else {
+p0abcd = (v8abcd != p2abcd);
+for(int i73abc = 0;(i73abc < 1);i73abc++){
+v53abc = (c54abc || ((45 - p1abcd) < (c54abc * 38)));
+}
+}
+} else {
+int v74abc = (22 || (((p0abcd + (v9abcd / 7)) >= p1abcd) > (v8abcd * 51)));
+int v75abc = ((0 - (71 - 36)) - (25 * 73));
+}
+return (((p1abcd + 73) + ((v9abcd * !(12)) * p0abcd)) < v8abcd);
+}
+
+int solve(int p0abcd){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+p0abcd = 19;
+};
+fio::println(p0abcd);
+int c1abcd = 2;
+while((c1abcd > 0)){
+int v2abcd = ((p0abcd * c1abcd) && (18 + (p0abcd * (p0abcd / 9))));
+fio::println(p0abcd);
+if((50 > (25 / 2))){
+int c3abcd = 2;
+while((c3abcd > 0)){
+int v4abcd = ((((c1abcd + c1abcd) != v2abcd) || 59) / 4);
+v4abcd = (-((71 && c1abcd)) + ((32 + 82) + c1abcd));
+c3abcd = (c3abcd - 1);
+}
+int v5abcd = (c1abcd && ((46 - v2abcd) - 0));
+fio::println(p0abcd);
+if((55 > ((12 - 29) / 9))){
+int v6abcd = ((14 * (c3abcd - p0abcd)) && (p0abcd && v2abcd));
+int v7abcd = 21;
+fio::println(v7abcd);
+v2abcd = (((83 / 3) - 63) && v2abcd);
+} else {
+p0abcd = 80;
+fio::println(v5abcd);
+}
+int v8abcd = (((72 * c1abcd) <= p0abcd) > 94);
+}
+c1abcd = (c1abcd - 1);
+}
+for(int i9abcd = 0;(i9abcd < 4);i9abcd++){
+int v10abc = (((c1abcd - !(i9abcd)) + p0abcd) >= 14);
+int c11abc = 2;
+while((c11abc > 0)){
+int c12abc = 4;
+while((c12abc > 0)){
+int v13abc = (-(c12abc) == 97);
+c12abc = (c12abc - 1);
+}
+for(int i14abc = 0; i14abc < 2; i14abc++){
+fio::println(i14abc);
+v10abc = 60;
+};
+c11abc = (c11abc - 1);
+}
+int c15abc = 1;
+while((c15abc > 0)){
+int c16abc = 1;
+while((c16abc > 0)){
+fio::println(i9abcd);
+c16abc = (c16abc - 1);
+}
+c15abc = (c15abc - 1);
+}
+int v17abc = ((c15abc + 97) > ((92 / 6) * 14));
+}
+return (92 * (!(p0abcd) + (c1abcd * c1abcd)));
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
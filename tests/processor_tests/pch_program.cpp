@@ -0,0 +1,18 @@
+#include "/root/repo/tests/processor_tests/pch_cache/2f24959064538ccb/fpp_preamble.h"
+int solve(int a){
+int n = 10;
+int result = 0;
+for(int i = a;(i < n);i++){
+result = (result + 1);
+}
+fio::println(result);
+return result;
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
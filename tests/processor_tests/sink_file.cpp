@@ -0,0 +1,1358 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(int p0abcd){
+if(((p0abcd == (11 + 30)) && ((p0abcd > (p0abcd - 87)) == (p0abcd - p0abcd)))){
+if((p0abcd == p0abcd)){
+int v0abcd = ((85 < 27) || p0abcd);
+int v1abcd = ((v0abcd - 37) || (p0abcd > (p0abcd * ((v0abcd + p0abcd) - v0abcd))));
+fio::println(v0abcd);
+fio::println(v0abcd);
+} else {
+int c2abcd = 3;
+while((c2abcd > 0)){
+int v3abcd = 70;
+fio::println(v3abcd);
+fio::println(c2abcd);
+int v4abcd = (p0abcd + (((p0abcd / 7) * (c2abcd != 12)) / 9));
+int v5abcd = -(v4abcd);
+fio::println(c2abcd);
+c2abcd = (c2abcd - 1);
+}
+for(int i6abcd = 0; i6abcd < 4; i6abcd++){
+fio::println(p0abcd);
+int v7abcd = c2abcd;
+int v8abcd = p0abcd;
+p0abcd = ((65 - v7abcd) - (!(c2abcd) / 5));
+int v9abcd = c2abcd;
+int v10abc = ((i6abcd - (c2abcd <= c2abcd)) + v7abcd);
+};
+if((p0abcd > (p0abcd / 4))){
+int v11abc = 65;
+} else {
+p0abcd = 11;
+int v12abc = 98;
+int v13abc = v12abc;
+fio::println(v12abc);
+}
+}
+} else {
+fio::println(p0abcd);
+fio::println(p0abcd);
+p0abcd = ((!(97) - p0abcd) / 9);
+}
+int v14abc = p0abcd;
+return p0abcd;
+}
+
+int f1abcd(int p0abcd){
+int v0abcd = ((f0abcd(94) * p0abcd) && (93 + p0abcd));
+return (p0abcd <= (p0abcd + ((p0abcd * p0abcd) / 2)));
+}
+
+int f2abcd(int p0abcd){
+int v0abcd = 82;
+for(int i1abcd = 0; i1abcd < 1; i1abcd++){
+int v2abcd = 96;
+int v3abcd = (i1abcd == 20);
+fio::println(v2abcd);
+if((((i1abcd * 65) + v3abcd) == 20)){
+f1abcd(f1abcd((39 + v3abcd)));
+f0abcd(36);
+int c4abcd = 2;
+while((c4abcd > 0)){
+v3abcd = ((62 * 59) + ((i1abcd * p0abcd) / 9));
+f0abcd(((c4abcd + p0abcd) / 8));
+int v5abcd = ((((73 - v3abcd) - (12 <= f1abcd(c4abcd))) + v3abcd) || (v3abcd && i1abcd));
+int v6abcd = v0abcd;
+c4abcd = (c4abcd - 1);
+}
+int c7abcd = 1;
+while((c7abcd > 0)){
+int v8abcd = ((((20 / 1) - (87 < v3abcd)) - v0abcd) && (c4abcd / 9));
+int v9abcd = -(27);
+fio::println(p0abcd);
+int v10abc = (((i1abcd * 46) < (c4abcd >= 61)) > ((v8abcd < v9abcd) / 9));
+int v11abc = (((73 <= f1abcd(36)) * (p0abcd / 6)) * (i1abcd * i1abcd));
+int v12abc = (!((85 * v3abcd)) * 37);
+c7abcd = (c7abcd - 1);
+}
+int v13abc = f1abcd(((v2abcd * 33) + f0abcd(i1abcd)));
+for(int i14abc = 0; i14abc < 1; i14abc++){
+int v15abc = !(c7abcd);
+int v16abc = ((((v0abcd / 7) * f0abcd(v15abc)) >= v2abcd) >= (((f0abcd(76) / 8) - 11) >= 56));
+f1abcd(((f0abcd(i1abcd) * f0abcd(c4abcd)) || (86 - 36)));
+f0abcd(((v16abc + v3abcd) >= (96 - v2abcd)));
+int v17abc = ((c7abcd * 26) != (v16abc + (7 * (v0abcd + 80))));
+};
+}
+f1abcd(((11 / 5) > v3abcd));
+};
+int v18abc = ((((v0abcd - v0abcd) + 51) < v0abcd) <= 86);
+int c19abc = 1;
+while((c19abc > 0)){
+fio::println(p0abcd);
+if((v0abcd != ((v0abcd - c19abc) > v18abc))){
+for(int i20abc = 0;(i20abc < 2);i20abc++){
+int v21abc = (i20abc / 7);
+int v22abc = !((0 < (i20abc * !(c19abc))));
+}
+int v23abc = (35 < (37 - p0abcd));
+int v24abc = 22;
+} else {
+for(int i25abc = 0;(i25abc < 2);i25abc++){
+int v26abc = !((28 - v18abc));
+int v27abc = (28 + ((v18abc + v26abc) / 4));
+int v28abc = (!(f0abcd(c19abc)) < (2 / 4));
+int v29abc = (f0abcd((i25abc + v28abc)) < (v26abc + (79 / 6)));
+int v30abc = (77 - ((62 && v27abc) / 1));
+int v31abc = (-(f1abcd(5)) * !(13));
+}
+if((c19abc == (-(47) < (v18abc == 2)))){
+p0abcd = (-(50) - c19abc);
+}
+p0abcd = f0abcd(53);
+v18abc = (((43 / 5) - (c19abc / 1)) > 53);
+p0abcd = v18abc;
+}
+int c32abc = 1;
+while((c32abc > 0)){
+int v33abc = (((v0abcd - c32abc) / 2) / 4);
+if(((v18abc < (c19abc + v33abc)) != c32abc)){
+int v34abc = ((-(83) - p0abcd) + 67);
+int v35abc = ((c32abc && (6 + v18abc)) && (v0abcd != c32abc));
+int v36abc = v35abc;
+int v37abc = 61;
+} else {
+p0abcd = ((((((21 + 42) + 32) < c32abc) - 49) < 9) == 83);
+int v38abc = (v0abcd / 7);
+v18abc = ((((63 && f0abcd(23)) <= 57) != c19abc) || ((-(v0abcd) - v38abc) - v0abcd));
+int v39abc = (((v38abc - v38abc) <= 30) || ((45 > (v0abcd * c32abc)) <= c32abc));
+int v40abc = ((((c32abc * 24) + f1abcd(p0abcd)) - v0abcd) && ((c32abc + v33abc) - 71));
+int v41abc = 69;
+}
+int v42abc = ((c32abc * 11) || (f0abcd(v18abc) > (32 * (c19abc * 32))));
+c32abc = (c32abc - 1);
+}
+v18abc = (7 > ((c32abc * p0abcd) / 1));
+for(int i43abc = 0;(i43abc < 2);i43abc++){
+int v44abc = (v18abc / 7);
+int v45abc = ((v44abc * v18abc) || (((f0abcd(c19abc) - v44abc) * !(3)) + !(v44abc)));
+}
+c19abc = (c19abc - 1);
+}
+fio::println(v0abcd);
+return -(((23 * 56) - (c19abc - v18abc)));
+}
+
+int f3abcd(int p0abcd){
+p0abcd = (f2abcd((p0abcd + p0abcd)) + (p0abcd / 4));
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int c1abcd = 2;
+while((c1abcd > 0)){
+p0abcd = c1abcd;
+int v2abcd = ((((p0abcd / 6) + 45) + i0abcd) + -(57));
+int v3abcd = ((p0abcd + (p0abcd / 9)) * p0abcd);
+f2abcd((i0abcd != i0abcd));
+int v4abcd = ((((72 + v2abcd) * p0abcd) + 14) - 47);
+for(int i5abcd = 0; i5abcd < 1; i5abcd++){
+int v6abcd = (((v4abcd + 19) && !(f2abcd(33))) + (f2abcd(v2abcd) != (76 - (f0abcd(i0abcd) / 7))));
+int v7abcd = ((p0abcd * 69) && (-(6) - v2abcd));
+fio::println(v7abcd);
+};
+c1abcd = (c1abcd - 1);
+}
+for(int i8abcd = 0; i8abcd < 1; i8abcd++){
+f2abcd(!((f1abcd(p0abcd) - i8abcd)));
+int v9abcd = (i8abcd || p0abcd);
+if((p0abcd == !(41))){
+int v10abc = !((i0abcd <= (82 + (39 / 7))));
+}
+};
+p0abcd = 68;
+int v11abc = ((49 / 6) * i0abcd);
+v11abc = (((v11abc * 73) * c1abcd) - 19);
+if(((((f0abcd(i0abcd) * 19) - i0abcd) < f0abcd(75)) >= ((f1abcd(58) - v11abc) + (f2abcd(p0abcd) * v11abc)))){
+f0abcd((81 + p0abcd));
+} else {
+int v12abc = v11abc;
+int v13abc = v12abc;
+if(((((v12abc + v11abc) <= c1abcd) == (c1abcd - p0abcd)) || -(19))){
+f2abcd((c1abcd + (i0abcd / 6)));
+int v14abc = (i0abcd == (((74 + -(f1abcd(98))) + !(v13abc)) >= (21 - v12abc)));
+int v15abc = 49;
+int v16abc = ((f1abcd(v13abc) <= (f1abcd(v14abc) * v13abc)) < (((v14abc + 39) + 96) - f2abcd(c1abcd)));
+int v17abc = ((v13abc && (v15abc / 1)) || (9 * i0abcd));
+} else {
+int v18abc = 54;
+}
+int v19abc = (((72 * v12abc) + v12abc) || (c1abcd + v13abc));
+f0abcd(((v19abc - p0abcd) != (73 * v11abc)));
+for(int i20abc = 0;(i20abc < 3);i20abc++){
+fio::println(v12abc);
+int v21abc = ((((p0abcd / 7) / 5) - c1abcd) - -(87));
+f2abcd(v13abc);
+int v22abc = v19abc;
+int v23abc = (!(96) == ((f2abcd(5) / 1) * v11abc));
+fio::println(v19abc);
+}
+}
+};
+int v24abc = (((73 * 2) + 25) < ((p0abcd / 2) + (22 * p0abcd)));
+return ((p0abcd == !(22)) && !(p0abcd));
+}
+
+int f4abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = -(77);
+if((39 < !((v0abcd + v0abcd)))){
+v0abcd = (p0abcd && ((76 / 1) + p2abcd));
+int v1abcd = (p1abcd - 71);
+fio::println(v1abcd);
+fio::println(p1abcd);
+int c2abcd = 3;
+while((c2abcd > 0)){
+v0abcd = ((((v0abcd * 63) - 68) && 10) || 88);
+int v3abcd = (v0abcd <= 94);
+int v4abcd = ((v3abcd < p2abcd) >= (v3abcd * ((87 + v1abcd) >= p2abcd)));
+c2abcd = (c2abcd - 1);
+}
+for(int i5abcd = 0;(i5abcd < 1);i5abcd++){
+if((((p2abcd <= v0abcd) >= v1abcd) > c2abcd)){
+p0abcd = (1 - (p1abcd != 92));
+int v6abcd = !((33 * -(i5abcd)));
+int v7abcd = (v6abcd + ((f2abcd(v1abcd) * 67) / 3));
+fio::println(p2abcd);
+int v8abcd = p2abcd;
+} else {
+int v9abcd = -(((i5abcd * f3abcd(81)) > (v0abcd * 84)));
+int v10abc = (!((67 + p1abcd)) * (((74 + 76) + p2abcd) || v0abcd));
+}
+int c11abc = 1;
+while((c11abc > 0)){
+int v12abc = p0abcd;
+p0abcd = ((p0abcd * (v0abcd * c11abc)) + ((v0abcd * f1abcd(94)) + (c11abc / 8)));
+c11abc = (c11abc - 1);
+}
+int v13abc = c2abcd;
+}
+}
+int v14abc = -(v0abcd);
+for(int i15abc = 0;(i15abc < 2);i15abc++){
+for(int i16abc = 0; i16abc < 2; i16abc++){
+fio::println(i15abc);
+fio::println(i15abc);
+f1abcd(61);
+v0abcd = (25 < ((f2abcd(69) / 8) + p1abcd));
+};
+int v17abc = 66;
+f1abcd(((67 * 73) / 2));
+f3abcd(f1abcd(f3abcd(p2abcd)));
+if(((v17abc != 13) || ((50 + 35) < p1abcd))){
+for(int i18abc = 0;(i18abc < 3);i18abc++){
+int v19abc = (45 * p1abcd);
+int v20abc = ((-(75) * v0abcd) / 1);
+fio::println(i18abc);
+f3abcd(i18abc);
+f2abcd(((f3abcd(95) + v14abc) != v14abc));
+f0abcd(-(v14abc));
+}
+} else {
+int v21abc = (f2abcd(f1abcd(55)) / 1);
+}
+}
+return ((10 + p0abcd) > (p0abcd + (v0abcd / 9)));
+}
+
+int f5abcd(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0;(i0abcd < 4);i0abcd++){
+if((55 < (-(f1abcd(p0abcd)) + (p0abcd != 41)))){
+f1abcd(p0abcd);
+int v1abcd = 65;
+} else {
+for(int i2abcd = 0; i2abcd < 4; i2abcd++){
+f1abcd(p2abcd);
+int v3abcd = ((93 != 44) || (75 < (p0abcd * 11)));
+p1abcd = (p1abcd / 5);
+int v4abcd = p2abcd;
+int v5abcd = ((((v3abcd - p1abcd) + 82) - p2abcd) - ((v4abcd * i0abcd) * f2abcd(i0abcd)));
+int v6abcd = (p1abcd * p1abcd);
+};
+f2abcd(27);
+f1abcd(!((p1abcd - 78)));
+int c7abcd = 2;
+while((c7abcd > 0)){
+f4abcd(((6 * p2abcd) >= (86 * 78)),i0abcd,(f0abcd(99) == (78 - (44 <= p0abcd))));
+int v8abcd = p0abcd;
+f1abcd((19 * c7abcd));
+fio::println(i0abcd);
+c7abcd = (c7abcd - 1);
+}
+fio::println(p1abcd);
+if((((c7abcd / 9) / 4) >= 91)){
+fio::println(p2abcd);
+fio::println(p1abcd);
+fio::println(p1abcd);
+}
+}
+int v9abcd = ((((p0abcd || f2abcd(72)) * 2) <= 56) > (-(95) * (98 * 10)));
+int v10abc = 0;
+f0abcd(((31 + 99) + (p0abcd - v10abc)));
+int v11abc = i0abcd;
+}
+return 9;
+}
+
+int f6abcd(int p0abcd){
+int c0abcd = 1;
+while((c0abcd > 0)){
+int c1abcd = 3;
+while((c1abcd > 0)){
+p0abcd = ((c1abcd - 71) != ((c0abcd - c1abcd) / 6));
+int c2abcd = 4;
+while((c2abcd > 0)){
+f5abcd(((78 + c1abcd) - 9),((c2abcd - c1abcd) < c0abcd),((p0abcd + c1abcd) > c1abcd));
+int v3abcd = p0abcd;
+fio::println(c0abcd);
+c2abcd = (c2abcd - 1);
+}
+for(int i4abcd = 0; i4abcd < 2; i4abcd++){
+int v5abcd = -(((31 - c1abcd) - (c0abcd * c0abcd)));
+int v6abcd = c0abcd;
+};
+c1abcd = (c1abcd - 1);
+}
+c0abcd = (c0abcd - 1);
+}
+p0abcd = (30 * !(-(c0abcd)));
+p0abcd = 32;
+for(int i7abcd = 0;(i7abcd < 1);i7abcd++){
+int v8abcd = c0abcd;
+if((17 != ((p0abcd * i7abcd) / 8))){
+for(int i9abcd = 0; i9abcd < 1; i9abcd++){
+int v10abc = p0abcd;
+};
+int v11abc = f0abcd(((21 + c0abcd) + p0abcd));
+for(int i12abc = 0;(i12abc < 2);i12abc++){
+fio::println(v11abc);
+int v13abc = (!((f3abcd(30) - f5abcd(97,v11abc,69))) != p0abcd);
+f1abcd((((15 * c0abcd) + f4abcd(v8abcd,v13abc,p0abcd)) || 20));
+}
+v11abc = (!(v11abc) - (v11abc / 5));
+} else {
+p0abcd = ((p0abcd - v8abcd) != (p0abcd / 1));
+int c14abc = 1;
+while((c14abc > 0)){
+p0abcd = (!((32 + 78)) > 7);
+fio::println(c14abc);
+int v15abc = (((47 / 6) - 26) && f5abcd(83,20,v8abcd));
+f2abcd((v8abcd || ((30 + c14abc) - 38)));
+f4abcd((((v15abc * f0abcd(v8abcd)) + v8abcd) <= c14abc),(v8abcd - (i7abcd * 6)),(((c0abcd / 1) * c0abcd) >= v15abc));
+c14abc = (c14abc - 1);
+}
+for(int i16abc = 0;(i16abc < 3);i16abc++){
+v8abcd = (!(c0abcd) + ((f1abcd(35) * f3abcd(c0abcd)) * 17));
+}
+int v17abc = (18 || !((v8abcd - c14abc)));
+for(int i18abc = 0;(i18abc < 1);i18abc++){
+int v19abc = (((v17abc + 41) && (f2abcd(29) + p0abcd)) || 20);
+int v20abc = (c14abc <= ((i18abc * f4abcd(i7abcd,f4abcd(i7abcd,i7abcd,i18abc),i7abcd)) / 8));
+v19abc = (((29 + i7abcd) - (f3abcd(v8abcd) * f3abcd(71))) + 67);
+f1abcd(17);
+}
+fio::println(v8abcd);
+}
+int v21abc = (((i7abcd - 91) > (96 - 53)) < ((53 - 26) == (96 >= v8abcd)));
+int v22abc = ((i7abcd - (v8abcd * v8abcd)) - i7abcd);
+}
+int v23abc = c0abcd;
+int v24abc = ((v23abc * c0abcd) > ((19 / 8) * 11));
+return 70;
+}
+
+int f7abcd(int p0abcd){
+f0abcd(((f5abcd(p0abcd,72,68) >= f4abcd(p0abcd,p0abcd,p0abcd)) || p0abcd));
+if((p0abcd != p0abcd)){
+p0abcd = f3abcd(93);
+p0abcd = (((30 * 91) && -(p0abcd)) && ((81 - p0abcd) + (p0abcd * 8)));
+int v0abcd = (p0abcd <= (73 + (!(p0abcd) / 1)));
+}
+return (((p0abcd / 4) >= ((p0abcd * 96) - -(p0abcd))) || (84 <= 37));
+}
+
+int f8abcd(){
+int v0abcd = (17 != ((f2abcd(37) * (33 == 23)) + 17));
+fio::println(v0abcd);
+if(((v0abcd / 4) == ((1 < (v0abcd / 3)) < (v0abcd - v0abcd)))){
+int c1abcd = 2;
+while((c1abcd > 0)){
+int v2abcd = (42 || 93);
+fio::println(v0abcd);
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+int v4abcd = ((-(v2abcd) - (f6abcd(i3abcd) >= v2abcd)) == (13 < v2abcd));
+v4abcd = ((f0abcd(52) - v0abcd) + v2abcd);
+v0abcd = ((v0abcd <= (v2abcd + v2abcd)) != (i3abcd < 40));
+int v5abcd = (c1abcd / 2);
+int v6abcd = (39 != (46 - ((v4abcd * v4abcd) * v5abcd)));
+};
+int v7abcd = (0 + ((v2abcd * v0abcd) - (79 && 82)));
+int c8abcd = 2;
+while((c8abcd > 0)){
+int v9abcd = v0abcd;
+int v10abc = (c8abcd || v9abcd);
+fio::println(c8abcd);
+f4abcd(!((56 >= 53)),((12 / 6) / 1),((56 - c8abcd) / 1));
+int v11abc = ((63 - c1abcd) - ((v2abcd / 4) / 7));
+v2abcd = (1 && ((5 / 3) > 97));
+c8abcd = (c8abcd - 1);
+}
+if((((v7abcd * 29) - (v7abcd / 5)) != c8abcd)){
+fio::println(c8abcd);
+fio::println(v7abcd);
+int v12abc = v0abcd;
+f1abcd(35);
+f3abcd(v12abc);
+}
+c1abcd = (c1abcd - 1);
+}
+int c13abc = 4;
+while((c13abc > 0)){
+for(int i14abc = 0; i14abc < 2; i14abc++){
+fio::println(v0abcd);
+int v15abc = ((f7abcd(96) * 65) != (c1abcd + 81));
+int v16abc = ((!(22) > (f2abcd(c13abc) * 52)) != v15abc);
+fio::println(c13abc);
+int v17abc = (((c1abcd + v15abc) - c13abc) || (f6abcd(68) / 2));
+};
+c13abc = (c13abc - 1);
+}
+int c18abc = 2;
+while((c18abc > 0)){
+fio::println(c13abc);
+c18abc = (c18abc - 1);
+}
+} else {
+for(int i19abc = 0;(i19abc < 4);i19abc++){
+if((((i19abc + (v0abcd * i19abc)) == -(v0abcd)) || v0abcd)){
+fio::println(i19abc);
+v0abcd = (v0abcd * ((19 + 58) == (26 >= f7abcd(59))));
+v0abcd = i19abc;
+int v20abc = (i19abc + ((v0abcd + i19abc) * (f2abcd(5) > i19abc)));
+v0abcd = (((v0abcd * i19abc) + v20abc) == ((f0abcd(v0abcd) / 3) / 8));
+}
+int c21abc = 2;
+while((c21abc > 0)){
+fio::println(v0abcd);
+int v22abc = ((77 / 5) < (i19abc - f5abcd(f1abcd(c21abc),46,c21abc)));
+v0abcd = ((f6abcd((c21abc && 25)) - (80 * v22abc)) == v0abcd);
+int v23abc = ((((71 > c21abc) + v22abc) + f1abcd(v22abc)) >= ((i19abc * v0abcd) + 76));
+fio::println(i19abc);
+c21abc = (c21abc - 1);
+}
+}
+int v24abc = (v0abcd || (((f7abcd(v0abcd) * v0abcd) - f2abcd(v0abcd)) - v0abcd));
+v24abc = ((v0abcd * (v24abc / 9)) + ((v0abcd || 45) || (v24abc >= 3)));
+}
+int v25abc = (v0abcd / 3);
+int v26abc = (((57 - 30) < (-(54) * v0abcd)) > (v25abc / 4));
+return f3abcd(-((v25abc / 2)));
+}
+
+int f9abcd(int p0abcd){
+for(int i0abcd = 0; i0abcd < 4; i0abcd++){
+for(int i1abcd = 0; i1abcd < 3; i1abcd++){
+int v2abcd = p0abcd;
+int v3abcd = ((v2abcd + 28) || (f8abcd() + p0abcd));
+int v4abcd = 0;
+int v5abcd = 85;
+};
+};
+f3abcd((p0abcd && (32 * p0abcd)));
+p0abcd = (((14 / 2) == (p0abcd < 15)) && (((p0abcd - p0abcd) - p0abcd) + p0abcd));
+return ((p0abcd - 52) - (51 <= 43));
+}
+
+int f10abc(int p0abcd){
+int v0abcd = 82;
+fio::println(v0abcd);
+fio::println(v0abcd);
+int v1abcd = ((v0abcd - 17) + ((p0abcd == v0abcd) / 3));
+int c2abcd = 2;
+while((c2abcd > 0)){
+v1abcd = (v1abcd && ((v1abcd - (f8abcd() / 4)) >= ((v0abcd + 33) == (72 + v0abcd))));
+int c3abcd = 4;
+while((c3abcd > 0)){
+int v4abcd = 91;
+c3abcd = (c3abcd - 1);
+}
+if((((p0abcd - v1abcd) - 11) != c2abcd)){
+f0abcd((((15 - f8abcd()) - 0) || v1abcd));
+int v5abcd = -((55 - (38 / 7)));
+int v6abcd = (((91 + (c3abcd * c3abcd)) < (f4abcd(90,14,p0abcd) * 17)) != 88);
+f6abcd((p0abcd != (v0abcd + 63)));
+}
+int v7abcd = c3abcd;
+c2abcd = (c2abcd - 1);
+}
+return (((p0abcd + c2abcd) >= v1abcd) / 3);
+}
+
+int f11abc(int p0abcd,int p1abcd){
+int v0abcd = p1abcd;
+p1abcd = (20 || (((14 - p0abcd) - p0abcd) < (61 * 23)));
+f5abcd((((p0abcd + 90) <= p0abcd) == v0abcd),(p1abcd || (f7abcd(v0abcd) * 11)),((80 / 2) - 6));
+return (v0abcd + ((p1abcd + 63) - (v0abcd / 8)));
+}
+
+int f12abc(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = ((p1abcd - (p2abcd * 54)) / 3);
+int v1abcd = (((-(39) / 8) + (74 * v0abcd)) >= 7);
+int c2abcd = 2;
+while((c2abcd > 0)){
+f1abcd(31);
+if((c2abcd >= v1abcd)){
+int c3abcd = 1;
+while((c3abcd > 0)){
+int v4abcd = c3abcd;
+c3abcd = (c3abcd - 1);
+}
+for(int i5abcd = 0; i5abcd < 4; i5abcd++){
+int v6abcd = v1abcd;
+int v7abcd = (57 == ((c2abcd + v0abcd) < ((7 + 35) + 88)));
+v6abcd = (((69 - -(p1abcd)) + c2abcd) || ((p2abcd + 86) && c3abcd));
+int v8abcd = (94 != ((((26 * 17) * p1abcd) + (p1abcd - 70)) + c3abcd));
+};
+} else {
+f4abcd((((c2abcd - v1abcd) != p2abcd) && p2abcd),((p0abcd * p2abcd) >= p0abcd),13);
+int v9abcd = 84;
+if((((v9abcd + v0abcd) + 0) < p1abcd)){
+f3abcd(p2abcd);
+int v10abc = (87 - -(p1abcd));
+}
+p0abcd = v0abcd;
+int c11abc = 3;
+while((c11abc > 0)){
+v9abcd = v1abcd;
+int v12abc = (50 != (c11abc - ((p1abcd * p1abcd) * (v9abcd || p1abcd))));
+int v13abc = (((23 + c2abcd) + 76) - (30 && (54 > (72 * v1abcd))));
+int v14abc = (v0abcd / 1);
+int v15abc = p2abcd;
+int v16abc = ((v1abcd && (v14abc / 8)) || p2abcd);
+c11abc = (c11abc - 1);
+}
+for(int i17abc = 0; i17abc < 4; i17abc++){
+v1abcd = (((v9abcd < c2abcd) < 16) || (89 < (p0abcd + v9abcd)));
+};
+}
+if(((v1abcd + 9) || ((v0abcd / 5) > (v0abcd / 5)))){
+int v18abc = v1abcd;
+for(int i19abc = 0;(i19abc < 2);i19abc++){
+int v20abc = ((((p1abcd * v0abcd) / 7) && !(96)) && (p1abcd * i19abc));
+}
+for(int i21abc = 0;(i21abc < 2);i21abc++){
+int v22abc = -(((f11abc(p0abcd,28) + c2abcd) != (v1abcd * 74)));
+fio::println(v0abcd);
+}
+int v23abc = -(((v0abcd - 64) + (28 - f2abcd(v18abc))));
+} else {
+f3abcd(((p0abcd * f11abc(v1abcd,56)) <= (10 + c2abcd)));
+}
+int v24abc = p1abcd;
+p0abcd = p0abcd;
+int v25abc = ((((f4abcd(86,v0abcd,v24abc) * p2abcd) - v1abcd) + f8abcd()) <= ((31 + f5abcd(v1abcd,4,42)) + v1abcd));
+c2abcd = (c2abcd - 1);
+}
+for(int i26abc = 0;(i26abc < 3);i26abc++){
+for(int i27abc = 0;(i27abc < 1);i27abc++){
+p1abcd = (v0abcd && !((v0abcd + p1abcd)));
+v0abcd = (!(65) || !((v0abcd < f4abcd(98,v0abcd,c2abcd))));
+if((p2abcd >= ((i26abc + i26abc) - (c2abcd / 2)))){
+int v28abc = p1abcd;
+int v29abc = p1abcd;
+int v30abc = p1abcd;
+f1abcd((97 + p0abcd));
+fio::println(v30abc);
+}
+int v31abc = ((3 + p1abcd) - (((89 * v1abcd) / 1) / 4));
+f3abcd((v31abc * p0abcd));
+f7abcd(51);
+}
+for(int i32abc = 0;(i32abc < 3);i32abc++){
+p1abcd = (((i32abc - 27) == 95) && (76 - ((13 == p0abcd) * (i26abc > 72))));
+fio::println(p2abcd);
+int c33abc = 4;
+while((c33abc > 0)){
+int v34abc = i32abc;
+int v35abc = f6abcd(((v0abcd * 72) - !(88)));
+int v36abc = (((v1abcd == p1abcd) * (77 / 7)) - !(39));
+c33abc = (c33abc - 1);
+}
+int c37abc = 1;
+while((c37abc > 0)){
+int v38abc = ((v0abcd / 2) + ((p1abcd * i32abc) / 8));
+f9abcd(12);
+f7abcd((5 || (p0abcd * -(v1abcd))));
+int v39abc = ((((61 + 70) - p0abcd) - c2abcd) + c2abcd);
+f11abc(((v0abcd / 9) - (v0abcd / 5)),f6abcd((v38abc - p0abcd)));
+int v40abc = (v39abc == ((f8abcd() * c33abc) * 71));
+c37abc = (c37abc - 1);
+}
+p0abcd = (((c2abcd == (p2abcd / 8)) + i32abc) != (63 && 43));
+}
+int v41abc = ((((p2abcd - p1abcd) - p1abcd) + ((20 * c2abcd) * p1abcd)) + (c2abcd * p0abcd));
+fio::println(p2abcd);
+}
+for(int i42abc = 0; i42abc < 1; i42abc++){
+f9abcd((p0abcd < (69 * !(50))));
+for(int i43abc = 0;(i43abc < 2);i43abc++){
+if(((!(p2abcd) != (49 > i43abc)) < (34 + (37 / 9)))){
+f3abcd(46);
+f7abcd(((i43abc / 2) <= v0abcd));
+v0abcd = (((48 + v0abcd) > (62 + p1abcd)) && (((59 / 3) + 93) || p1abcd));
+int v44abc = ((23 * -(v0abcd)) - (f2abcd(p2abcd) * c2abcd));
+}
+}
+f2abcd(-((c2abcd * p1abcd)));
+if((11 == (((f7abcd(p1abcd) * (f0abcd(i42abc) - i42abc)) >= p0abcd) <= (i42abc / 8)))){
+if((i42abc > (p1abcd && (p2abcd / 7)))){
+int v45abc = p2abcd;
+int v46abc = (((((v1abcd + f3abcd(78)) - p1abcd) + 11) == 88) || (82 + 33));
+f9abcd((p2abcd / 8));
+fio::println(p0abcd);
+p1abcd = ((v1abcd / 7) < i42abc);
+int v47abc = (48 <= (((((c2abcd * p0abcd) + v1abcd) - i42abc) - f10abc(46)) + (i42abc * f2abcd(44))));
+} else {
+fio::println(p2abcd);
+}
+int v48abc = ((55 + (f10abc(v1abcd) && c2abcd)) + p1abcd);
+for(int i49abc = 0;(i49abc < 2);i49abc++){
+int v50abc = (((89 - v0abcd) + v0abcd) || (i49abc < p2abcd));
+f6abcd((98 > f10abc(v50abc)));
+f8abcd();
+}
+} else {
+if(((p0abcd - 71) && ((p1abcd - p2abcd) > v1abcd))){
+int v51abc = (78 + (p2abcd < (6 / 2)));
+} else {
+int v52abc = p0abcd;
+int v53abc = (p0abcd - p0abcd);
+}
+for(int i54abc = 0;(i54abc < 1);i54abc++){
+fio::println(v1abcd);
+int v55abc = v0abcd;
+}
+int v56abc = -(((80 * p2abcd) / 9));
+if(((77 + i42abc) > (69 / 7))){
+fio::println(i42abc);
+int v57abc = ((p0abcd >= 55) >= ((38 * c2abcd) / 3));
+v0abcd = (((f7abcd(!(v57abc)) > v56abc) || 81) || (f4abcd(54,c2abcd,74) + 57));
+}
+for(int i58abc = 0;(i58abc < 4);i58abc++){
+int v59abc = 20;
+int v60abc = f0abcd(f7abcd((v59abc - 85)));
+int v61abc = i58abc;
+int v62abc = 14;
+}
+}
+p1abcd = 40;
+};
+int c63abc = 4;
+while((c63abc > 0)){
+if((((54 - 32) < (f11abc(p0abcd,p1abcd) - 4)) < (v0abcd * c2abcd))){
+for(int i64abc = 0; i64abc < 4; i64abc++){
+v1abcd = -(((p1abcd - v1abcd) && 89));
+fio::println(c63abc);
+fio::println(p2abcd);
+f0abcd(((p0abcd + 93) - c63abc));
+int v65abc = ((c63abc / 4) <= 13);
+f2abcd(63);
+};
+int c66abc = 3;
+while((c66abc > 0)){
+f8abcd();
+c66abc = (c66abc - 1);
+}
+int c67abc = 4;
+while((c67abc > 0)){
+int v68abc = (c67abc < ((c67abc + v1abcd) + -(v0abcd)));
+f1abcd(((v0abcd + f1abcd(v1abcd)) / 4));
+v68abc = -(59);
+f2abcd(((v1abcd + c67abc) && (17 != 80)));
+v1abcd = p0abcd;
+c67abc = (c67abc - 1);
+}
+}
+fio::println(p1abcd);
+int v69abc = ((((46 || ((3 - 78) - 91)) * 9) / 2) + (51 * v1abcd));
+int c70abc = 3;
+while((c70abc > 0)){
+for(int i71abc = 0;(i71abc < 3);i71abc++){
+int v72abc = ((v0abcd * (49 != 95)) / 9);
+int v73abc = (p1abcd / 4);
+}
+if(((47 + c70abc) >= 17)){
+fio::println(v69abc);
+f6abcd(((p2abcd - 26) < (c70abc * f8abcd())));
+f4abcd(10,v0abcd,(((c70abc + 1) + 98) > c70abc));
+} else {
+fio::println(c2abcd);
+f10abc(((p1abcd * v69abc) && (p0abcd < p0abcd)));
+fio::println(v0abcd);
+f1abcd(p2abcd);
+}
+v69abc = ((p2abcd + p2abcd) == ((((94 - c63abc) * 30) <= p1abcd) <= (v69abc + 94)));
+int v74abc = (f11abc((v1abcd * 95),(f9abcd(c70abc) / 5)) + ((v1abcd - c63abc) != 51));
+c70abc = (c70abc - 1);
+}
+fio::println(p1abcd);
+c63abc = (c63abc - 1);
+}
+return ((f6abcd(8) / 4) + (((84 / 5) * f1abcd(14)) == 21));
+}
+
+int f13abc(int p0abcd,int p1abcd){
+f6abcd((-(17) - f9abcd(35)));
+f10abc(f7abcd(!(p1abcd)));
+return -(71);
+}
+
+int f14abc(){
+for(int i0abcd = 0;(i0abcd < 4);i0abcd++){
+int v1abcd = ((f4abcd(80,i0abcd,i0abcd) * i0abcd) <= (i0abcd / 9));
+for(int i2abcd = 0; i2abcd < 1; i2abcd++){
+if(((f13abc(f10abc(v1abcd),15) / 3) == (3 + i2abcd))){
+f3abcd((((i2abcd - i2abcd) - f1abcd(72)) + i2abcd));
+int v3abcd = (((63 >= (i2abcd + (i0abcd * i0abcd))) != (94 <= (83 + i2abcd))) != 29);
+v3abcd = (22 + 50);
+int v4abcd = (f11abc((v1abcd * v3abcd),(v3abcd > 16)) < ((74 == v3abcd) / 1));
+int v5abcd = 76;
+int v6abcd = 55;
+}
+};
+v1abcd = i0abcd;
+for(int i7abcd = 0;(i7abcd < 1);i7abcd++){
+if(((i7abcd < ((93 - 73) + v1abcd)) >= 40)){
+int v8abcd = (i7abcd <= 78);
+int v9abcd = (v1abcd == ((-(i7abcd) * (f7abcd(v1abcd) + v1abcd)) + (v8abcd - 81)));
+v1abcd = i0abcd;
+f11abc((2 + !(76)),((v8abcd - v9abcd) <= f4abcd(14,i7abcd,v9abcd)));
+int v10abc = (!((v8abcd <= 34)) * 92);
+}
+for(int i11abc = 0;(i11abc < 4);i11abc++){
+int v12abc = ((i0abcd - 12) - f12abc(v1abcd,i11abc,i11abc));
+int v13abc = ((49 - -(v12abc)) - !(v1abcd));
+int v14abc = (((f10abc(v13abc) - (v1abcd * v13abc)) >= (f1abcd(i7abcd) * 49)) < 60);
+v14abc = (i0abcd > ((v13abc - v13abc) + -(13)));
+}
+f8abcd();
+}
+}
+int v15abc = (26 - -(1));
+fio::println(v15abc);
+if((v15abc < 48)){
+for(int i16abc = 0; i16abc < 3; i16abc++){
+int c17abc = 1;
+while((c17abc > 0)){
+int v18abc = -(((c17abc || v15abc) + i16abc));
+fio::println(v18abc);
+int v19abc = ((-(i16abc) / 5) + f3abcd((c17abc <= v15abc)));
+c17abc = (c17abc - 1);
+}
+f4abcd(i16abc,(((30 - f7abcd(v15abc)) + 17) > i16abc),((26 && 76) < 82));
+int c20abc = 4;
+while((c20abc > 0)){
+v15abc = ((67 * i16abc) - (25 / 5));
+f8abcd();
+fio::println(v15abc);
+int v21abc = ((!(c20abc) - (!(77) * f6abcd(c20abc))) - (c20abc * c20abc));
+int v22abc = (((c17abc * !(c20abc)) * v21abc) && c20abc);
+c20abc = (c20abc - 1);
+}
+v15abc = v15abc;
+int c23abc = 3;
+while((c23abc > 0)){
+v15abc = (57 + 6);
+c23abc = (c23abc - 1);
+}
+};
+fio::println(v15abc);
+int v24abc = ((((v15abc + 27) + (v15abc - v15abc)) != v15abc) && (v15abc <= -(v15abc)));
+}
+return !((((f8abcd() - 82) + f4abcd(92,v15abc,33)) <= v15abc));
+}
+
+int f15abc(int p0abcd){
+int v0abcd = p0abcd;
+if(((2 != (p0abcd + !(36))) > p0abcd)){
+if(((v0abcd + (5 / 7)) >= f5abcd((21 - v0abcd),(p0abcd + p0abcd),35))){
+fio::println(v0abcd);
+if((93 == (9 && ((v0abcd * 64) / 7)))){
+int v1abcd = ((v0abcd * v0abcd) + ((f9abcd(v0abcd) / 4) / 7));
+int v2abcd = p0abcd;
+int v3abcd = ((((11 - 85) * 8) >= 93) - (81 * -(5)));
+int v4abcd = ((2 + (f2abcd(v1abcd) / 2)) == v0abcd);
+}
+} else {
+fio::println(v0abcd);
+int v5abcd = ((v0abcd || v0abcd) <= ((p0abcd > (v0abcd - v0abcd)) <= v0abcd));
+}
+int v6abcd = -((((22 * 54) + f0abcd(p0abcd)) <= v0abcd));
+if(((((44 && p0abcd) * v0abcd) * v6abcd) >= v0abcd)){
+int c7abcd = 3;
+while((c7abcd > 0)){
+p0abcd = -(((p0abcd / 9) || !(30)));
+v0abcd = (!((c7abcd + v0abcd)) / 6);
+c7abcd = (c7abcd - 1);
+}
+for(int i8abcd = 0;(i8abcd < 4);i8abcd++){
+fio::println(v6abcd);
+int v9abcd = (((f3abcd(p0abcd) > (((f13abc(c7abcd,v6abcd) + (85 / 2)) - c7abcd) + v0abcd)) > v6abcd) != i8abcd);
+}
+int v10abc = ((((v0abcd + v6abcd) - (p0abcd - 54)) < 68) >= 48);
+int v11abc = -(f9abcd(v10abc));
+v11abc = (c7abcd == v11abc);
+if((((f3abcd(v11abc) || v0abcd) == p0abcd) || (f9abcd(v6abcd) > p0abcd))){
+int v12abc = (((p0abcd * 34) - (v11abc * 30)) != (v6abcd * v11abc));
+int v13abc = ((15 == v12abc) != (c7abcd >= (v6abcd / 6)));
+int v14abc = ((v13abc + c7abcd) || (((66 + 24) + c7abcd) + (f7abcd(p0abcd) == f2abcd(v13abc))));
+v11abc = 34;
+}
+} else {
+f3abcd(((95 * 95) * 4));
+}
+for(int i15abc = 0;(i15abc < 4);i15abc++){
+for(int i16abc = 0; i16abc < 4; i16abc++){
+int v17abc = p0abcd;
+int v18abc = 91;
+p0abcd = -(((v17abc - (p0abcd * 91)) - v17abc));
+fio::println(p0abcd);
+f5abcd(3,(f5abcd(v18abc,v6abcd,f1abcd(i15abc)) * v17abc),((39 - i15abc) / 8));
+int v19abc = (p0abcd && (i15abc == (f12abc(46,v17abc,54) / 4)));
+};
+}
+} else {
+int c20abc = 3;
+while((c20abc > 0)){
+int c21abc = 3;
+while((c21abc > 0)){
+p0abcd = p0abcd;
+v0abcd = 97;
+int v22abc = f12abc(((v0abcd || c20abc) + (70 * c20abc)),74,((c21abc * c21abc) + c21abc));
+int v23abc = (v0abcd - (32 * (64 >= (c20abc * 8))));
+int v24abc = (-(v23abc) == 18);
+c21abc = (c21abc - 1);
+}
+int v25abc = 48;
+int v26abc = (((87 - 24) * 46) || (p0abcd > 35));
+fio::println(v25abc);
+if(((59 > (41 - (c20abc != p0abcd))) <= ((56 * 3) / 8))){
+int v27abc = ((23 / 3) > ((-(p0abcd) - v25abc) + v0abcd));
+v0abcd = 23;
+int v28abc = (v26abc != ((v25abc * 65) / 9));
+f3abcd(((77 * p0abcd) && v28abc));
+} else {
+int v29abc = (26 || -((70 + f14abc())));
+fio::println(p0abcd);
+p0abcd = ((v26abc + v26abc) == (v0abcd / 2));
+int v30abc = ((c21abc * v0abcd) != c21abc);
+f8abcd();
+int v31abc = !(36);
+}
+c20abc = (c20abc - 1);
+}
+int v32abc = v0abcd;
+}
+p0abcd = 69;
+int c33abc = 3;
+while((c33abc > 0)){
+for(int i34abc = 0;(i34abc < 3);i34abc++){
+int v35abc = !(p0abcd);
+for(int i36abc = 0; i36abc < 1; i36abc++){
+fio::println(c33abc);
+int v37abc = (i36abc && (i34abc * (81 + i36abc)));
+int v38abc = ((((i34abc && i34abc) / 9) || v35abc) || i36abc);
+int v39abc = (((8 / 7) / 5) / 3);
+fio::println(p0abcd);
+fio::println(p0abcd);
+};
+f13abc((3 * 12),((v35abc + v35abc) == (v35abc * v0abcd)));
+if(((((23 * 5) * 70) + v0abcd) != ((52 * v35abc) * 90))){
+int v40abc = (v35abc > i34abc);
+int v41abc = ((77 + (i34abc / 7)) || 13);
+v0abcd = ((62 - i34abc) < (c33abc - (p0abcd / 1)));
+int v42abc = (!(!(v35abc)) - (v40abc * (v40abc * c33abc)));
+int v43abc = (((94 != 39) / 6) - ((93 / 8) * 68));
+fio::println(p0abcd);
+}
+int c44abc = 1;
+while((c44abc > 0)){
+p0abcd = (((i34abc * c44abc) - c44abc) || (75 * 29));
+c44abc = (c44abc - 1);
+}
+f8abcd();
+}
+for(int i45abc = 0; i45abc < 4; i45abc++){
+if(((24 <= 47) >= ((i45abc - p0abcd) + c33abc))){
+int v46abc = (((c33abc == (81 + p0abcd)) * (v0abcd - 89)) - (p0abcd - 94));
+int v47abc = ((-(v0abcd) * 99) && ((v46abc * v46abc) < (f14abc() + v0abcd)));
+int v48abc = v46abc;
+int v49abc = (32 >= ((69 - 9) - p0abcd));
+} else {
+int v50abc = (((v0abcd / 3) * c33abc) / 3);
+fio::println(i45abc);
+}
+int v51abc = f8abcd();
+for(int i52abc = 0; i52abc < 2; i52abc++){
+f2abcd(-(c33abc));
+};
+};
+if((((88 > 4) * !(9)) != (p0abcd < (c33abc * -(p0abcd))))){
+for(int i53abc = 0;(i53abc < 4);i53abc++){
+int v54abc = ((f12abc(i53abc,p0abcd,i53abc) && (v0abcd == (c33abc / 5))) - i53abc);
+f8abcd();
+v0abcd = p0abcd;
+v0abcd = -(((97 / 1) * p0abcd));
+int v55abc = (97 / 5);
+}
+for(int i56abc = 0; i56abc < 2; i56abc++){
+f3abcd(((i56abc - p0abcd) && v0abcd));
+f8abcd();
+f8abcd();
+f4abcd(((c33abc - (p0abcd * c33abc)) + i56abc),99,v0abcd);
+int v57abc = (f12abc(9,85,(c33abc || p0abcd)) || (34 || (v0abcd / 1)));
+};
+}
+p0abcd = ((((36 / 4) + v0abcd) && c33abc) / 4);
+int v58abc = (80 || (f3abcd(81) && ((p0abcd * c33abc) + c33abc)));
+c33abc = (c33abc - 1);
+}
+return ((((46 + 21) - c33abc) - v0abcd) && f14abc());
+}
+
+int f16abc(){
+int v0abcd = (84 >= 5);
+v0abcd = (v0abcd || (0 <= (v0abcd || v0abcd)));
+int v1abcd = v0abcd;
+int v2abcd = ((2 + (v0abcd * 34)) < (v1abcd - (v1abcd * 1)));
+return (-(-(v1abcd)) * v1abcd);
+}
+
+int f17abc(){
+int v0abcd = ((86 + 56) + (56 / 2));
+return (((38 * 34) * 56) * (v0abcd * v0abcd));
+}
+
+int f18abc(int p0abcd,int p1abcd){
+fio::println(p0abcd);
+p0abcd = -((!(p1abcd) <= (43 * p1abcd)));
+for(int i0abcd = 0;(i0abcd < 3);i0abcd++){
+if(((((i0abcd / 8) - 79) <= p0abcd) >= 4)){
+int v1abcd = (((((i0abcd / 3) > f17abc()) || p0abcd) || ((p0abcd + p1abcd) + 97)) || i0abcd);
+int c2abcd = 4;
+while((c2abcd > 0)){
+int v3abcd = (((!(c2abcd) <= p0abcd) < (i0abcd - v1abcd)) || (56 && (p0abcd > p1abcd)));
+f4abcd(((p1abcd - p1abcd) * 38),(37 + 91),(((4 <= 68) + c2abcd) + 6));
+c2abcd = (c2abcd - 1);
+}
+int v4abcd = 98;
+} else {
+f8abcd();
+f16abc();
+p1abcd = 51;
+for(int i5abcd = 0; i5abcd < 4; i5abcd++){
+int v6abcd = (((5 + 45) + i5abcd) < (p0abcd + (82 == i5abcd)));
+p1abcd = ((i5abcd == f6abcd(54)) || (i5abcd < !(p1abcd)));
+int v7abcd = ((i5abcd + v6abcd) - 80);
+f0abcd((v7abcd / 8));
+int v8abcd = ((-((96 * i5abcd)) <= (p0abcd - 46)) >= (i0abcd - p0abcd));
+int v9abcd = v6abcd;
+};
+}
+int v10abc = i0abcd;
+}
+int c11abc = 2;
+while((c11abc > 0)){
+p1abcd = ((-(72) - (f14abc() * c11abc)) <= -((f3abcd(c11abc) <= 60)));
+for(int i12abc = 0; i12abc < 1; i12abc++){
+int v13abc = p0abcd;
+for(int i14abc = 0;(i14abc < 3);i14abc++){
+fio::println(p1abcd);
+f10abc(66);
+p1abcd = ((f14abc() * (v13abc > c11abc)) - -((p1abcd / 4)));
+int v15abc = (-(i14abc) && ((i14abc - p0abcd) < (78 - (24 - 55))));
+p0abcd = (54 - !((18 - 93)));
+}
+fio::println(v13abc);
+};
+for(int i16abc = 0;(i16abc < 4);i16abc++){
+for(int i17abc = 0; i17abc < 2; i17abc++){
+int v18abc = 1;
+};
+for(int i19abc = 0; i19abc < 2; i19abc++){
+fio::println(i19abc);
+f8abcd();
+int v20abc = p1abcd;
+};
+int v21abc = (((f5abcd(p1abcd,84,2) + f3abcd(p1abcd)) - (p1abcd * 84)) - (i16abc == c11abc));
+int c22abc = 3;
+while((c22abc > 0)){
+v21abc = (((((v21abc + 1) >= (p1abcd + c22abc)) < 49) != p1abcd) && 96);
+c22abc = (c22abc - 1);
+}
+for(int i23abc = 0;(i23abc < 1);i23abc++){
+fio::println(i23abc);
+int v24abc = (52 < 21);
+int v25abc = p0abcd;
+v21abc = ((((p0abcd / 9) - 84) >= ((42 + 55) - c11abc)) == (i16abc * i16abc));
+}
+if(((i16abc >= (c22abc * p1abcd)) >= 57)){
+int v26abc = (86 || (c11abc && (f3abcd(i16abc) + v21abc)));
+int v27abc = ((!(p1abcd) < i16abc) && (32 / 1));
+int v28abc = (((v21abc <= v27abc) && 80) - -((61 == 39)));
+fio::println(v26abc);
+v26abc = (((p1abcd + f4abcd(v28abc,41,i16abc)) + 14) - (v28abc * c22abc));
+int v29abc = 62;
+}
+}
+int v30abc = (((f17abc() - 85) - c11abc) + -((p1abcd - 88)));
+int v31abc = 97;
+c11abc = (c11abc - 1);
+}
+for(int i32abc = 0;(i32abc < 3);i32abc++){
+if(((((47 + p1abcd) <= (22 + c11abc)) < p0abcd) || (p0abcd + (f11abc(41,p0abcd) * c11abc)))){
+p1abcd = ((p1abcd * p1abcd) == (56 + p0abcd));
+fio::println(p0abcd);
+f9abcd(f15abc(p1abcd));
+fio::println(c11abc);
+if((c11abc != ((p1abcd - (64 / 3)) < f11abc((f2abcd(p0abcd) && p1abcd),(c11abc * i32abc))))){
+f3abcd(f5abcd(i32abc,(p0abcd * i32abc),(p1abcd * 35)));
+f3abcd((p1abcd && (79 != i32abc)));
+p0abcd = p0abcd;
+fio::println(c11abc);
+int v33abc = !(!((p1abcd < 10)));
+} else {
+int v34abc = -((p0abcd || (12 - (p0abcd * p1abcd))));
+}
+int v35abc = ((c11abc - c11abc) > (24 - p1abcd));
+} else {
+p0abcd = ((((p1abcd == i32abc) != p0abcd) + i32abc) && ((89 * 46) <= f10abc(6)));
+fio::println(c11abc);
+}
+int v36abc = (((p0abcd / 7) + 29) / 4);
+v36abc = (25 - !((i32abc + i32abc)));
+}
+return 81;
+}
+
+int f19abc(int p0abcd){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+p0abcd = p0abcd;
+f17abc();
+};
+return (((4 * p0abcd) + 77) <= (p0abcd + 74));
+}
+
+int f20abc(int p0abcd,int p1abcd){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+p1abcd = ((p1abcd <= (p1abcd * (73 - p1abcd))) / 7);
+fio::println(i0abcd);
+};
+int v1abcd = !(p0abcd);
+return (((p1abcd + 83) + 89) + (p1abcd >= (27 - p1abcd)));
+}
+
+int f21abc(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0;(i0abcd < 3);i0abcd++){
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+f12abc(p2abcd,(65 * (p2abcd + 50)),!((24 * p1abcd)));
+for(int i2abcd = 0; i2abcd < 4; i2abcd++){
+int v3abcd = (((p1abcd - p1abcd) + p1abcd) != ((f4abcd(50,98,p1abcd) - f5abcd(27,p0abcd,1)) - i2abcd));
+int v4abcd = (((p0abcd - v3abcd) == (f9abcd(30) && 77)) + v3abcd);
+int v5abcd = 53;
+int v6abcd = -(31);
+int v7abcd = (34 < p0abcd);
+f17abc();
+};
+int v8abcd = ((p2abcd && (p0abcd / 9)) != 1);
+fio::println(p1abcd);
+}
+int v9abcd = (p0abcd == (i0abcd < (p2abcd - 31)));
+int v10abc = (-(64) && 5);
+int v11abc = (i0abcd / 1);
+int v12abc = (((v11abc - v11abc) + p0abcd) + p2abcd);
+for(int i13abc = 0; i13abc < 4; i13abc++){
+int c14abc = 4;
+while((c14abc > 0)){
+int v15abc = ((f18abc(79,80) > i13abc) || (v11abc / 1));
+c14abc = (c14abc - 1);
+}
+int v16abc = ((87 - v11abc) - 19);
+p1abcd = ((v11abc + (v16abc * p1abcd)) + i13abc);
+for(int i17abc = 0;(i17abc < 1);i17abc++){
+int v18abc = (((9 / 4) / 2) - (p1abcd * (i13abc + c14abc)));
+int v19abc = p1abcd;
+int v20abc = ((90 && (c14abc - (v12abc * i13abc))) + f11abc(-(f9abcd(41)),(84 - 34)));
+}
+};
+}
+return ((34 * 75) - (p2abcd * -(p0abcd)));
+}
+
+int f22abc(int p0abcd,int p1abcd){
+int v0abcd = (((p1abcd - 36) >= (((p1abcd && p1abcd) - f7abcd(p0abcd)) - f10abc(2))) > 27);
+int v1abcd = (((32 * p0abcd) + p1abcd) != (p0abcd * (p1abcd - f2abcd(p1abcd))));
+int c2abcd = 4;
+while((c2abcd > 0)){
+for(int i3abcd = 0;(i3abcd < 3);i3abcd++){
+p0abcd = (((v0abcd - (i3abcd * p0abcd)) < 2) + c2abcd);
+for(int i4abcd = 0; i4abcd < 4; i4abcd++){
+int v5abcd = ((v1abcd - c2abcd) <= (90 + v1abcd));
+fio::println(v5abcd);
+};
+int v6abcd = i3abcd;
+}
+c2abcd = (c2abcd - 1);
+}
+if((((v1abcd * 46) / 1) == (((v1abcd <= f5abcd(v1abcd,1,c2abcd)) * p0abcd) > p0abcd))){
+int v7abcd = (!((p1abcd * v1abcd)) != v1abcd);
+fio::println(p1abcd);
+p1abcd = (((c2abcd + p1abcd) - 38) || !(v0abcd));
+} else {
+fio::println(v0abcd);
+int v8abcd = (f5abcd((v1abcd / 3),(v1abcd * 58),(v1abcd < f5abcd(8,10,45))) && ((37 * 25) / 6));
+if(((0 <= (62 - v8abcd)) >= v1abcd)){
+f21abc(!((17 * v1abcd)),p1abcd,c2abcd);
+int v9abcd = (((2 < f19abc(c2abcd)) < f15abc(56)) >= (p0abcd / 9));
+for(int i10abc = 0; i10abc < 3; i10abc++){
+int v11abc = 27;
+f12abc(((p0abcd + v0abcd) < (p1abcd + v9abcd)),((f6abcd(19) / 3) != (41 / 6)),((v11abc * v9abcd) > f10abc(v11abc)));
+fio::println(v8abcd);
+p0abcd = 23;
+int v12abc = v11abc;
+};
+} else {
+int v13abc = (((78 * p1abcd) <= (((76 - 29) - p1abcd) + v1abcd)) >= (p0abcd / 5));
+fio::println(v13abc);
+fio::println(v0abcd);
+}
+}
+return (((41 > f17abc()) * c2abcd) / 1);
+}
+
+int f23abc(){
+f2abcd((44 <= (f11abc(38,86) * (10 && 38))));
+f17abc();
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+int v1abcd = ((!(77) + (i0abcd == i0abcd)) + 69);
+int v2abcd = ((f14abc() && (42 / 1)) + i0abcd);
+for(int i3abcd = 0;(i3abcd < 4);i3abcd++){
+for(int i4abcd = 0; i4abcd < 2; i4abcd++){
+int v5abcd = (((i4abcd && v1abcd) / 9) && !(v2abcd));
+fio::println(v2abcd);
+int v6abcd = (((v1abcd > 2) >= (i3abcd - i3abcd)) || (i0abcd > i4abcd));
+int v7abcd = 52;
+};
+for(int i8abcd = 0; i8abcd < 2; i8abcd++){
+f21abc(((59 < i8abcd) > (54 * 13)),((i3abcd - 69) - i3abcd),(((i0abcd < i0abcd) * f1abcd(v1abcd)) == v1abcd));
+int v9abcd = 2;
+};
+v1abcd = v1abcd;
+int v10abc = (v1abcd + 3);
+}
+for(int i11abc = 0; i11abc < 4; i11abc++){
+f21abc(((-(f12abc(i0abcd,30,18)) + 45) > v1abcd),!((v1abcd == i0abcd)),f6abcd((i11abc > f8abcd())));
+int v12abc = 70;
+v1abcd = ((v2abcd / 1) <= v2abcd);
+int v13abc = v2abcd;
+if((6 == !(i0abcd))){
+v1abcd = v13abc;
+fio::println(v12abc);
+int v14abc = ((f6abcd((v1abcd / 7)) * (i11abc + i0abcd)) >= v13abc);
+fio::println(v12abc);
+} else {
+int v15abc = ((v1abcd >= 19) || (34 - v13abc));
+int v16abc = (v13abc < ((f7abcd(i11abc) + 1) + ((20 * f16abc()) / 2)));
+f18abc(v16abc,v16abc);
+f17abc();
+v15abc = v15abc;
+int v17abc = ((((v16abc * f21abc(i0abcd,i11abc,44)) + 9) != v13abc) || ((88 / 2) * v15abc));
+}
+fio::println(v13abc);
+};
+};
+f10abc(61);
+return 82;
+}
+
+int f24abc(int p0abcd){
+for(int i0abcd = 0; i0abcd < 1; i0abcd++){
+int v1abcd = -((p0abcd > (i0abcd || p0abcd)));
+fio::println(p0abcd);
+p0abcd = (i0abcd / 9);
+};
+int v2abcd = (51 <= (p0abcd - (p0abcd * (((20 * f14abc()) * p0abcd) / 7))));
+return (-((p0abcd + p0abcd)) != (f13abc(p0abcd,p0abcd) / 3));
+}
+
+int f25abc(int p0abcd,int p1abcd){
+p0abcd = ((p0abcd <= 93) || (46 / 1));
+return 69;
+}
+
+int f26abc(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = ((-(!(86)) * p2abcd) > p0abcd);
+return p1abcd;
+}
+
+int f27abc(int p0abcd){
+int v0abcd = (((((p0abcd > f25abc(22,34)) != p0abcd) == (53 - p0abcd)) && p0abcd) || 50);
+return v0abcd;
+}
+
+int f28abc(int p0abcd){
+for(int i0abcd = 0;(i0abcd < 1);i0abcd++){
+fio::println(p0abcd);
+for(int i1abcd = 0;(i1abcd < 3);i1abcd++){
+int c2abcd = 1;
+while((c2abcd > 0)){
+f14abc();
+c2abcd = (c2abcd - 1);
+}
+int c3abcd = 3;
+while((c3abcd > 0)){
+fio::println(c3abcd);
+int v4abcd = c3abcd;
+fio::println(i0abcd);
+fio::println(i1abcd);
+c3abcd = (c3abcd - 1);
+}
+f27abc(((c2abcd * 12) < (19 - p0abcd)));
+int c5abcd = 1;
+while((c5abcd > 0)){
+int v6abcd = (((((c5abcd * 67) * i1abcd) >= c2abcd) + 87) - f27abc(c5abcd));
+p0abcd = (f19abc((c3abcd >= c3abcd)) || (((c5abcd / 1) * p0abcd) == i1abcd));
+f13abc((21 + (p0abcd * v6abcd)),i0abcd);
+c5abcd = (c5abcd - 1);
+}
+}
+for(int i7abcd = 0; i7abcd < 2; i7abcd++){
+if(((p0abcd + p0abcd) && ((77 * 78) <= -((i7abcd - 34))))){
+int v8abcd = ((i0abcd || (i0abcd > p0abcd)) >= (-(f26abc(i0abcd,p0abcd,12)) + (i7abcd / 2)));
+fio::println(p0abcd);
+int v9abcd = p0abcd;
+int v10abc = 56;
+int v11abc = 94;
+int v12abc = (((!(5) * v8abcd) < 35) == ((v10abc - i0abcd) - i0abcd));
+} else {
+int v13abc = (i0abcd - ((i7abcd * (72 - i0abcd)) / 5));
+int v14abc = !((v13abc != !(79)));
+int v15abc = 46;
+int v16abc = v15abc;
+}
+};
+int v17abc = -(((i0abcd * p0abcd) > (12 || p0abcd)));
+for(int i18abc = 0; i18abc < 2; i18abc++){
+p0abcd = 76;
+f1abcd(i18abc);
+int v19abc = 69;
+for(int i20abc = 0; i20abc < 3; i20abc++){
+int v21abc = ((v19abc + i18abc) / 7);
+int v22abc = ((39 && f8abcd()) - (v19abc <= 28));
+fio::println(p0abcd);
+p0abcd = ((p0abcd * f6abcd(p0abcd)) - (32 && (85 - 70)));
+};
+p0abcd = ((42 / 2) < (!(f19abc(v19abc)) + i0abcd));
+};
+}
+p0abcd = 7;
+return ((p0abcd - p0abcd) + (56 / 2));
+}
+
+int f29abc(){
+int v0abcd = f24abc(((16 * 82) != (86 / 6)));
+for(int i1abcd = 0; i1abcd < 3; i1abcd++){
+int v2abcd = f7abcd((i1abcd - (59 + i1abcd)));
+fio::println(v0abcd);
+};
+return ((((v0abcd * v0abcd) - f10abc(7)) || v0abcd) <= ((93 + 12) < v0abcd));
+}
+
+int solve(int p0abcd){
+int v0abcd = (p0abcd || ((p0abcd - p0abcd) <= (5 - (64 > 49))));
+for(int i1abcd = 0; i1abcd < 2; i1abcd++){
+int v2abcd = (((p0abcd - p0abcd) >= (p0abcd || 7)) > (f28abc(11) - (86 * (i1abcd / 7))));
+for(int i3abcd = 0;(i3abcd < 1);i3abcd++){
+for(int i4abcd = 0;(i4abcd < 1);i4abcd++){
+int v5abcd = v0abcd;
+int v6abcd = ((!(v0abcd) + (v0abcd * p0abcd)) / 9);
+f1abcd((25 - -(f14abc())));
+int v7abcd = i1abcd;
+int v8abcd = ((v0abcd + i4abcd) + ((f5abcd(v6abcd,16,i4abcd) * v0abcd) / 2));
+}
+p0abcd = 14;
+f16abc();
+}
+};
+f19abc(((p0abcd + p0abcd) - (v0abcd || 64)));
+return 71;
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
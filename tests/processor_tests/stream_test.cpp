@@ -0,0 +1,1120 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+namespace fio {
+static char obuf[1 << 24];
+static size_t olen = 0;
+inline void flush() { fwrite(obuf, 1, olen, stdout); olen = 0; }
+inline void put(const char* s, size_t n) {
+	if (olen + n > sizeof obuf) flush();
+	if (n > sizeof obuf) { fwrite(s, 1, n, stdout); return; }
+	memcpy(obuf + olen, s, n); olen += n;
+}
+inline void put(char c) { if (olen == sizeof obuf) flush(); obuf[olen++] = c; }
+inline void put(const char* s) { put(s, strlen(s)); }
+inline void put(const string& s) { put(s.data(), s.size()); }
+inline void put(bool x) { put(char('0' + x)); }
+template <class T> typename enable_if<is_integral<T>::value>::type put(T x) {
+	char b[24]; int i = 24;
+	unsigned long long u = x;
+	if (x < 0) u = 0 - u;
+	do { b[--i] = char('0' + u % 10); u /= 10; } while (u);
+	if (x < 0) b[--i] = '-';
+	put(b + i, 24 - i);
+}
+template <class T> typename enable_if<is_floating_point<T>::value>::type put(T x) {
+	char b[32]; put(b, snprintf(b, sizeof b, "%g", double(x)));
+}
+template <class T> void println(const T& x) { put(x); put('\n'); }
+static char ibuf[1 << 16];
+static size_t ilen = 0, ipos = 0;
+inline int get() {
+	if (ipos == ilen) { ilen = fread(ibuf, 1, sizeof ibuf, stdin); ipos = 0; if (!ilen) return EOF; }
+	return (unsigned char)ibuf[ipos++];
+}
+inline int skip() { int c = get(); while (c != EOF && c <= ' ') c = get(); return c; }
+template <class T> typename enable_if<is_integral<T>::value>::type read(T& x) {
+	int c = skip(); bool neg = c == '-';
+	if (neg || c == '+') c = get();
+	unsigned long long u = 0;
+	for (; c >= '0' && c <= '9'; c = get()) u = u * 10 + (c - '0');
+	x = T(neg ? 0 - u : u);
+}
+inline void read(char& x) { int c = skip(); if (c != EOF) x = char(c); }
+inline void read(string& x) { x.clear(); for (int c = skip(); c != EOF && c > ' '; c = get()) x += char(c); }
+template <class T> typename enable_if<is_floating_point<T>::value>::type read(T& x) {
+	string s; read(s); x = T(strtod(s.c_str(), nullptr));
+}
+}
+typedef long long ll;
+typedef vector<int> vi;
+bool multiTest = 0;
+ll d, l, r, k, n, m, p, q, u, v, w, x, y, z;
+int f0abcd(){
+int c0abcd = 1;
+while((c0abcd > 0)){
+int v1abcd = (41 >= (19 / 7));
+int c2abcd = 2;
+while((c2abcd > 0)){
+for(int i3abcd = 0; i3abcd < 2; i3abcd++){
+v1abcd = ((62 + -(c0abcd)) <= (i3abcd != 75));
+int v4abcd = 62;
+int v5abcd = ((((59 && 95) || v4abcd) || 77) * !((c0abcd - 41)));
+int v6abcd = ((i3abcd * 79) >= ((c2abcd + (c0abcd * v5abcd)) - v4abcd));
+int v7abcd = v6abcd;
+int v8abcd = v5abcd;
+};
+int v9abcd = v1abcd;
+int v10abc = 8;
+int c11abc = 1;
+while((c11abc > 0)){
+int v12abc = c2abcd;
+v12abc = 93;
+v9abcd = (-((v9abcd - 28)) < 27);
+c11abc = (c11abc - 1);
+}
+fio::println(v10abc);
+int v13abc = ((!(v10abc) > (c11abc * v10abc)) || (0 * -(85)));
+c2abcd = (c2abcd - 1);
+}
+int v14abc = (((!(57) < 81) && 94) + !((c2abcd < c2abcd)));
+int v15abc = -((((45 - c0abcd) + c2abcd) >= v14abc));
+if((v1abcd == ((11 < c2abcd) >= 54))){
+if((v14abc <= c2abcd)){
+v14abc = 63;
+int v16abc = 44;
+int v17abc = (40 >= ((57 + c2abcd) * v14abc));
+int v18abc = 90;
+}
+int v19abc = (((v14abc / 7) + -(22)) - ((43 + 55) - c0abcd));
+} else {
+int v20abc = (((60 - 94) - v14abc) + (c0abcd == 59));
+}
+if(((c0abcd != v15abc) && (v15abc > 93))){
+int v21abc = -((!(c2abcd) - 30));
+fio::println(v15abc);
+for(int i22abc = 0;(i22abc < 1);i22abc++){
+int v23abc = v1abcd;
+int v24abc = 88;
+int v25abc = (i22abc * 53);
+int v26abc = c2abcd;
+v25abc = ((98 + (41 / 3)) < 38);
+fio::println(v1abcd);
+}
+int v27abc = ((((c0abcd - (6 || v21abc)) - 65) + v15abc) <= (v15abc || c2abcd));
+}
+c0abcd = (c0abcd - 1);
+}
+for(int i28abc = 0;(i28abc < 4);i28abc++){
+for(int i29abc = 0;(i29abc < 1);i29abc++){
+for(int i30abc = 0;(i30abc < 3);i30abc++){
+int v31abc = (((86 + 91) - 37) + i28abc);
+int v32abc = ((v31abc - 21) > !(i29abc));
+int v33abc = (((13 + (v32abc * 71)) + -(i28abc)) && (11 + i29abc));
+fio::println(i28abc);
+int v34abc = ((64 && c0abcd) && (((2 - c0abcd) + (c0abcd * i30abc)) + v31abc));
+int v35abc = (79 && 69);
+}
+fio::println(i29abc);
+int v36abc = 29;
+for(int i37abc = 0;(i37abc < 3);i37abc++){
+v36abc = (((c0abcd - 72) || i29abc) + 45);
+int v38abc = (((-(i29abc) + -(v36abc)) > (i29abc + 19)) == -(v36abc));
+int v39abc = 25;
+int v40abc = (((5 - 26) + c0abcd) >= 17);
+int v41abc = v36abc;
+}
+for(int i42abc = 0; i42abc < 1; i42abc++){
+int v43abc = (((c0abcd * c0abcd) - i28abc) + 47);
+int v44abc = (((i42abc - i29abc) == 78) - -((v43abc - 64)));
+int v45abc = 1;
+int v46abc = 22;
+};
+}
+int v47abc = i28abc;
+for(int i48abc = 0;(i48abc < 3);i48abc++){
+int v49abc = i48abc;
+for(int i50abc = 0; i50abc < 4; i50abc++){
+int v51abc = ((16 - (v47abc * v47abc)) * v47abc);
+};
+int v52abc = ((i48abc > -(19)) >= (v49abc / 1));
+if(((77 + (v47abc + i28abc)) == 44)){
+int v53abc = (!(25) && ((45 * i28abc) > 8));
+int v54abc = v49abc;
+v52abc = (v47abc >= ((v53abc + v53abc) + (v49abc / 9)));
+v53abc = !(50);
+int v55abc = ((60 == v54abc) != (2 + (i28abc * 75)));
+} else {
+v47abc = -(28);
+int v56abc = i28abc;
+v47abc = ((3 / 1) - 0);
+fio::println(v49abc);
+int v57abc = ((v52abc && i48abc) - ((25 * 4) * v56abc));
+int v58abc = ((c0abcd * 30) && (c0abcd > (((i28abc / 1) * v49abc) - v56abc)));
+}
+}
+int v59abc = (-((v47abc * i28abc)) * 62);
+}
+int v60abc = 91;
+int v61abc = (((27 - v60abc) - c0abcd) || 71);
+int v62abc = (((c0abcd - 27) / 7) == v61abc);
+return v62abc;
+}
+
+int f1abcd(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = (((f0abcd() / 3) * 25) >= (p2abcd * p1abcd));
+p2abcd = (80 + (((29 + p2abcd) * f0abcd()) - v0abcd));
+f0abcd();
+int v1abcd = ((((20 + p2abcd) + f0abcd()) + p2abcd) == p1abcd);
+return (((f0abcd() / 4) - p2abcd) * 16);
+}
+
+int f2abcd(int p0abcd,int p1abcd){
+int v0abcd = (p1abcd * (p1abcd > (29 - 17)));
+fio::println(p1abcd);
+return (((20 + (f0abcd() * v0abcd)) + 87) <= p1abcd);
+}
+
+int f3abcd(int p0abcd,int p1abcd){
+int v0abcd = 98;
+int v1abcd = ((((v0abcd * f2abcd(v0abcd,v0abcd)) > p1abcd) != ((61 + p1abcd) - 88)) == p1abcd);
+int v2abcd = p0abcd;
+f1abcd((!(88) - 47),-(17),93);
+if(((f1abcd(v2abcd,v1abcd,v0abcd) - v1abcd) || ((v2abcd - f1abcd(p0abcd,46,43)) != ((p0abcd / 1) - (3 * f2abcd(48,88)))))){
+v0abcd = ((((f2abcd(v0abcd,70) + 35) + (v1abcd - f2abcd(24,v0abcd))) - (p0abcd + f1abcd(47,v2abcd,v2abcd))) <= 70);
+} else {
+for(int i3abcd = 0; i3abcd < 3; i3abcd++){
+if((((v0abcd - 97) + p1abcd) || ((v2abcd < 98) == (v1abcd / 8)))){
+int v4abcd = ((((p0abcd + i3abcd) + 85) - f0abcd()) == p0abcd);
+} else {
+fio::println(v0abcd);
+p0abcd = f0abcd();
+}
+for(int i5abcd = 0;(i5abcd < 1);i5abcd++){
+int v6abcd = p1abcd;
+v6abcd = (i3abcd || (((v1abcd + 69) - p0abcd) + (p1abcd / 3)));
+f0abcd();
+}
+f2abcd(((v1abcd - v2abcd) + v2abcd),((i3abcd >= i3abcd) || (p0abcd / 8)));
+for(int i7abcd = 0;(i7abcd < 1);i7abcd++){
+int v8abcd = ((f0abcd() / 6) == ((1 * 39) || (f0abcd() - v2abcd)));
+int v9abcd = (i7abcd && (p1abcd > ((v0abcd >= v2abcd) + ((25 * 40) - -(35)))));
+int v10abc = ((((70 / 9) > 94) + i7abcd) <= (v8abcd / 9));
+}
+};
+int v11abc = p0abcd;
+fio::println(v2abcd);
+v1abcd = v11abc;
+}
+return ((47 - p0abcd) > (p0abcd * v2abcd));
+}
+
+int f4abcd(){
+int v0abcd = f1abcd(((93 - 13) + 45),((10 / 3) - 26),(f3abcd(25,47) - (33 < 38)));
+f2abcd(((v0abcd * 92) != 43),v0abcd);
+int v1abcd = ((((12 - 94) + 74) + 12) || v0abcd);
+if((((v0abcd / 7) > (v1abcd + 26)) <= ((v0abcd * v1abcd) * 77))){
+for(int i2abcd = 0;(i2abcd < 4);i2abcd++){
+fio::println(i2abcd);
+}
+}
+int v3abcd = (9 - ((v0abcd + v1abcd) * v1abcd));
+return ((v3abcd - (f0abcd() * f2abcd(v3abcd,v1abcd))) + ((v3abcd - v3abcd) + v3abcd));
+}
+
+int f5abcd(){
+f2abcd(68,((28 + 29) + (1 - 87)));
+return ((84 <= 90) * (f0abcd() - -(99)));
+}
+
+int f6abcd(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 4; i0abcd++){
+f3abcd((p1abcd - (p2abcd * (p0abcd + f1abcd(58,85,p1abcd)))),((p1abcd && p1abcd) - f3abcd(48,p1abcd)));
+};
+int c1abcd = 2;
+while((c1abcd > 0)){
+p1abcd = p0abcd;
+c1abcd = (c1abcd - 1);
+}
+return (p0abcd || (p0abcd != -(5)));
+}
+
+int f7abcd(int p0abcd,int p1abcd){
+int v0abcd = (26 + p0abcd);
+v0abcd = f0abcd();
+int c1abcd = 2;
+while((c1abcd > 0)){
+int v2abcd = (((v0abcd * f5abcd()) * v0abcd) / 9);
+if((47 > f6abcd(v0abcd,(v0abcd / 1),(f3abcd(p1abcd,71) < v0abcd)))){
+for(int i3abcd = 0;(i3abcd < 2);i3abcd++){
+fio::println(v2abcd);
+}
+for(int i4abcd = 0;(i4abcd < 1);i4abcd++){
+int v5abcd = (p1abcd - 9);
+fio::println(c1abcd);
+fio::println(c1abcd);
+int v6abcd = v2abcd;
+fio::println(v5abcd);
+}
+}
+f0abcd();
+int v7abcd = 89;
+for(int i8abcd = 0;(i8abcd < 1);i8abcd++){
+v0abcd = 36;
+f6abcd(((!(p0abcd) - 90) != 91),!(77),((v0abcd - i8abcd) - -(57)));
+int v9abcd = ((-((c1abcd - v2abcd)) - f5abcd()) > 7);
+}
+c1abcd = (c1abcd - 1);
+}
+f1abcd((p1abcd + (v0abcd * 80)),43,(((c1abcd - c1abcd) - 11) != p1abcd));
+return (v0abcd || (((86 - ((f5abcd() - c1abcd) * 46)) - c1abcd) - v0abcd));
+}
+
+int f8abcd(){
+int c0abcd = 2;
+while((c0abcd > 0)){
+for(int i1abcd = 0; i1abcd < 2; i1abcd++){
+if((70 == (2 || (f7abcd(46,4) >= c0abcd)))){
+int v2abcd = (80 || (c0abcd > (c0abcd / 3)));
+int v3abcd = (((c0abcd - v2abcd) * c0abcd) < (f3abcd(c0abcd,c0abcd) - (88 != (c0abcd + f6abcd(14,10,73)))));
+f1abcd(((i1abcd + (82 * f4abcd())) > 69),((v2abcd - v3abcd) < (67 + 50)),27);
+int v4abcd = (!((v3abcd / 9)) + (-(i1abcd) / 3));
+v4abcd = ((v4abcd * v4abcd) / 8);
+} else {
+int v5abcd = (17 + (c0abcd < f1abcd(c0abcd,92,f7abcd(99,i1abcd))));
+int v6abcd = (v5abcd + 39);
+fio::println(c0abcd);
+int v7abcd = (41 || ((81 / 5) + c0abcd));
+}
+int v8abcd = (c0abcd || (45 != (f2abcd(39,c0abcd) + f7abcd(c0abcd,98))));
+if(((1 * (i1abcd - i1abcd)) != ((26 < 77) * -(c0abcd)))){
+v8abcd = !((c0abcd * 75));
+int v9abcd = c0abcd;
+fio::println(v9abcd);
+fio::println(i1abcd);
+f6abcd(-((v8abcd * f5abcd())),((-(c0abcd) * i1abcd) * 70),((v9abcd + i1abcd) && (i1abcd + 6)));
+int v10abc = 69;
+}
+};
+f1abcd((81 == (71 <= c0abcd)),((c0abcd - 97) <= 77),((c0abcd && c0abcd) - 95));
+if((((f1abcd(53,74,c0abcd) * c0abcd) + 59) > ((50 - 69) + (77 < 82)))){
+int c11abc = 2;
+while((c11abc > 0)){
+int v12abc = ((f1abcd(77,c11abc,(c0abcd - 63)) - 22) || (c0abcd * c11abc));
+v12abc = v12abc;
+c11abc = (c11abc - 1);
+}
+f2abcd(((82 <= c0abcd) != 4),((29 * c11abc) + c0abcd));
+int v13abc = -(((6 - c11abc) != (c11abc != f6abcd(80,44,c0abcd))));
+int c14abc = 2;
+while((c14abc > 0)){
+int v15abc = ((31 && ((c14abc * f6abcd(c0abcd,v13abc,43)) / 4)) <= -((v13abc - 95)));
+int v16abc = ((v13abc - 84) == ((0 - ((65 * f7abcd(c11abc,53)) * 25)) + f1abcd(c14abc,86,68)));
+c14abc = (c14abc - 1);
+}
+for(int i17abc = 0;(i17abc < 3);i17abc++){
+v13abc = v13abc;
+}
+}
+f3abcd(c0abcd,(c0abcd + 68));
+c0abcd = (c0abcd - 1);
+}
+int v18abc = (53 || 89);
+int v19abc = -(((60 + c0abcd) && (c0abcd + 58)));
+for(int i20abc = 0; i20abc < 1; i20abc++){
+int v21abc = (((i20abc * f3abcd(10,77)) + !(52)) == -((f4abcd() > 38)));
+int v22abc = (-((f3abcd(i20abc,16) * 11)) || c0abcd);
+f7abcd(((i20abc - i20abc) / 9),((v22abc + i20abc) <= v21abc));
+int v23abc = ((i20abc * v22abc) != (88 <= ((35 + 98) + (f0abcd() == i20abc))));
+for(int i24abc = 0;(i24abc < 4);i24abc++){
+v23abc = (((98 - 55) > (v19abc + v18abc)) + ((v22abc / 8) * 30));
+}
+v21abc = ((c0abcd != (v22abc > v19abc)) || f1abcd(-(i20abc),(45 / 2),(f0abcd() < v22abc)));
+};
+for(int i25abc = 0; i25abc < 1; i25abc++){
+if((((i25abc * c0abcd) - 46) <= (f6abcd(36,c0abcd,54) != (v18abc >= f5abcd())))){
+f4abcd();
+fio::println(v18abc);
+if((((c0abcd * 4) <= v19abc) >= ((57 - f6abcd(i25abc,i25abc,68)) / 4))){
+f4abcd();
+v19abc = (((v18abc * 35) && i25abc) && v18abc);
+f6abcd(((i25abc * 56) == !(v18abc)),!((18 != 89)),36);
+f5abcd();
+int v26abc = c0abcd;
+int v27abc = (!((v18abc >= c0abcd)) && (-(c0abcd) + 1));
+} else {
+f0abcd();
+int v28abc = (i25abc / 8);
+f4abcd();
+f6abcd(v19abc,(v19abc <= (83 + 51)),66);
+}
+}
+int c29abc = 2;
+while((c29abc > 0)){
+v18abc = ((21 * 0) || (f4abcd() + v19abc));
+int c30abc = 1;
+while((c30abc > 0)){
+int v31abc = ((i25abc / 8) - (-(17) / 5));
+int v32abc = (((((99 <= 39) <= 96) <= f7abcd(i25abc,v19abc)) && ((45 != 11) * 47)) && c30abc);
+int v33abc = ((i25abc < c29abc) || (58 == 84));
+c30abc = (c30abc - 1);
+}
+if((((c0abcd + 55) / 8) > 43)){
+int v34abc = ((v19abc >= (62 * v19abc)) && (c0abcd != (c30abc <= (32 < i25abc))));
+int v35abc = ((v18abc + (c30abc * i25abc)) < (((46 + (v19abc >= v19abc)) + v18abc) - c29abc));
+int v36abc = ((v35abc > v34abc) || ((v19abc * f1abcd(c29abc,88,v18abc)) + 56));
+} else {
+v18abc = (((c0abcd + 59) + v19abc) / 7);
+int v37abc = ((((51 / 6) - ((v19abc / 9) * c0abcd)) - v18abc) >= (38 / 1));
+int v38abc = ((v19abc - (81 / 3)) || ((c29abc / 2) > (c0abcd - i25abc)));
+int v39abc = 26;
+}
+int c40abc = 2;
+while((c40abc > 0)){
+int v41abc = c30abc;
+c40abc = (c40abc - 1);
+}
+int v42abc = ((v19abc * f3abcd(38,c29abc)) >= (49 - 64));
+c29abc = (c29abc - 1);
+}
+};
+for(int i43abc = 0; i43abc < 3; i43abc++){
+int c44abc = 2;
+while((c44abc > 0)){
+for(int i45abc = 0; i45abc < 3; i45abc++){
+v18abc = (((v18abc - 9) + f6abcd(i43abc,c44abc,81)) / 5);
+int v46abc = (((94 + i45abc) != c44abc) && ((76 * i43abc) / 4));
+fio::println(c44abc);
+fio::println(v18abc);
+f7abcd(21,((v18abc * v18abc) <= 80));
+};
+int v47abc = v19abc;
+if((((77 - 2) - (v19abc * v18abc)) > (!(c44abc) + c44abc))){
+int v48abc = ((c44abc <= (c44abc - f7abcd(c0abcd,v18abc))) < (c0abcd + (-(f5abcd()) - (f5abcd() - 76))));
+int v49abc = (3 && ((50 - (39 * v19abc)) <= (f1abcd(49,v48abc,i43abc) - 9)));
+f4abcd();
+v19abc = ((-(43) - (c0abcd * f7abcd(v49abc,9))) != (84 <= (13 / 3)));
+int v50abc = ((c44abc && (87 + 16)) * -(v18abc));
+} else {
+f5abcd();
+int v51abc = !(v19abc);
+v19abc = 91;
+fio::println(i43abc);
+int v52abc = v19abc;
+int v53abc = ((91 / 4) < (46 || (f7abcd(87,63) == (v18abc + v52abc))));
+}
+c44abc = (c44abc - 1);
+}
+int c54abc = 1;
+while((c54abc > 0)){
+int c55abc = 2;
+while((c55abc > 0)){
+fio::println(c44abc);
+c55abc = (c55abc - 1);
+}
+int v56abc = 12;
+if(((((30 / 8) < -(49)) > (i43abc + c54abc)) < (c44abc * c44abc))){
+int v57abc = (v18abc <= (((c55abc + f4abcd()) - 21) - (-(v18abc) / 9)));
+} else {
+int v58abc = (6 / 6);
+int v59abc = c0abcd;
+fio::println(c0abcd);
+}
+v18abc = ((!((c44abc * i43abc)) - (39 * c55abc)) + (f4abcd() == 11));
+v56abc = (((v56abc - c54abc) - f1abcd(v56abc,76,c0abcd)) && (3 / 3));
+v56abc = (((((32 || f6abcd(c44abc,v19abc,v56abc)) * c44abc) / 3) && 3) && (f5abcd() + (16 + c54abc)));
+c54abc = (c54abc - 1);
+}
+for(int i60abc = 0; i60abc < 3; i60abc++){
+if((((f0abcd() - (c0abcd / 8)) < ((c44abc - c54abc) - 70)) <= 86)){
+int v61abc = (((i60abc * c0abcd) - 63) > i60abc);
+v19abc = v61abc;
+}
+int v62abc = (36 && -((c54abc + v18abc)));
+};
+for(int i63abc = 0;(i63abc < 1);i63abc++){
+int v64abc = (c0abcd / 2);
+for(int i65abc = 0;(i65abc < 4);i65abc++){
+int v66abc = f4abcd();
+int v67abc = -(((83 >= 40) && (v66abc * 57)));
+fio::println(c44abc);
+}
+}
+f5abcd();
+};
+return (((c0abcd + 62) - c0abcd) || ((v18abc * v18abc) >= (18 - (13 * v19abc))));
+}
+
+int f9abcd(int p0abcd){
+int c0abcd = 3;
+while((c0abcd > 0)){
+int v1abcd = 92;
+int v2abcd = ((43 <= 96) != (87 + (c0abcd / 9)));
+for(int i3abcd = 0; i3abcd < 4; i3abcd++){
+fio::println(v1abcd);
+int c4abcd = 3;
+while((c4abcd > 0)){
+p0abcd = (33 >= (49 - -((p0abcd - f7abcd(v1abcd,i3abcd)))));
+int v5abcd = 98;
+v5abcd = p0abcd;
+fio::println(v5abcd);
+int v6abcd = ((20 + (20 / 9)) - (p0abcd * !(c0abcd)));
+int v7abcd = ((62 > (i3abcd + f6abcd(v6abcd,52,c4abcd))) && ((v5abcd - 83) + (v1abcd < f7abcd(30,31))));
+c4abcd = (c4abcd - 1);
+}
+int v8abcd = (v2abcd && ((c0abcd - c4abcd) >= 55));
+p0abcd = (v2abcd - (c0abcd - (i3abcd <= 49)));
+fio::println(i3abcd);
+for(int i9abcd = 0; i9abcd < 4; i9abcd++){
+int v10abc = (15 * 52);
+v10abc = ((7 + v1abcd) || (((2 >= i3abcd) > i9abcd) < (i3abcd * i9abcd)));
+fio::println(v8abcd);
+int v11abc = (33 * 39);
+fio::println(i3abcd);
+};
+};
+int v12abc = v2abcd;
+int v13abc = ((65 - (c0abcd * p0abcd)) < 63);
+c0abcd = (c0abcd - 1);
+}
+return p0abcd;
+}
+
+int f10abc(){
+int v0abcd = (((24 * (45 / 1)) > (66 * 16)) > 16);
+return ((23 * f2abcd(60,11)) && ((v0abcd - f0abcd()) != (v0abcd * v0abcd)));
+}
+
+int f11abc(){
+int v0abcd = ((((58 * 61) / 3) < 62) || (83 + (30 - 28)));
+return (((-((60 - v0abcd)) - 12) - v0abcd) + v0abcd);
+}
+
+int f12abc(int p0abcd){
+int v0abcd = 59;
+fio::println(v0abcd);
+return 91;
+}
+
+int f13abc(int p0abcd,int p1abcd,int p2abcd){
+for(int i0abcd = 0; i0abcd < 2; i0abcd++){
+int v1abcd = (p2abcd - (!(29) / 3));
+for(int i2abcd = 0; i2abcd < 3; i2abcd++){
+if((p2abcd == ((i2abcd * v1abcd) / 4))){
+int v3abcd = (f2abcd((f0abcd() + p1abcd),49) - ((p2abcd - p1abcd) && (60 - 12)));
+int v4abcd = (84 + (84 + (18 * p0abcd)));
+}
+for(int i5abcd = 0; i5abcd < 1; i5abcd++){
+f5abcd();
+int v6abcd = (67 > (f5abcd() - (p2abcd * p1abcd)));
+};
+int v7abcd = (((((33 == 10) && (p2abcd - 21)) || (72 > v1abcd)) || p2abcd) || i2abcd);
+p2abcd = ((p2abcd / 6) / 5);
+if(((f0abcd() != p1abcd) || (f6abcd(p0abcd,f3abcd(6,i2abcd),59) < 88))){
+int v8abcd = ((p0abcd - i0abcd) - f8abcd());
+f5abcd();
+fio::println(p0abcd);
+f12abc((21 || (24 / 3)));
+int v9abcd = !(((19 - 88) + (95 + p1abcd)));
+int v10abc = v9abcd;
+}
+};
+for(int i11abc = 0; i11abc < 2; i11abc++){
+f2abcd(v1abcd,(i11abc - 80));
+for(int i12abc = 0;(i12abc < 2);i12abc++){
+int v13abc = (58 - v1abcd);
+f11abc();
+}
+};
+p0abcd = -((f9abcd(v1abcd) && (p1abcd - 88)));
+p1abcd = ((p2abcd * p1abcd) + (p2abcd / 3));
+if(((p1abcd + 8) != (2 <= 39))){
+p1abcd = 78;
+if((((i0abcd * v1abcd) / 7) == p0abcd)){
+int v14abc = (97 == !((p1abcd - i0abcd)));
+f3abcd((p2abcd != (i0abcd * 98)),v1abcd);
+int v15abc = i0abcd;
+}
+}
+};
+fio::println(p2abcd);
+p2abcd = (((45 - 24) >= 25) == (f10abc() < ((p0abcd <= p2abcd) || (68 * 82))));
+p0abcd = ((-(p1abcd) - f10abc()) / 4);
+return ((p1abcd > -(60)) > f7abcd(!(95),(91 / 2)));
+}
+
+int f14abc(int p0abcd){
+f10abc();
+int v0abcd = (5 * (p0abcd < (p0abcd * p0abcd)));
+return 5;
+}
+
+int f15abc(int p0abcd,int p1abcd,int p2abcd){
+f1abcd(p1abcd,-(32),p1abcd);
+return ((p1abcd >= (p0abcd || f5abcd())) != (p2abcd > 31));
+}
+
+int f16abc(int p0abcd){
+int v0abcd = (((f9abcd(p0abcd) + (50 * 76)) < 32) != (p0abcd + (p0abcd / 2)));
+return p0abcd;
+}
+
+int f17abc(){
+int v0abcd = (-(25) + 99);
+return ((v0abcd + v0abcd) + 91);
+}
+
+while((c14abc > 0)){
+fio::println(p0abcd);
+fio::println(c0abcd);
+v1abcd = c9abcd;
+v1abcd = p2abcd;
+c14abc = (c14abc - 1);
+}
+c15abc = 3;
+while((c15abc > 0)){
+int v16abc = (!(p1abcd) + p2abcd);
+int v17abc = ((11 <= v1abcd) - ((((p0abcd * f3abcd(p2abcd,10)) * f4abcd()) / 6) * (p2abcd - p2abcd)));
+if((((p1abcd - f5abcd()) > (v16abc / 8)) <= ((c0abcd * f10abc()) - 9))){
+fio::println(v16abc);
+int v18abc = -((c15abc != -(8)));
+int v19abc = 71;
+fio::println(v1abcd);
+int v20abc = v1abcd;
+} else {
+int v21abc = (((v1abcd * v17abc) + 3) + !((66 - v1abcd)));
+}
+int v22abc = (90 <= v16abc);
+f6abcd(((f11abc() <= v17abc) > (p0abcd + v16abc)),((71 - 6) + (v17abc / 7)),(v16abc || (53 != (v22abc - v1abcd))));
+int v23abc = ((v1abcd - (p2abcd / 8)) / 4);
+c15abc = (c15abc - 1);
+}
+int v24abc = c15abc;
+c0abcd = (c0abcd - 1);
+v25abc = 13;
+int c26abc = 2;
+while((c26abc > 0)){
+f0abcd();
+f14abc((99 + (44 * !(c0abcd))));
+fio::println(c26abc);
+fio::println(p2abcd);
+f3abcd((78 * (48 && c0abcd)),21);
+c26abc = (c26abc - 1);
+}
+p1abcd = 66;
+p0abcd = (v25abc >= ((p0abcd / 5) * !(!(95))));
+return (p0abcd - c0abcd);
+int f19abc(int p0abcd,int p1abcd){
+int v0abcd = (p0abcd && (73 - (49 / 2)));
+for(int i1abcd = 0;(i1abcd < 4);i1abcd++){
+int v2abcd = (((95 / 7) && (p1abcd >= p0abcd)) <= -((71 * 81)));
+int v3abcd = (-(i1abcd) * ((5 < v0abcd) > p0abcd));
+}
+if(((68 >= 7) >= 68)){
+p0abcd = 37;
+f17abc();
+}
+int v4abcd = v0abcd;
+p0abcd = (((8 - p1abcd) - v4abcd) && (v0abcd - (36 != v4abcd)));
+f10abc();
+return (p1abcd - (-(p1abcd) * (98 - 75)));
+}
+
+int f20abc(int p0abcd,int p1abcd){
+int v0abcd = 15;
+p0abcd = ((p0abcd && ((p0abcd * 71) - p1abcd)) <= p1abcd);
+fio::println(p0abcd);
+return p0abcd;
+}
+
+int f21abc(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = p0abcd;
+for(int i1abcd = 0;(i1abcd < 3);i1abcd++){
+f2abcd((p1abcd && ((37 + p2abcd) - p2abcd)),p0abcd);
+for(int i2abcd = 0; i2abcd < 2; i2abcd++){
+fio::println(p0abcd);
+if(((((i2abcd - 56) >= (43 - p2abcd)) < ((p0abcd + i2abcd) - 55)) <= p1abcd)){
+p2abcd = (((v0abcd * p2abcd) / 5) < ((8 + 49) + (i1abcd / 2)));
+p0abcd = ((i1abcd == 57) != ((3 - i1abcd) > ((v0abcd > p2abcd) / 9)));
+int v3abcd = ((p2abcd - f13abc(i1abcd,6,p1abcd)) || (f7abcd(f13abc(83,56,p2abcd),18) > !((v0abcd * 3))));
+fio::println(p1abcd);
+} else {
+fio::println(p2abcd);
+v0abcd = 72;
+v0abcd = (((f1abcd(p0abcd,42,92) && p0abcd) * (i1abcd + i2abcd)) || ((p1abcd * i2abcd) + (p2abcd - p2abcd)));
+v0abcd = (f6abcd((28 * 56),(63 - f5abcd()),(p2abcd > 19)) || i2abcd);
+p1abcd = (((97 * 93) / 2) / 1);
+}
+int v4abcd = !((p1abcd + (p1abcd / 1)));
+if((v0abcd < (v4abcd * i1abcd))){
+fio::println(i1abcd);
+int v5abcd = (94 || (((v4abcd * 77) * (p2abcd + v0abcd)) && p2abcd));
+}
+};
+}
+fio::println(p2abcd);
+for(int i6abcd = 0; i6abcd < 4; i6abcd++){
+int c7abcd = 2;
+while((c7abcd > 0)){
+if((76 == p0abcd)){
+v0abcd = ((94 + f4abcd()) + 35);
+} else {
+int v8abcd = (((97 - 80) >= (4 * v0abcd)) != 26);
+fio::println(c7abcd);
+}
+int v9abcd = (((f7abcd(c7abcd,p2abcd) - p1abcd) + (i6abcd * p1abcd)) * (66 + (v0abcd * p2abcd)));
+c7abcd = (c7abcd - 1);
+}
+for(int i10abc = 0;(i10abc < 4);i10abc++){
+if((46 > (85 - i10abc))){
+f0abcd();
+f9abcd((i10abc / 5));
+f13abc(((f15abc(92,p0abcd,f11abc()) * v0abcd) < f13abc(p2abcd,i10abc,v0abcd)),-((78 / 9)),60);
+} else {
+int v11abc = p0abcd;
+int v12abc = ((13 + f20abc(p2abcd,65)) + (p0abcd && 14));
+f0abcd();
+int v13abc = (p1abcd - -((c7abcd + v0abcd)));
+fio::println(c7abcd);
+int v14abc = 99;
+}
+for(int i15abc = 0; i15abc < 1; i15abc++){
+v0abcd = (((p0abcd + i10abc) < (p0abcd - 40)) && p1abcd);
+int v16abc = i6abcd;
+p1abcd = (((v0abcd != ((v16abc + p0abcd) + c7abcd)) * (f20abc(v16abc,31) < 47)) - (83 + i15abc));
+int v17abc = -(((47 * 24) != (12 * p2abcd)));
+f20abc(((v0abcd < v16abc) > f15abc(i6abcd,84,c7abcd)),(i15abc && 54));
+int v18abc = ((v16abc - !(i10abc)) + 81);
+};
+f13abc(((v0abcd / 4) + (f11abc() * v0abcd)),(f1abcd(c7abcd,p0abcd,29) - (f7abcd(48,81) - p2abcd)),((p2abcd + (51 * f1abcd(v0abcd,56,p2abcd))) >= p1abcd));
+int v19abc = ((p0abcd <= ((35 - 41) - 30)) && 71);
+if((!((3 - i10abc)) >= ((p1abcd * 65) - c7abcd))){
+int v20abc = (29 > ((i6abcd == v19abc) + (p1abcd >= (p1abcd / 7))));
+}
+if(((((p2abcd * 7) / 9) <= p0abcd) <= (68 * 3))){
+int v21abc = (p1abcd != ((f5abcd() * 36) - ((f12abc(55) + v19abc) + c7abcd)));
+fio::println(v0abcd);
+}
+}
+for(int i22abc = 0; i22abc < 2; i22abc++){
+int v23abc = ((67 * p0abcd) == (95 / 8));
+int v24abc = (c7abcd < (i6abcd + i6abcd));
+};
+int c25abc = 3;
+while((c25abc > 0)){
+if((((96 / 7) * i6abcd) != ((p1abcd * p1abcd) * (i6abcd - i6abcd)))){
+f9abcd(((p0abcd && v0abcd) && (19 + 1)));
+} else {
+p1abcd = 52;
+int v26abc = 25;
+int v27abc = ((((p1abcd * p1abcd) > 85) && c7abcd) || p2abcd);
+}
+int c28abc = 3;
+while((c28abc > 0)){
+int v29abc = 24;
+int v30abc = (((35 / 3) * c28abc) + 41);
+fio::println(c7abcd);
+fio::println(v30abc);
+int v31abc = (((54 * v30abc) && ((f7abcd(14,c25abc) || 70) - (v30abc < f14abc(v29abc)))) && 37);
+c28abc = (c28abc - 1);
+}
+c25abc = (c25abc - 1);
+}
+for(int i32abc = 0;(i32abc < 2);i32abc++){
+if((f11abc() || (((f0abcd() - i6abcd) > c7abcd) < c25abc))){
+v0abcd = v0abcd;
+p0abcd = (((i6abcd + (i32abc / 3)) <= i6abcd) != v0abcd);
+v0abcd = !((25 || (16 - p1abcd)));
+}
+int c33abc = 3;
+while((c33abc > 0)){
+int v34abc = ((28 - 30) < 89);
+f4abcd();
+int v35abc = ((p1abcd > (c7abcd / 5)) && (24 < (i6abcd - (78 || c7abcd))));
+f1abcd(((f9abcd(29) * i32abc) - (p0abcd * 40)),(45 || (2 / 5)),((p1abcd - 3) != (i6abcd - p0abcd)));
+p0abcd = ((19 + (v35abc / 1)) <= (39 / 3));
+int v36abc = 67;
+c33abc = (c33abc - 1);
+}
+p0abcd = (p0abcd < (((p0abcd / 4) + (p2abcd / 3)) + (87 / 6)));
+}
+};
+for(int i37abc = 0; i37abc < 3; i37abc++){
+p0abcd = p2abcd;
+if((-((i37abc * p1abcd)) < v0abcd)){
+if((p2abcd >= p2abcd)){
+int v38abc = (((((11 * p0abcd) + (i37abc * v0abcd)) + p1abcd) - i37abc) || v0abcd);
+fio::println(v38abc);
+fio::println(p0abcd);
+}
+fio::println(p2abcd);
+for(int i39abc = 0;(i39abc < 3);i39abc++){
+int v40abc = (i39abc * i37abc);
+int v41abc = p2abcd;
+f16abc(29);
+fio::println(i39abc);
+}
+int v42abc = ((p2abcd + !(35)) - 91);
+}
+f20abc((((v0abcd - p1abcd) < 66) >= 73),-((p2abcd <= v0abcd)));
+};
+return p1abcd;
+}
+
+int f22abc(int p0abcd,int p1abcd,int p2abcd){
+int v0abcd = (p2abcd < (11 - p2abcd));
+int v1abcd = (78 * (p0abcd < (p2abcd * 16)));
+fio::println(v0abcd);
+f4abcd();
+v0abcd = ((p0abcd * v0abcd) + v0abcd);
+return 96;
+}
+
+int f23abc(){
+int c0abcd = 1;
+while((c0abcd > 0)){
+for(int i1abcd = 0;(i1abcd < 1);i1abcd++){
+int v2abcd = c0abcd;
+f15abc((f12abc(f4abcd()) - (65 + 48)),((!(c0abcd) * i1abcd) / 3),(c0abcd && (38 != 0)));
+f3abcd((82 + 71),(i1abcd / 1));
+int v3abcd = -(v2abcd);
+}
+for(int i4abcd = 0; i4abcd < 3; i4abcd++){
+int v5abcd = ((i4abcd + (50 / 3)) && -((i4abcd - i4abcd)));
+int v6abcd = c0abcd;
+};
+c0abcd = (c0abcd - 1);
+}
+for(int i7abcd = 0;(i7abcd < 4);i7abcd++){
+for(int i8abcd = 0; i8abcd < 3; i8abcd++){
+int c9abcd = 2;
+while((c9abcd > 0)){
+f14abc((c9abcd && -(c0abcd)));
+fio::println(c0abcd);
+fio::println(c9abcd);
+c9abcd = (c9abcd - 1);
+}
+};
+fio::println(c0abcd);
+fio::println(c0abcd);
+}
+int v10abc = (c0abcd && c0abcd);
+int v11abc = ((v10abc - 80) - c0abcd);
+for(int i12abc = 0; i12abc < 2; i12abc++){
+int v13abc = (((v11abc - i12abc) + 3) != (((v11abc <= i12abc) * 41) < v10abc));
+for(int i14abc = 0; i14abc < 2; i14abc++){
+for(int i15abc = 0;(i15abc < 1);i15abc++){
+v10abc = f13abc(!(!(f7abcd(v13abc,i12abc))),(-(68) <= (i14abc + 81)),(((v13abc != 0) * 37) * 66));
+f10abc();
+}
+int v16abc = (((v13abc / 5) * !(2)) + 33);
+for(int i17abc = 0; i17abc < 1; i17abc++){
+v10abc = (-(!(i17abc)) <= ((i14abc * i17abc) * 59));
+v13abc = -(((f5abcd() * 86) || v16abc));
+};
+int v18abc = v16abc;
+};
+if(((87 - (77 / 5)) < ((45 / 6) - 8))){
+if(((6 == !(28)) == (v10abc * v13abc))){
+int v19abc = v13abc;
+int v20abc = (59 + ((33 / 6) * 17));
+int v21abc = (46 != ((14 * (i12abc * 46)) - -((v19abc + 74))));
+int v22abc = (c0abcd > ((f11abc() - v21abc) - (v20abc - v19abc)));
+}
+} else {
+int c23abc = 1;
+while((c23abc > 0)){
+int v24abc = f14abc(i12abc);
+fio::println(c0abcd);
+v24abc = ((81 - 42) && ((v13abc + v24abc) < c23abc));
+int v25abc = ((((f21abc(i12abc,v13abc,v24abc) - f11abc()) + !(c23abc)) + v11abc) == (v24abc - (i12abc * v24abc)));
+int v26abc = (((17 * f11abc()) - v11abc) + v25abc);
+int v27abc = -((v24abc - v10abc));
+c23abc = (c23abc - 1);
+}
+int v28abc = -((((v13abc / 4) * 57) + i12abc));
+for(int i29abc = 0; i29abc < 4; i29abc++){
+int v30abc = ((((94 * 72) - (i12abc + 72)) - 9) == (c0abcd == 48));
+f8abcd();
+fio::println(v11abc);
+int v31abc = !(((67 / 7) && 60));
+};
+}
+int v32abc = ((66 - 51) || (((72 > c0abcd) - 20) && c0abcd));
+};
+return !(v11abc);
+}
+
+int f24abc(int p0abcd){
+for(int i0abcd = 0;(i0abcd < 2);i0abcd++){
+fio::println(p0abcd);
+f9abcd((59 * f23abc()));
+}
+if((p0abcd >= p0abcd)){
+int c1abcd = 4;
+while((c1abcd > 0)){
+p0abcd = c1abcd;
+int v2abcd = ((c1abcd - c1abcd) || ((16 / 4) * c1abcd));
+int c3abcd = 4;
+while((c3abcd > 0)){
+v2abcd = f1abcd(43,16,(38 + 29));
+int v4abcd = ((8 * 65) > (75 - (c3abcd * 17)));
+c3abcd = (c3abcd - 1);
+}
+c1abcd = (c1abcd - 1);
+}
+for(int i5abcd = 0;(i5abcd < 1);i5abcd++){
+if((((50 < 23) * 21) == (1 > ((12 * p0abcd) / 9)))){
+int v6abcd = (f23abc() * f17abc());
+int v7abcd = ((51 / 7) || (c1abcd >= (85 * 71)));
+fio::println(p0abcd);
+int v8abcd = 75;
+} else {
+int v9abcd = (((c1abcd - 19) + p0abcd) || (p0abcd + 66));
+}
+f10abc();
+f17abc();
+}
+} else {
+if(((((p0abcd + p0abcd) - 34) - p0abcd) == 9)){
+for(int i10abc = 0; i10abc < 4; i10abc++){
+int v11abc = ((i10abc + (95 * i10abc)) + f11abc());
+int v12abc = ((!(v11abc) - (14 >= 9)) != 36);
+f9abcd((i10abc * i10abc));
+int v13abc = v11abc;
+int v14abc = (((((!(47) - 10) < p0abcd) - i10abc) == 23) != 82);
+fio::println(v14abc);
+};
+}
+int v15abc = (41 - ((p0abcd / 3) / 1));
+for(int i16abc = 0;(i16abc < 1);i16abc++){
+if((-((i16abc + i16abc)) >= (i16abc || (5 / 2)))){
+int v17abc = (((-((46 > i16abc)) + p0abcd) + i16abc) + p0abcd);
+f10abc();
+fio::println(i16abc);
+}
+if(((-(45) - 88) < ((i16abc * v15abc) - v15abc))){
+int v18abc = (p0abcd || (21 + (i16abc * f3abcd(v15abc,v15abc))));
+p0abcd = 20;
+}
+int v19abc = (((4 / 1) * (75 * 83)) >= ((v15abc + f19abc(30,79)) + v15abc));
+if((((62 <= i16abc) != v15abc) == 63)){
+p0abcd = (74 * 54);
+int v20abc = ((87 + 42) < p0abcd);
+int v21abc = ((89 * (v19abc + 49)) + (14 < v20abc));
+int v22abc = (((i16abc + p0abcd) == (v20abc * 68)) != ((f4abcd() * p0abcd) && !(73)));
+int v23abc = ((v21abc > v22abc) > (v21abc * v22abc));
+v23abc = ((v22abc + (71 - v20abc)) - v22abc);
+}
+int v24abc = (((v15abc * 15) + f3abcd(i16abc,41)) != (28 / 5));
+}
+}
+int v25abc = ((80 + f10abc()) >= (p0abcd - p0abcd));
+for(int i26abc = 0;(i26abc < 4);i26abc++){
+int v27abc = ((f1abcd(i26abc,(i26abc - f7abcd(p0abcd,71)),(72 / 3)) >= p0abcd) == (8 <= 25));
+for(int i28abc = 0;(i28abc < 3);i28abc++){
+int c29abc = 4;
+while((c29abc > 0)){
+int v30abc = c29abc;
+f22abc(c29abc,v30abc,(36 + -(16)));
+int v31abc = v30abc;
+f14abc((79 - ((0 * 58) / 9)));
+fio::println(v30abc);
+c29abc = (c29abc - 1);
+}
+}
+if(((-((v27abc <= i26abc)) <= i26abc) || !(52))){
+int c32abc = 4;
+while((c32abc > 0)){
+fio::println(p0abcd);
+c32abc = (c32abc - 1);
+}
+for(int i33abc = 0;(i33abc < 4);i33abc++){
+int v34abc = i33abc;
+int v35abc = ((((i33abc >= (v27abc * 59)) <= (49 - v27abc)) <= v25abc) && v25abc);
+int v36abc = 93;
+fio::println(c32abc);
+}
+} else {
+int v37abc = (((v25abc * i26abc) >= 52) <= v25abc);
+int v38abc = (((((13 > p0abcd) > (p0abcd - v25abc)) + v25abc) - 92) + (i26abc + 64));
+}
+fio::println(i26abc);
+}
+v25abc = (!((v25abc && v25abc)) * -((p0abcd - p0abcd)));
+return ((v25abc > 21) && ((v25abc * p0abcd) > 18));
+}
+
+int f25abc(int p0abcd){
+for(int i0abcd = 0;(i0abcd < 1);i0abcd++){
+int v1abcd = (((86 || 43) / 9) - 14);
+for(int i2abcd = 0; i2abcd < 3; i2abcd++){
+for(int i3abcd = 0; i3abcd < 3; i3abcd++){
+fio::println(i2abcd);
+};
+int v4abcd = (((9 * f14abc(i2abcd)) >= v1abcd) + ((i2abcd / 3) / 2));
+};
+}
+p0abcd = ((p0abcd - (16 * p0abcd)) < 42);
+return f14abc(p0abcd);
+}
+
+int f26abc(int p0abcd){
+p0abcd = p0abcd;
+int v0abcd = 55;
+int v1abcd = -(((91 - 78) + 98));
+fio::println(p0abcd);
+return ((5 + v0abcd) > (((p0abcd * v1abcd) + -(v0abcd)) + (f8abcd() - p0abcd)));
+}
+
+int f27abc(){
+int v0abcd = 11;
+int v1abcd = -(((f7abcd(v0abcd,v0abcd) == 65) == (53 - v0abcd)));
+for(int i2abcd = 0;(i2abcd < 3);i2abcd++){
+v0abcd = (((((v0abcd + i2abcd) - (66 * 27)) + 45) + 43) + (v1abcd - v0abcd));
+v1abcd = ((v0abcd - 52) == ((f22abc(v0abcd,24,20) * i2abcd) - v0abcd));
+if(((f20abc((v1abcd + 9),70) != (v1abcd / 5)) == (v1abcd - i2abcd))){
+int c3abcd = 4;
+while((c3abcd > 0)){
+f14abc(2);
+int v4abcd = ((-(52) - v0abcd) - (i2abcd / 9));
+f12abc((f8abcd() - (v0abcd / 4)));
+v0abcd = (90 - v0abcd);
+int v5abcd = 96;
+c3abcd = (c3abcd - 1);
+}
+int c6abcd = 3;
+while((c6abcd > 0)){
+f25abc((((v1abcd - v1abcd) + i2abcd) - v0abcd));
+int v7abcd = 5;
+int v8abcd = (c6abcd >= ((v0abcd * (v1abcd - v1abcd)) * c6abcd));
+int v9abcd = ((((88 < f17abc()) * 93) - v1abcd) < v1abcd);
+f4abcd();
+c6abcd = (c6abcd - 1);
+}
+fio::println(v1abcd);
+f8abcd();
+for(int i10abc = 0; i10abc < 1; i10abc++){
+int v11abc = (((((i2abcd && v0abcd) * c6abcd) + i10abc) + 18) && (f13abc(46,v0abcd,77) > 57));
+int v12abc = ((((v0abcd / 7) + i2abcd) && v1abcd) > 97);
+v1abcd = (((c3abcd < f5abcd()) + (89 / 7)) - ((v12abc / 8) / 6));
+fio::println(c6abcd);
+};
+v0abcd = f5abcd();
+}
+f21abc(f0abcd(),(((f21abc(i2abcd,i2abcd,49) * i2abcd) * 27) >= v1abcd),((i2abcd < f18abc(i2abcd,v1abcd,v1abcd)) != (i2abcd > v1abcd)));
+v0abcd = ((((-(v0abcd) + 9) - v0abcd) + ((99 / 1) * f8abcd())) - 30);
+}
+int v13abc = -(!((41 - v1abcd)));
+for(int i14abc = 0;(i14abc < 4);i14abc++){
+int v15abc = ((v0abcd != v13abc) || (46 == (59 + i14abc)));
+int v16abc = v13abc;
+int v17abc = (v16abc + (47 / 9));
+}
+return ((((!((v13abc < v13abc)) - v0abcd) - 2) < v0abcd) == v1abcd);
+}
+
+int f28abc(int p0abcd,int p1abcd,int p2abcd){
+fio::println(p1abcd);
+int v0abcd = p2abcd;
+int v1abcd = p2abcd;
+for(int i2abcd = 0;(i2abcd < 1);i2abcd++){
+for(int i3abcd = 0;(i3abcd < 4);i3abcd++){
+for(int i4abcd = 0;(i4abcd < 1);i4abcd++){
+int v5abcd = !((i3abcd || 47));
+fio::println(p1abcd);
+}
+fio::println(p1abcd);
+int v6abcd = (p1abcd >= ((f16abc(92) + p1abcd) / 5));
+for(int i7abcd = 0;(i7abcd < 2);i7abcd++){
+f17abc();
+int v8abcd = 89;
+int v9abcd = -((p1abcd + p0abcd));
+}
+if(((i2abcd * (83 && p1abcd)) == v1abcd)){
+int v10abc = 6;
+fio::println(i3abcd);
+int v11abc = (98 - !((p0abcd + f19abc(v6abcd,14))));
+int v12abc = i2abcd;
+fio::println(v0abcd);
+int v13abc = (22 + (i2abcd && f24abc(p0abcd)));
+}
+int v14abc = 48;
+}
+int c15abc = 2;
+while((c15abc > 0)){
+int v16abc = v1abcd;
+fio::println(v16abc);
+int v17abc = (f8abcd() - p2abcd);
+fio::println(i2abcd);
+fio::println(i2abcd);
+for(int i18abc = 0; i18abc < 4; i18abc++){
+int v19abc = (-((v0abcd + 51)) + ((v16abc * 90) / 4));
+f27abc();
+int v20abc = (((((p2abcd * p1abcd) / 2) - f0abcd()) == p1abcd) != i18abc);
+int v21abc = ((86 * c15abc) && (31 - (v17abc * f24abc(3))));
+int v22abc = (((13 - 34) - !(20)) + 94);
+f13abc(p2abcd,21,(c15abc * (f24abc(v17abc) * 21)));
+};
+c15abc = (c15abc - 1);
+}
+int c23abc = 1;
+while((c23abc > 0)){
+for(int i24abc = 0; i24abc < 3; i24abc++){
+f18abc(c15abc,((v0abcd == f24abc(v0abcd)) && (p2abcd * 70)),((41 <= f23abc()) != (p0abcd >= i2abcd)));
+int v25abc = (14 && (((((55 - v1abcd) + c23abc) + 45) + (c23abc * 55)) + 3));
+v25abc = (((!(p0abcd) || (v0abcd * 33)) + 99) && (f1abcd(c23abc,i24abc,c23abc) + p2abcd));
+};
+int v26abc = 51;
+int v27abc = c23abc;
+for(int i28abc = 0;(i28abc < 4);i28abc++){
+int v29abc = (5 / 9);
+int v30abc = (((((p1abcd || v29abc) / 9) + f5abcd()) - c15abc) - f27abc());
+int v31abc = (((v26abc - v1abcd) - (29 * v26abc)) != (72 - (c23abc <= i28abc)));
+f19abc(((97 * i2abcd) && (v0abcd - 43)),(i2abcd - (60 / 7)));
+}
+c23abc = (c23abc - 1);
+}
+p1abcd = (((!(i2abcd) - (f9abcd(p2abcd) * v1abcd)) - 66) == (v0abcd / 3));
+v0abcd = ((89 - (v1abcd == v0abcd)) - i2abcd);
+for(int i32abc = 0; i32abc < 4; i32abc++){
+int v33abc = 15;
+};
+}
+for(int i34abc = 0;(i34abc < 1);i34abc++){
+p2abcd = ((p2abcd + f26abc(i34abc)) - 80);
+f6abcd(((f19abc(52,v1abcd) - 87) || -(84)),(((p0abcd <= p2abcd) + p2abcd) == v0abcd),(v0abcd - (54 / 8)));
+int v35abc = v1abcd;
+fio::println(p0abcd);
+int v36abc = (v35abc + ((v0abcd / 4) * (i34abc != 0)));
+int v37abc = ((v1abcd && ((11 * p2abcd) * p1abcd)) >= ((v1abcd - i34abc) < (14 * f10abc())));
+}
+return (59 == (((p1abcd * p0abcd) - p2abcd) - ((p2abcd && 99) - (27 * f21abc(v1abcd,4,54)))));
+}
+
+int f29abc(){
+int v0abcd = -((((2 || 21) - 78) + 10));
+fio::println(v0abcd);
+int v1abcd = !(((19 * v0abcd) + 89));
+return (83 - -((63 / 2)));
+}
+
+int solve(int p0abcd){
+if(((p0abcd >= (1 + 71)) > (f28abc(p0abcd,p0abcd,p0abcd) - 96))){
+fio::println(p0abcd);
+}
+int v0abcd = p0abcd;
+return (p0abcd + !((v0abcd <= v0abcd)));
+}
+
+int main() {
+int t = 1;
+if (multiTest) fio::read(t);
+for (int ii = 0; ii < t; ii++) {solve(ii);} 
+fio::flush();
+ return 0;
+}
\ No newline at end of file
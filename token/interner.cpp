@@ -0,0 +1,57 @@
+// interner.cpp
+
+#include "interner.h"
+
+uint32_t Interner::Hash(std::string_view text) {
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (char c : text) {
+        h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return h;
+}
+
+void Interner::Grow() {
+    ArenaVector<uint32_t> bigger(slots.empty() ? 64 : slots.size() * 2, 0, slots.get_allocator());
+    size_t mask = bigger.size() - 1;
+    for (Symbol id = 0; id < hashes.size(); id++) {
+        size_t i = hashes[id] & mask;
+        while (bigger[i] != 0) {
+            i = (i + 1) & mask;
+        }
+        bigger[i] = id + 1;
+    }
+    slots.swap(bigger);
+}
+
+Symbol Interner::Find(std::string_view text) const {
+    if (slots.empty()) return kNone;
+    uint32_t h = Hash(text);
+    size_t mask = slots.size() - 1;
+    for (size_t i = h & mask; slots[i] != 0; i = (i + 1) & mask) {
+        Symbol id = slots[i] - 1;
+        if (hashes[id] == h && Name(id) == text) return id;
+    }
+    return kNone;
+}
+
+Symbol Interner::Intern(std::string_view text) {
+    // keep the table at most half full
+    if ((hashes.size() + 1) * 2 > slots.size()) {
+        Grow();
+    }
+    uint32_t h = Hash(text);
+    size_t mask = slots.size() - 1;
+    size_t i = h & mask;
+    for (; slots[i] != 0; i = (i + 1) & mask) {
+        Symbol id = slots[i] - 1;
+        if (hashes[id] == h && Name(id) == text) return id;
+    }
+
+    Symbol id = static_cast<Symbol>(hashes.size());
+    blob.insert(blob.end(), text.begin(), text.end());
+    starts.push_back(static_cast<uint32_t>(blob.size()));
+    hashes.push_back(h);
+    slots[i] = id + 1;
+    return id;
+}
@@ -0,0 +1,77 @@
+// interner.h
+
+#ifndef INTERNER_H
+#define INTERNER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "../memory/arena.h"
+
+// Dense 32-bit ID for an interned string.
+using Symbol = uint32_t;
+
+// Read-only id -> text half of an interner: the names back to back and
+// where each one starts. It is a pair of pointers, so it can look into an
+// Interner or straight into a mapped AST cache file.
+class NameTable {
+public:
+    NameTable() = default;
+    // starts has size + 1 entries; name i is blob[starts[i], starts[i+1])
+    NameTable(const uint32_t* starts, const char* blob, size_t size)
+        : starts(starts), blob(blob), size(size) {}
+
+    std::string_view Name(Symbol id) const {
+        return std::string_view(blob + starts[id], starts[id + 1] - starts[id]);
+    }
+    size_t Size() const { return size; }
+    const uint32_t* Starts() const { return starts; }
+    const char* Blob() const { return blob; }
+    size_t BlobSize() const { return starts ? starts[size] : 0; }
+
+private:
+    const uint32_t* starts = nullptr;
+    const char* blob = nullptr;
+    size_t size = 0;
+};
+
+// Assigns each distinct string a Symbol, numbered from 0 in order of first
+// appearance. The text of every symbol lives once in a shared blob, so a
+// program that mentions `i` ten thousand times stores "i" once and everyone
+// else compares and hashes the integer.
+class Interner {
+public:
+    static constexpr Symbol kNone = UINT32_MAX;
+
+    // With an arena, all of the interner's storage comes from it.
+    explicit Interner(Arena* arena = nullptr)
+        : blob(arena), starts(1, 0, arena), hashes(arena), slots(arena) {}
+
+    Symbol Intern(std::string_view text);
+    // Interns every name of table in order; on an empty interner each keeps
+    // the symbol it has in table.
+    void InternAll(NameTable table) {
+        for (Symbol id = 0; id < table.Size(); id++) Intern(table.Name(id));
+    }
+    // kNone if text was never interned
+    Symbol Find(std::string_view text) const;
+    // Valid until the next call to Intern.
+    std::string_view Name(Symbol id) const {
+        return std::string_view(blob.data() + starts[id], starts[id + 1] - starts[id]);
+    }
+    size_t Size() const { return hashes.size(); }
+    // Valid until the next call to Intern.
+    NameTable Table() const { return NameTable(starts.data(), blob.data(), Size()); }
+
+private:
+    static uint32_t Hash(std::string_view text);
+    void Grow();
+
+    ArenaVector<char> blob;            // all names back to back
+    ArenaVector<uint32_t> starts;      // name i is blob[starts[i], starts[i+1])
+    ArenaVector<uint32_t> hashes;      // per symbol, so growing never rehashes text
+    ArenaVector<uint32_t> slots;       // open addressing table of symbol + 1, 0 = empty
+};
+
+#endif // INTERNER_H
@@ -1,6 +1,7 @@
 // token.cpp
 
 #include "token.h"
+#include <cctype>
 
 
 std::string TokenTypeToString(TokenType type) {
@@ -50,7 +51,94 @@ std::string TokenTypeToString(TokenType type) {
         case TokenType::FOR: return "FOR";
         case TokenType::WHILE: return "WHILE";
         case TokenType::FORN: return "FORN";
+        case TokenType::CIN: return "CIN";
         // Add cases for any other TokenType enums you've added
         default: return "UNKNOWN";
     }
-}
\ No newline at end of file
+}
+
+std::string_view TokenText(TokenType type) {
+    switch (type) {
+        case TokenType::ASSIGN: return "=";
+        case TokenType::PLUS: return "+";
+        case TokenType::PLUSPLUS: return "++";
+        case TokenType::MINUS: return "-";
+        case TokenType::MINUSMINUS: return "--";
+        case TokenType::BANG: return "!";
+        case TokenType::ASTERISK: return "*";
+        case TokenType::SLASH: return "/";
+        case TokenType::LT: return "<";
+        case TokenType::GT: return ">";
+        case TokenType::LTE: return "<=";
+        case TokenType::GTE: return ">=";
+        case TokenType::AND: return "&&";
+        case TokenType::OR: return "||";
+        case TokenType::NOT_EQ: return "!=";
+        case TokenType::EQ: return "==";
+        case TokenType::INT: return "int";
+        case TokenType::FLOAT: return "float";
+        case TokenType::CHAR: return "char";
+        case TokenType::BOOL: return "bool";
+        case TokenType::VARCHAR: return "varchar";
+        case TokenType::VI: return "vi";
+        case TokenType::VOID: return "void";
+        case TokenType::FOR: return "for";
+        case TokenType::FORN: return "forn";
+        case TokenType::WHILE: return "while";
+        case TokenType::COUT: return "cout";
+        case TokenType::CIN: return "cin";
+        case TokenType::IF: return "if";
+        case TokenType::ELSE: return "else";
+        case TokenType::RETURN: return "return";
+        case TokenType::TRUE: return "true";
+        case TokenType::FALSE: return "false";
+        default: return std::string_view();
+    }
+}
+
+std::string DecodeLiteral(std::string_view raw) {
+    if (raw.size() < 2) return std::string();
+    std::string_view body = raw.substr(1, raw.size() - 2);
+    if (body.find('\\') == std::string_view::npos) {
+        return std::string(body);
+    }
+
+    std::string value;
+    value.reserve(body.size());
+    for (size_t i = 0; i < body.size(); i++) {
+        if (body[i] != '\\' || i + 1 == body.size()) {
+            value += body[i];
+            continue;
+        }
+        char c = body[++i];
+        switch (c) {
+            case 'n': value += '\n'; break;
+            case 't': value += '\t'; break;
+            case 'r': value += '\r'; break;
+            case 'a': value += '\a'; break;
+            case 'b': value += '\b'; break;
+            case 'f': value += '\f'; break;
+            case 'v': value += '\v'; break;
+            case 'x': {
+                int code = 0;
+                while (i + 1 < body.size() && std::isxdigit((unsigned char)body[i + 1])) {
+                    char h = body[++i];
+                    code = code * 16 + (std::isdigit((unsigned char)h) ? h - '0' : (h | 0x20) - 'a' + 10);
+                }
+                value += static_cast<char>(code);
+                break;
+            }
+            case '0': case '1': case '2': case '3':
+            case '4': case '5': case '6': case '7': {
+                int code = c - '0';
+                for (int k = 0; k < 2 && i + 1 < body.size() && body[i + 1] >= '0' && body[i + 1] <= '7'; k++) {
+                    code = code * 8 + (body[++i] - '0');
+                }
+                value += static_cast<char>(code);
+                break;
+            }
+            default: value += c; break;  // \\ \' \" \? and anything unknown
+        }
+    }
+    return value;
+}
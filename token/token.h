@@ -1,11 +1,13 @@
 #ifndef TOKEN_H
 #define TOKEN_H
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
-enum class TokenType {
+enum class TokenType : uint8_t {
     ILLEGAL,
     EOF_TOKEN,
 
@@ -64,18 +66,31 @@ enum class TokenType {
     FOR,
     WHILE,
     COUT,
+    CIN,
     FORN,
     VOID,
 };
 
 std::string TokenTypeToString(TokenType type);
 
+// Source spelling of an operator or keyword, which is the same for every
+// token of its type ("+", "<=", "int"). Empty for identifiers, literals and
+// anything else whose text varies.
+std::string_view TokenText(TokenType type);
+
+// Value of a STRING_LITERAL or CHAR_LITERAL given its raw text (quotes and
+// escapes included, as the lexer leaves it). Literals are stored raw and
+// only decoded by consumers that need the actual characters.
+std::string DecodeLiteral(std::string_view raw);
+
+// A token does not own its text: literal is a view into the buffer the
+// lexer was given, so that buffer must outlive the token.
 class Token {
 public:
     TokenType type;
-    std::string literal;
+    std::string_view literal;
 
-    Token(TokenType type, const std::string& literal) : type(type), literal(literal) {}
+    Token(TokenType type, std::string_view literal) : type(type), literal(literal) {}
 };
 
 #endif // TOKEN_H
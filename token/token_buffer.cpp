@@ -0,0 +1,49 @@
+// token_buffer.cpp
+
+#include "token_buffer.h"
+
+namespace {
+
+bool IsInterned(TokenType type) {
+    switch (type) {
+    case TokenType::IDENT: case TokenType::INT_LITERAL: case TokenType::FLOAT_LITERAL:
+    case TokenType::STRING_LITERAL: case TokenType::CHAR_LITERAL: case TokenType::BOOLEAN_LITERAL:
+        return true;
+    default:
+        return false;
+    }
+}
+
+}  // namespace
+
+void TokenBuffer::Reserve(size_t n) {
+    types.reserve(n);
+    offsets.reserve(n);
+    lengths.reserve(n);
+    symbols.reserve(n);
+}
+
+void TokenBuffer::Push(TokenType type, std::string_view literal) {
+    types.push_back(static_cast<uint8_t>(type));
+    // empty literals (EOF) may point anywhere, so pin them to the end
+    offsets.push_back(literal.empty() ? static_cast<uint32_t>(source.size())
+                                      : static_cast<uint32_t>(literal.data() - source.data()));
+    lengths.push_back(static_cast<uint32_t>(literal.size()));
+    symbols.push_back(IsInterned(type) ? names.Intern(literal) : Interner::kNone);
+}
+
+void TokenBuffer::Append(const TokenBuffer& other) {
+    types.insert(types.end(), other.types.begin(), other.types.end());
+    offsets.insert(offsets.end(), other.offsets.begin(), other.offsets.end());
+    lengths.insert(lengths.end(), other.lengths.begin(), other.lengths.end());
+
+    // other numbered its symbols on its own; map each one once, not per use
+    std::vector<Symbol> remap(other.names.Size());
+    for (Symbol id = 0; id < remap.size(); id++) {
+        remap[id] = names.Intern(other.names.Name(id));
+    }
+    symbols.reserve(symbols.size() + other.symbols.size());
+    for (Symbol id : other.symbols) {
+        symbols.push_back(id == Interner::kNone ? id : remap[id]);
+    }
+}
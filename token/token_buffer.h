@@ -0,0 +1,95 @@
+// token_buffer.h
+
+#ifndef TOKEN_BUFFER_H
+#define TOKEN_BUFFER_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+#include "token.h"
+#include "interner.h"
+#include "../memory/arena.h"
+
+static_assert(static_cast<int>(TokenType::VOID) < 256, "TokenType must fit in a byte");
+
+// Structure-of-arrays token storage: one byte of type plus a 32-bit offset
+// and length into the source per token, instead of a vector of Tokens. The
+// lexer fills it once and the parser reads it through a TokenCursor.
+//
+// Offsets are 32-bit, so a single buffer covers up to kMaxSourceBytes of
+// source; callers check that before lexing into one, since nothing past the
+// limit could be addressed. The source is borrowed and has to outlive the
+// buffer.
+//
+// Identifiers and literals are interned as they are pushed: SymbolAt(i) is
+// the dense ID of token i's text in Names(), or Interner::kNone for every
+// other token type. AST nodes keep that ID instead of a copy of the text.
+class TokenBuffer {
+public:
+    static constexpr size_t kMaxSourceBytes = UINT32_MAX;
+
+    TokenBuffer() = default;
+    // With an arena, the token arrays and the interner live in it.
+    explicit TokenBuffer(std::string_view source, Arena* arena = nullptr)
+        : source(source), types(arena), offsets(arena), lengths(arena), symbols(arena),
+          names(arena) {}
+
+    void Reserve(size_t n);
+    // literal must be a view into the source (or empty)
+    void Push(TokenType type, std::string_view literal);
+    // Appends every token of other, which must be over the same source.
+    // Its symbols are renumbered into this buffer's interner.
+    void Append(const TokenBuffer& other);
+
+    size_t Size() const { return types.size(); }
+    TokenType Type(size_t i) const { return static_cast<TokenType>(types[i]); }
+    std::string_view Literal(size_t i) const {
+        return std::string_view(source.data() + offsets[i], lengths[i]);
+    }
+    Symbol SymbolAt(size_t i) const { return symbols[i]; }
+    Token At(size_t i) const { return Token(Type(i), Literal(i)); }
+    std::string_view Source() const { return source; }
+    const Interner& Names() const { return names; }
+    Interner& Names() { return names; }
+    Arena* SessionArena() const { return types.get_allocator().arena; }
+
+private:
+    friend class TokenCursor;
+
+    std::string_view source;
+    ArenaVector<uint8_t> types;
+    ArenaVector<uint32_t> offsets;
+    ArenaVector<uint32_t> lengths;
+    ArenaVector<Symbol> symbols;
+    Interner names;
+};
+
+// Read-only view of a TokenBuffer for the parser: raw pointers into the
+// arrays, so reading a token is a couple of loads and nothing is copied.
+// Valid as long as the buffer is alive and not pushed to.
+class TokenCursor {
+public:
+    TokenCursor() = default;
+    explicit TokenCursor(const TokenBuffer& buffer)
+        : types(buffer.types.data()), offsets(buffer.offsets.data()),
+          lengths(buffer.lengths.data()), symbols(buffer.symbols.data()),
+          base(buffer.source.data()),
+          size(static_cast<int>(buffer.types.size())) {}
+
+    int Size() const { return size; }
+    TokenType Type(int i) const { return static_cast<TokenType>(types[i]); }
+    std::string_view Literal(int i) const {
+        return std::string_view(base + offsets[i], lengths[i]);
+    }
+    Symbol SymbolAt(int i) const { return symbols[i]; }
+
+private:
+    const uint8_t* types = nullptr;
+    const uint32_t* offsets = nullptr;
+    const uint32_t* lengths = nullptr;
+    const Symbol* symbols = nullptr;
+    const char* base = nullptr;
+    int size = 0;
+};
+
+#endif // TOKEN_BUFFER_H